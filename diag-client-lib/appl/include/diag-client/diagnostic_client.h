@@ -13,6 +13,7 @@
 #include <string_view>
 
 #include "diag-client/diagnostic_client_conversation.h"
+#include "diag-client/diagnostic_client_flash_message_type.h"
 #include "diag-client/diagnostic_client_result.h"
 #include "diag-client/diagnostic_client_vehicle_info_message_type.h"
 
@@ -33,6 +34,13 @@ class DiagClient final {
     kNoResponseReceived = 2U, /**< No vehicle identification response received */
   };
 
+  /**
+   * @brief  Definitions of Flash error code
+   */
+  enum class FlashError : std::uint8_t {
+    kInvalidParameter = 0U, /**< Invalid Parameter passed, no ECU flashed */
+  };
+
  public:
   /**
    * @brief         Constructs an instance of DiagClient
@@ -88,6 +96,61 @@ class DiagClient final {
   SendVehicleIdentificationRequest(
       diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept;
 
+  /**
+   * @brief       Function to send vehicle identification request and stream every response as it is received
+   * @details     The request completes once the expected number of DoIP entities responded, the handler asked to
+   *              stop or DoIPCtrl expired, whichever comes first
+   * @param[in]   vehicle_info_request
+   *              Vehicle information sent along with request
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing the vehicle information received until completion on success,
+   *              VehicleResponseErrorCode on error
+   * @implements  DiagClientLib-VehicleDiscovery
+   */
+  Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, VehicleInfoResponseError>
+  SendVehicleIdentificationRequest(
+      diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+      vehicle_info::VehicleInfoResponseHandler response_handler) noexcept;
+
+  /**
+   * @brief       Function to send a unicast vehicle identification request to every target and stream the responses
+   * @details     Used where broadcast vehicle identification requests are not routed. Requests are sent from the
+   *              first discovery endpoint within the configured rate and in-flight window, the sweep completes once
+   *              every target answered or timed out, or the handler asked to stop
+   * @param[in]   sweep_request
+   *              The target addresses or IPv4 networks along with rate, window and timeout
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing the vehicle information received until completion on success,
+   *              VehicleResponseErrorCode on error
+   * @implements  DiagClientLib-VehicleDiscovery
+   */
+  Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, VehicleInfoResponseError>
+  SendVehicleIdentificationSweep(vehicle_info::VehicleInfoSweepRequestType sweep_request,
+                                 vehicle_info::VehicleInfoResponseHandler response_handler) noexcept;
+
+  /**
+   * @brief       Function to get the DoIP entities known from vehicle announcements and identification responses
+   * @details     Vehicle announcements received on UDP port 13401 keep the entities up to date, so that a known
+   *              DoIP entity can be connected without sending a vehicle identification request first
+   * @param[in]   filter
+   *              The logical address, VIN and EID matched, an empty filter returns all known entities
+   * @return      The matching DoIP entities along with the time they were last seen
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  vehicle_info::VehicleEntityListType GetVehicleEntities(
+      vehicle_info::VehicleEntityFilter const &filter) const noexcept;
+
+  /**
+   * @brief       Function to set the handler notified when a known DoIP entity is added or changed
+   * @details     Refreshing the time an entity was last seen is not notified
+   * @param[in]   change_handler
+   *              The handler to be set, empty to stop notifications
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  void SetVehicleEntityChangeHandler(vehicle_info::VehicleEntityChangeHandler change_handler) noexcept;
+
   /**
    * @brief       Function to get required diag client conversation object based on conversation name
    * @param[in]   conversation_name
@@ -98,6 +161,20 @@ class DiagClient final {
   conversation::DiagClientConversation GetDiagnosticClientConversation(
       std::string_view conversation_name) noexcept;
 
+  /**
+   * @brief       Function to flash several ECUs concurrently
+   * @details     Blocks until every ECU is completed or failed. ECUs are started in the requested order as soon
+   *              as a conversation is free and the gateway and bus limits allow
+   * @param[in]   flash_request
+   *              The ECUs flashed along with conversations and limits
+   * @param[in]   progress_handler
+   *              The handler notified on every state change and transferred block, may be empty
+   * @return      Result containing the state of every ECU on success, FlashError on error
+   * @implements  DiagClientLib-Flash-Orchestration
+   */
+  Result<flash::FlashResponseType, FlashError> SendFlashRequest(
+      flash::FlashRequestType flash_request, flash::FlashProgressHandler progress_handler) noexcept;
+
  private:
   /**
    * @brief    Forward declaration of diag client implementation
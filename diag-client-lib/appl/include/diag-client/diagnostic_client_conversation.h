@@ -9,7 +9,11 @@
 #define DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_CONVERSATION_H
 
 #include <cstdint>
+#include <functional>
+#include <future>
 
+#include "core/include/span.h"
+#include "diag-client/diagnostic_client_flash_message_type.h"
 #include "diag-client/diagnostic_client_result.h"
 #include "diag-client/diagnostic_client_uds_message_type.h"
 
@@ -61,9 +65,40 @@ class DiagClientConversation final {
     kDiagNegAckReceived = 4U,  /**< Diagnostic negative acknowledgement received */
     kDiagResponseTimeout = 5U, /**< No diagnostic response message received within P2/P2Star time */
     kDiagInvalidParameter = 6U, /**< Passed parameter value is not valid */
-    kDiagBusyProcessing = 7U    /**< Conversation is already busy processing previous request */
+    kDiagBusyProcessing = 7U,   /**< Conversation is already busy processing previous request */
+    kDiagConnectionLost = 8U    /**< Connection to Diagnostic Server lost during request */
   };
 
+  /**
+   * @brief      Definitions of Download errors
+   */
+  enum class DownloadError : std::uint8_t {
+    kImageNotAvailable = 0U,         /**< Image file could not be opened */
+    kInvalidParameter = 1U,          /**< Passed parameter value is not valid */
+    kRequestDownloadFailed = 2U,     /**< RequestDownload failed or answered negatively */
+    kTransferDataFailed = 3U,        /**< TransferData failed or answered negatively */
+    kRequestTransferExitFailed = 4U, /**< RequestTransferExit failed or answered negatively */
+    kImageInvalid = 5U /**< Image has invalid records, checksums or overlapping address ranges */
+  };
+
+  /**
+   * @brief         Type alias of diagnostic response result
+   */
+  using DiagResult = Result<uds_message::UdsResponseMessagePtr, DiagError>;
+
+  /**
+   * @brief         Type alias of handler invoked on completion of asynchronous diagnostic request
+   */
+  using DiagResponseHandler = std::function<void(DiagResult)>;
+
+  /**
+   * @brief         Type alias of sink receiving the diagnostic response in chunks
+   * @details       Called with the total size in bytes of the response starting from SID and a view onto the next
+   *                chunk of the response, the view is valid within the call only
+   */
+  using DiagResponseSink =
+      std::function<void(std::size_t response_size, core_type::Span<std::uint8_t const> chunk)>;
+
   /**
    * @brief         Constructor an instance of DiagClientConversation
    * @param[in]     conversation_name
@@ -141,6 +176,72 @@ class DiagClientConversation final {
   Result<uds_message::UdsResponseMessagePtr, DiagError> SendDiagnosticRequest(
       uds_message::UdsRequestMessageConstPtr message) noexcept;
 
+  /**
+   * @brief         Function to send Diagnostic Request without blocking the caller
+   * @details       This is a non-blocking function i.e. function call returns once the request is transmitted and the
+   *                final diagnostic response (Positive/Negative) or error is delivered later via the provided handler.
+   *                Reception of pending response(NRC 0x78) is handled internally. The handler is invoked exactly once,
+   *                either from within this call (invalid parameter, busy) or from the conversation worker context,
+   *                where the next request may be sent.
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @param[in]     response_handler
+   *                The handler invoked with diagnostic response message received, DiagError in case of error
+   * @pre           Must be connected to diagnostic server
+   * @implements    DiagClientLib-Conversation-DiagRequestResponseAsync
+   */
+  void SendDiagnosticRequestAsync(uds_message::UdsRequestMessageConstPtr message,
+                                  DiagResponseHandler response_handler) noexcept;
+
+  /**
+   * @brief         Function to send Diagnostic Request and get the Diagnostic Response via future
+   * @details       This is a non-blocking function, the returned future becomes ready with final diagnostic
+   *                response (Positive/Negative) or with error
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @pre           Must be connected to diagnostic server
+   * @return        std::future<DiagResult>
+   *                The future holding Diagnostic Response message received, DiagError in case of error
+   * @implements    DiagClientLib-Conversation-DiagRequestResponseAsync
+   */
+  std::future<DiagResult> SendDiagnosticRequestAsync(
+      uds_message::UdsRequestMessageConstPtr message) noexcept;
+
+  /**
+   * @brief         Function to send Diagnostic Request and stream the Diagnostic Response to a sink
+   * @details       This is a blocking function, the final diagnostic response (Positive/Negative) is handed to the sink
+   *                in chunks as they are received instead of being buffered as a whole. Reception of pending
+   *                response(NRC 0x78) is handled internally. The sink is invoked from the network context, it must not
+   *                block or call back into the conversation. The response size is limited by "RxBufferSize".
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @param[in]     response_sink
+   *                The sink receiving the chunks of the diagnostic response
+   * @pre           Must be connected to diagnostic server
+   * @return        Result<void, DiagError>
+   *                Empty result once the whole response is handed to the sink, DiagError in case of error
+   * @implements    DiagClientLib-Conversation-DiagRequestResponse
+   */
+  Result<void, DiagError> SendDiagnosticRequest(uds_message::UdsRequestMessageConstPtr message,
+                                                DiagResponseSink response_sink) noexcept;
+
+  /**
+   * @brief         Function to download an image into the memory of the Diagnostic Server
+   * @details       This is a blocking function, for every address range of the image it sends RequestDownload(0x34),
+   *                the range in TransferData(0x36) blocks of the maximum length accepted by the server and finishes
+   *                with RequestTransferExit(0x37). The image is validated once before download, the next block is
+   *                read from the memory mapped image while the current one is transferred.
+   *                Reception of pending response(NRC 0x78) is handled internally.
+   * @param[in]     download_request
+   *                The download parameters
+   * @pre           Must be connected to diagnostic server, in the session and security level required for download
+   * @return        Result<flash::DownloadResponseType, DownloadError>
+   *                The download result with timing of every block, DownloadError in case of error
+   * @implements    DiagClientLib-Conversation-Download
+   */
+  Result<flash::DownloadResponseType, DownloadError> SendDownloadRequest(
+      flash::DownloadRequestType const &download_request) noexcept;
+
  private:
   /**
    * @brief    Forward declaration of diag client conversation implementation
@@ -0,0 +1,370 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_FLASH_MESSAGE_TYPE_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_FLASH_MESSAGE_TYPE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "core/include/span.h"
+
+namespace diag {
+namespace client {
+namespace flash {
+
+/**
+ * @brief       Definitions of checksums calculated over the downloaded data
+ */
+enum class ChecksumType : std::uint8_t {
+  kNone = 0U,      /**< No checksum calculated */
+  kCrc32 = 1U,     /**< CRC-32 with reflected polynomial 0x04C11DB7 as used by Ethernet */
+  kCrc16Ccitt = 2U /**< CRC-16/CCITT-FALSE with polynomial 0x1021 and initial value 0xFFFF */
+};
+
+/**
+ * @brief       Structure containing the parameters of a download into the memory of the Diagnostic Server
+ */
+struct DownloadRequest {
+  /**
+   * @brief     Path to the image downloaded
+   * @details   Intel HEX (.hex, .ihex) and Motorola S-record (.s19, .s28, .s37, .srec, .mot) images are detected by
+   *            extension, any other file is a raw binary image. The image is mapped into memory and decoded block
+   *            by block, it is never copied as a whole
+   */
+  std::string image_path{};
+
+  /**
+   * @brief     Start address of the memory a raw binary image is downloaded to
+   * @details   Intel HEX and Motorola S-record images carry their own addresses, each contiguous address range is
+   *            downloaded with its own RequestDownload
+   */
+  std::uint64_t memory_address{0U};
+
+  /**
+   * @brief     Data format identifier of RequestDownload
+   * @details   High nibble is the compression method, low nibble the encrypting method, 0x00 for none
+   */
+  std::uint8_t data_format_identifier{0x00U};
+
+  /**
+   * @brief     Address and length format identifier of RequestDownload
+   * @details   High nibble is the length in bytes of memory size, low nibble the length in bytes of memory
+   *            address, each one in the range 1 to 8
+   */
+  std::uint8_t address_and_length_format_identifier{0x44U};
+
+  /**
+   * @brief     Checksum calculated over the data of every segment
+   * @details   Calculated while the blocks are framed, so that the image is read only once, e.g. to pass it to the
+   *            check memory routine of the Diagnostic Server afterwards
+   */
+  ChecksumType checksum_type{ChecksumType::kNone};
+};
+
+/**
+ * @brief       Structure containing the timing of a single TransferData block
+ */
+struct BlockTiming {
+  /**
+   * @brief     Block sequence counter sent with the block
+   */
+  std::uint8_t block_sequence_counter{0U};
+
+  /**
+   * @brief     Number of image bytes transferred with the block
+   */
+  std::size_t block_length{0U};
+
+  /**
+   * @brief     Time from transmission of the block until its positive response
+   */
+  std::chrono::microseconds duration{};
+};
+
+/**
+ * @brief       Structure containing the checksum of a downloaded segment
+ */
+struct SegmentChecksum {
+  /**
+   * @brief     Start address of the segment
+   */
+  std::uint64_t memory_address{0U};
+
+  /**
+   * @brief     Number of data bytes of the segment
+   */
+  std::size_t memory_size{0U};
+
+  /**
+   * @brief     Checksum of the segment data, CRC-16 in the low 16 bits
+   */
+  std::uint32_t checksum{0U};
+};
+
+/**
+ * @brief       Structure containing the result of a completed download
+ */
+struct DownloadResponse {
+  /**
+   * @brief     Maximum length of TransferData request accepted by the Diagnostic Server
+   * @details   As announced in the last RequestDownload positive response, including SID and block sequence counter
+   */
+  std::size_t max_number_of_block_length{0U};
+
+  /**
+   * @brief     Number of image bytes transferred
+   */
+  std::size_t transferred_length{0U};
+
+  /**
+   * @brief     Timing of every TransferData block in transmission order
+   */
+  std::vector<BlockTiming> block_timings{};
+
+  /**
+   * @brief     Checksum of every segment in download order, empty if no checksum is requested
+   */
+  std::vector<SegmentChecksum> segment_checksums{};
+
+  /**
+   * @brief     Time from RequestDownload until the positive response of RequestTransferExit
+   */
+  std::chrono::microseconds duration{};
+};
+
+/**
+ * @brief       Type alias of request storage type used while downloading an image
+ */
+using DownloadRequestType = DownloadRequest;
+
+/**
+ * @brief       Type alias of response storage type returned after downloading an image
+ */
+using DownloadResponseType = DownloadResponse;
+
+/**
+ * @brief       Definitions of diagnostic sessions of the Diagnostic Server
+ */
+enum class DiagnosticSession : std::uint8_t {
+  kDefaultSession = 0x01U,     /**< Default session entered on power up and after ECUReset */
+  kProgrammingSession = 0x02U, /**< Programming session required for download */
+  kExtendedSession = 0x03U,    /**< Extended diagnostic session */
+  kSystemSafetySession = 0x04U /**< Safety system diagnostic session */
+};
+
+/**
+ * @brief       Definitions of security access states of the Diagnostic Server
+ */
+enum class SecurityState : std::uint8_t {
+  kLocked = 0U,  /**< No security level unlocked, reentered on every session change */
+  kUnlocked = 1U /**< Security level unlocked with SecurityAccess */
+};
+
+/**
+ * @brief       Definitions of phases an ECU passes while being flashed
+ */
+enum class FlashPhase : std::uint8_t {
+  kQueued = 0U,         /**< Waiting for a free conversation and the gateway and bus limits */
+  kConnecting = 1U,     /**< Connecting to the gateway with routing activation */
+  kSessionControl = 2U, /**< Switching into programming session */
+  kSecurityAccess = 3U, /**< Unlocking the security level with seed and key */
+  kDownloading = 4U,    /**< Downloading the image */
+  kCompleted = 5U,      /**< Image downloaded successfully */
+  kFailed = 6U          /**< Flashing aborted, see logs for more information */
+};
+
+/**
+ * @brief       Structure containing the parameters of flashing a single ECU
+ */
+struct EcuFlashRequest {
+  /**
+   * @brief     Name of the ECU used in logs and progress
+   */
+  std::string ecu_name{};
+
+  /**
+   * @brief     IP address of the DoIP gateway the ECU is reached through
+   */
+  std::string gateway_ip_address{};
+
+  /**
+   * @brief     Logical address of the ECU
+   */
+  std::uint16_t target_address{0U};
+
+  /**
+   * @brief     Identifier of the bus behind the gateway the ECU is connected to
+   */
+  std::uint16_t bus_id{0U};
+
+  /**
+   * @brief     Security level requested with SecurityAccess requestSeed, no SecurityAccess if empty
+   */
+  std::optional<std::uint8_t> security_level{};
+
+  /**
+   * @brief     The image downloaded into the ECU
+   */
+  DownloadRequest download_request{};
+};
+
+/**
+ * @brief       Type alias of handler computing the SecurityAccess key out of the seed of an ECU
+ */
+using SecurityKeyHandler = std::function<std::vector<std::uint8_t>(
+    EcuFlashRequest const &ecu_request, core_type::Span<std::uint8_t const> seed)>;
+
+/**
+ * @brief       Structure containing the parameters of flashing several ECUs concurrently
+ */
+struct FlashRequest {
+  /**
+   * @brief     ECUs flashed, started in the given order as soon as the limits allow
+   */
+  std::vector<EcuFlashRequest> ecu_requests{};
+
+  /**
+   * @brief     Names of the conversations used to flash, configured as json parameter "ConversationName"
+   * @details   Each conversation flashes one ECU at a time, the number of conversations therefore limits the
+   *            number of concurrent sessions. The conversations are created exclusively for flashing
+   */
+  std::vector<std::string> conversation_names{};
+
+  /**
+   * @brief     Maximum number of ECUs flashed concurrently through one gateway
+   */
+  std::size_t max_sessions_per_gateway{4U};
+
+  /**
+   * @brief     Maximum number of ECUs flashed concurrently on one bus behind a gateway
+   */
+  std::size_t max_sessions_per_bus{1U};
+
+  /**
+   * @brief     Handler computing the SecurityAccess key, required if any ECU requests a security level
+   */
+  SecurityKeyHandler security_key_handler{};
+};
+
+/**
+ * @brief       Structure containing the state of a single ECU being flashed
+ */
+struct EcuFlashState {
+  /**
+   * @brief     Name of the ECU as requested
+   */
+  std::string ecu_name{};
+
+  /**
+   * @brief     Current phase of the ECU
+   */
+  FlashPhase phase{FlashPhase::kQueued};
+
+  /**
+   * @brief     Last diagnostic session confirmed by the ECU
+   */
+  DiagnosticSession session{DiagnosticSession::kDefaultSession};
+
+  /**
+   * @brief     Last security access state confirmed by the ECU
+   */
+  SecurityState security{SecurityState::kLocked};
+
+  /**
+   * @brief     Length of the image downloaded into the ECU
+   */
+  std::size_t image_length{0U};
+
+  /**
+   * @brief     Number of image bytes transferred so far
+   */
+  std::size_t transferred_length{0U};
+
+  /**
+   * @brief     Result of the download, valid once the phase is kCompleted
+   */
+  DownloadResponse download_response{};
+};
+
+/**
+ * @brief       Structure containing the progress aggregated over all ECUs
+ */
+struct FlashProgress {
+  /**
+   * @brief     Number of ECUs requested
+   */
+  std::size_t number_of_ecus{0U};
+
+  /**
+   * @brief     Number of ECUs currently flashed
+   */
+  std::size_t active_ecus{0U};
+
+  /**
+   * @brief     Number of ECUs flashed successfully
+   */
+  std::size_t completed_ecus{0U};
+
+  /**
+   * @brief     Number of ECUs failed
+   */
+  std::size_t failed_ecus{0U};
+
+  /**
+   * @brief     Sum of the image lengths of all ECUs
+   */
+  std::size_t total_length{0U};
+
+  /**
+   * @brief     Sum of the image bytes transferred to all ECUs
+   */
+  std::size_t transferred_length{0U};
+};
+
+/**
+ * @brief       Structure containing the result of flashing several ECUs
+ */
+struct FlashResponse {
+  /**
+   * @brief     Final state of every ECU in the requested order
+   */
+  std::vector<EcuFlashState> ecu_states{};
+
+  /**
+   * @brief     Time from start of the first ECU until the last ECU finished
+   */
+  std::chrono::microseconds duration{};
+};
+
+/**
+ * @brief       Type alias of handler notified on every state change and transferred block of an ECU
+ * @details     Notifications are serialized, the handler must return quickly as it delays further flashing
+ */
+using FlashProgressHandler =
+    std::function<void(FlashProgress const &progress, EcuFlashState const &ecu_state)>;
+
+/**
+ * @brief       Type alias of request storage type used while flashing several ECUs
+ */
+using FlashRequestType = FlashRequest;
+
+/**
+ * @brief       Type alias of response storage type returned after flashing several ECUs
+ */
+using FlashResponseType = FlashResponse;
+
+}  // namespace flash
+}  // namespace client
+}  // namespace diag
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_FLASH_MESSAGE_TYPE_H
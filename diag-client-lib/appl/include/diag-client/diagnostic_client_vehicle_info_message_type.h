@@ -8,8 +8,12 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_VEHICLE_INFO_MESSAGE_TYPE_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_INCLUDE_DIAGNOSTIC_CLIENT_VEHICLE_INFO_MESSAGE_TYPE_H
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -53,6 +57,12 @@ struct VehicleAddrInfoResponse {
    *              Bytes are separated by a “:”-character
    */
   std::string gid{};
+
+  /**
+   * @brief       IP address of the local network interface the response was received on
+   * @details     Tells which of the configured discovery endpoints the vehicle is reachable through
+   */
+  std::string interface_address{};
 };
 
 /**
@@ -74,6 +84,41 @@ struct VehicleAddrInfoRequest {
    *            Empty when preselection_mode = 0U
    */
   std::string preselection_value{};
+
+  /**
+   * @brief     Number of DoIP entities after which the request completes without waiting for DoIPCtrl to expire
+   * @details   0U waits the full DoIPCtrl time. A lookup by EID expects a single entity, a lookup by VIN the number
+   *            of DoIP entities of the vehicle
+   */
+  std::size_t expected_response_count{0U};
+};
+
+/**
+ * @brief       Struct containing the targets of a unicast vehicle identification sweep
+ * @details     Used on networks not forwarding broadcast vehicle identification requests. Every target is sent a
+ *              vehicle identification request without preselection
+ */
+struct VehicleAddrInfoSweepRequest {
+  /**
+   * @brief     IP addresses of the DoIP entities requested.
+   *            IPv4 networks given in CIDR notation e.g. "172.16.4.0/22" request all of their host addresses
+   */
+  std::vector<std::string> targets{};
+
+  /**
+   * @brief     Maximum number of requests sent per second, 0U sends as fast as the in-flight window allows
+   */
+  std::uint32_t requests_per_second{0U};
+
+  /**
+   * @brief     Maximum number of targets requested that neither answered nor timed out yet
+   */
+  std::uint16_t in_flight_window{64U};
+
+  /**
+   * @brief     Time after which a target not answering is given up
+   */
+  std::chrono::milliseconds response_timeout{500};
 };
 
 /**
@@ -105,11 +150,79 @@ class VehicleInfoMessage {
   virtual VehicleInfoListResponseType &GetVehicleList() = 0;
 };
 
+/**
+ * @brief       Type alias of handler notified for every DoIP entity as soon as its response is received
+ * @details     Called once per logical address from the udp reception context, it must neither block nor send another
+ *              vehicle identification request. Returning true completes the request without waiting for further
+ *              responses
+ */
+using VehicleInfoResponseHandler = std::function<bool(VehicleAddrInfoResponse const &)>;
+
+/**
+ * @brief       Structure containing a DoIP entity known from vehicle announcements and identification responses
+ */
+struct VehicleEntity {
+  /**
+   * @brief       Vehicle address information last received from the DoIP entity
+   */
+  VehicleAddrInfoResponse address_info{};
+
+  /**
+   * @brief       Time of the last vehicle announcement or identification response received from the DoIP entity
+   */
+  std::chrono::steady_clock::time_point last_seen{};
+};
+
+/**
+ * @brief       Struct containing the keys used to look up known DoIP entities
+ * @details     Every key set must match, an empty filter matches all DoIP entities
+ */
+struct VehicleEntityFilter {
+  /**
+   * @brief     Logical address of the DoIP entity, any if not set
+   */
+  std::optional<std::uint16_t> logical_address{};
+
+  /**
+   * @brief     VIN of the vehicle, any if empty
+   */
+  std::string vin{};
+
+  /**
+   * @brief     Entity Identification of the DoIP entity in the same notation as received, any if empty
+   */
+  std::string eid{};
+};
+
+/**
+ * @brief       Definitions of changes of known DoIP entities
+ */
+enum class VehicleEntityChange : std::uint8_t {
+  kAdded = 0U,  /**< DoIP entity seen for the first time */
+  kChanged = 1U /**< Ip address, logical address, VIN or GID of a known DoIP entity changed */
+};
+
+/**
+ * @brief       Type alias of collection of known DoIP entities
+ */
+using VehicleEntityListType = std::vector<VehicleEntity>;
+
+/**
+ * @brief       Type alias of handler notified when a DoIP entity is added or changed
+ * @details     Called from the udp reception context, it must not block nor set another change handler
+ */
+using VehicleEntityChangeHandler = std::function<void(VehicleEntityChange, VehicleEntity const &)>;
+
 /**
  * @brief       Type alias of request storage type used while sending vehicle identification request
  */
 using VehicleInfoListRequestType = VehicleAddrInfoRequest;
 
+/**
+ * @brief       Type alias of request storage type used while sweeping vehicle identification requests over targets
+ */
+using VehicleInfoSweepRequestType = VehicleAddrInfoSweepRequest;
+
 /**
  * @brief       The unique_ptr for Vehicle Identification Response Message
  */
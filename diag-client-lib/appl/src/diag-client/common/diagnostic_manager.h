@@ -13,6 +13,7 @@
 
 #include "core/include/result.h"
 #include "diag-client/diagnostic_client.h"
+#include "diag-client/diagnostic_client_flash_message_type.h"
 #include "diag-client/diagnostic_client_uds_message_type.h"
 #include "diag-client/diagnostic_client_vehicle_info_message_type.h"
 
@@ -91,13 +92,62 @@ class DiagnosticManager {
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
    * @param[in]   vehicle_info_request
    *              Vehicle information sent along with request
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
    * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
    * @implements  DiagClientLib-VehicleDiscovery
    */
   virtual core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                             DiagClient::VehicleInfoResponseError>
   SendVehicleIdentificationRequest(
-      diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept = 0;
+      diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+      vehicle_info::VehicleInfoResponseHandler response_handler) noexcept = 0;
+
+  /**
+   * @brief       Function to send a unicast vehicle identification request to every target
+   * @param[in]   sweep_request
+   *              The target addresses or IPv4 networks along with rate, window and timeout
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
+   * @implements  DiagClientLib-VehicleDiscovery
+   */
+  virtual core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                            DiagClient::VehicleInfoResponseError>
+  SendVehicleIdentificationSweep(vehicle_info::VehicleInfoSweepRequestType sweep_request,
+                                 vehicle_info::VehicleInfoResponseHandler response_handler) noexcept = 0;
+
+  /**
+   * @brief       Function to get the DoIP entities known from vehicle announcements and identification responses
+   * @param[in]   filter
+   *              The keys matched
+   * @return      The matching DoIP entities
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  virtual vehicle_info::VehicleEntityListType GetVehicleEntities(
+      vehicle_info::VehicleEntityFilter const &filter) const noexcept = 0;
+
+  /**
+   * @brief       Function to set the handler notified when a known DoIP entity is added or changed
+   * @param[in]   change_handler
+   *              The handler to be set, empty to stop notifications
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  virtual void SetVehicleEntityChangeHandler(
+      vehicle_info::VehicleEntityChangeHandler change_handler) noexcept = 0;
+
+  /**
+   * @brief       Function to flash several ECUs concurrently
+   * @param[in]   flash_request
+   *              The ECUs flashed along with conversations and limits
+   * @param[in]   progress_handler
+   *              The handler notified on every state change and transferred block, may be empty
+   * @return      Result containing the state of every ECU on success, FlashError on error
+   * @implements  DiagClientLib-Flash-Orchestration
+   */
+  virtual core_type::Result<flash::FlashResponseType, DiagClient::FlashError> SendFlashRequest(
+      flash::FlashRequestType flash_request,
+      flash::FlashProgressHandler progress_handler) noexcept = 0;
 
  private:
   /**
@@ -8,18 +8,62 @@
 /* includes */
 #include "diag-client/dcm/config_parser/config_parser_type.h"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <string_view>
+
 namespace diag {
 namespace client {
 namespace config_parser {
+namespace {
+
+/**
+ * @brief    Names of log levels in configuration, indexed by log level
+ */
+constexpr std::array<std::string_view, 7u> kLogLevelNames{"Off",  "Fatal", "Error",  "Warn",
+                                                          "Info", "Debug", "Verbose"};
+
+/**
+ * @brief       Function to get the log level from its configured name
+ * @param[in]   log_level_name
+ *              The configured name
+ * @return      The log level, verbose if the name is unknown
+ */
+utility::logger::LogLevel ToLogLevel(std::string_view log_level_name) noexcept {
+  auto const it{std::find(kLogLevelNames.cbegin(), kLogLevelNames.cend(), log_level_name)};
+  return it != kLogLevelNames.cend()
+             ? static_cast<utility::logger::LogLevel>(std::distance(kLogLevelNames.cbegin(), it))
+             : utility::logger::LogLevel::kVerbose;
+}
+}  // namespace
 
 diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(
     boost_support::parser::boost_tree &config_tree) {
   diag::client::config_parser::DcmClientConfig config{};
   // get the udp info for vehicle discovery
-  config.udp_ip_address = config_tree.get<std::string>("UdpIpAddress");
-  config.udp_broadcast_address = config_tree.get<std::string>("UdpBroadcastAddress");
+  config.discovery_endpoints.emplace_back(
+      DiscoveryEndpointType{config_tree.get<std::string>("UdpIpAddress"),
+                            config_tree.get<std::string>("UdpBroadcastAddress")});
+  // get the optional further endpoints for vehicle discovery, e.g. on other network interfaces
+  if (boost::optional<boost_support::parser::boost_tree &> discovery_endpoints{
+          config_tree.get_child_optional("DiscoveryEndpoints")}) {
+    for (boost_support::parser::boost_tree::value_type &endpoint_ptr: *discovery_endpoints) {
+      config.discovery_endpoints.emplace_back(
+          DiscoveryEndpointType{endpoint_ptr.second.get<std::string>("UdpIpAddress"),
+                                endpoint_ptr.second.get<std::string>("UdpBroadcastAddress")});
+    }
+  }
   // get total number of conversation
   config.num_of_conversation = config_tree.get<std::uint8_t>("Conversation.NumberOfConversation");
+  // get the optional number of io threads
+  config.io_thread_count = config_tree.get<std::size_t>("IoThreadCount", 0u);
+  // get the optional tcp liveness timeout
+  config.liveness_timeout = config_tree.get<std::uint32_t>("LivenessTimeout", 0u);
+  // get the optional runtime log level
+  config.log_level = ToLogLevel(config_tree.get<std::string>("LogLevel", "Verbose"));
+  // get the optional log file, empty selects the default output
+  config.log_file = config_tree.get<std::string>("LogFile", "");
   // loop through all the conversation
   for (boost_support::parser::boost_tree::value_type &conversation_ptr:
        config_tree.get_child("Conversation.ConversationProperty")) {
@@ -27,7 +71,7 @@ diag::client::config_parser::DcmClientConfig ReadDcmClientConfig(
     conversation.conversation_name = conversation_ptr.second.get<std::string>("ConversationName");
     conversation.p2_client_max = conversation_ptr.second.get<std::uint16_t>("P2ClientMax");
     conversation.p2_star_client_max = conversation_ptr.second.get<std::uint16_t>("P2StarClientMax");
-    conversation.rx_buffer_size = conversation_ptr.second.get<std::uint16_t>("RxBufferSize");
+    conversation.rx_buffer_size = conversation_ptr.second.get<std::uint32_t>("RxBufferSize");
     conversation.source_address = conversation_ptr.second.get<std::uint16_t>("SourceAddress");
     conversation.network.tcp_ip_address =
         conversation_ptr.second.get<std::string>("Network.TcpIpAddress");
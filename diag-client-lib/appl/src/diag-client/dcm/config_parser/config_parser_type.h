@@ -9,8 +9,10 @@
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONFIG_PARSER_CONFIG_PARSER_TYPE_H
 /* includes */
 #include <string>
+#include <vector>
 
 #include "boost-support/parser/json_parser.h"
+#include "utility/logger.h"
 
 namespace diag {
 namespace client {
@@ -24,6 +26,14 @@ struct DoipNetworkType {
   bool tls_handling;
 };
 
+// Vehicle discovery endpoint type
+struct DiscoveryEndpointType {
+  // local udp address
+  std::string udp_ip_address;
+  // broadcast address
+  std::string udp_broadcast_address;
+};
+
 // Properties of a single conversation
 struct ConversationType {
   // store p2 client timeout
@@ -31,7 +41,7 @@ struct ConversationType {
   // store p2 star client timeout
   std::uint16_t p2_star_client_max;
   // store receive buffer size
-  std::uint16_t rx_buffer_size;
+  std::uint32_t rx_buffer_size;
   // store source address of client
   std::uint16_t source_address;
   // store the client conversation name
@@ -42,14 +52,20 @@ struct ConversationType {
 
 // Properties of diag client configuration
 struct DcmClientConfig {
-  // local udp address
-  std::string udp_ip_address;
-  // broadcast address
-  std::string udp_broadcast_address;
+  // vehicle discovery endpoints probed in parallel, the first one is always configured
+  std::vector<DiscoveryEndpointType> discovery_endpoints;
   // number of conversation
   std::uint8_t num_of_conversation;
   // store all conversations
   std::vector<ConversationType> conversations;
+  // number of threads serving the network io, zero selects the number of hardware threads
+  std::size_t io_thread_count;
+  // milliseconds without answer after which a tcp connection is lost, zero keeps os defaults
+  std::uint32_t liveness_timeout;
+  // most verbose log level logged at runtime
+  utility::logger::LogLevel log_level;
+  // path of the file the log messages are written to, empty selects console or dlt
+  std::string log_file;
 };
 
 /**
@@ -43,6 +43,26 @@ class Conversation {
    */
   using DiagError = DiagClientConversation::DiagError;
 
+  /**
+   * @brief         Type alias for Download errors
+   */
+  using DownloadError = DiagClientConversation::DownloadError;
+
+  /**
+   * @brief         Type alias for Diagnostic response result
+   */
+  using DiagResult = DiagClientConversation::DiagResult;
+
+  /**
+   * @brief         Type alias for asynchronous Diagnostic response handler
+   */
+  using DiagResponseHandler = DiagClientConversation::DiagResponseHandler;
+
+  /**
+   * @brief         Type alias for Diagnostic response sink
+   */
+  using DiagResponseSink = DiagClientConversation::DiagResponseSink;
+
   /**
    * @brief  Definitions of current activity status
    */
@@ -160,6 +180,11 @@ class Conversation {
    */
   virtual void HandleMessage(::uds_transport::UdsMessagePtr message) noexcept = 0;
 
+  /**
+   * @brief       Function to indicate the loss of connection to the diagnostic server
+   */
+  virtual void HandleConnectionLoss() noexcept {}
+
   /**
    * @brief       Function to send Diagnostic Request and get Diagnostic Response
    * @param[in]   message
@@ -175,20 +200,93 @@ class Conversation {
         DiagError::kDiagRequestSendFailed);
   }
 
+  /**
+   * @brief       Function to send Diagnostic Request without blocking the caller
+   * @param[in]   message
+   *              The diagnostic request message wrapped in a unique pointer
+   * @param[in]   response_handler
+   *              The handler invoked once with Diagnostic Response message received, DiagError in case of error
+   */
+  virtual void SendDiagnosticRequestAsync(uds_message::UdsRequestMessageConstPtr,
+                                          DiagResponseHandler response_handler) noexcept {
+    if (response_handler) {
+      response_handler(DiagResult::FromError(DiagError::kDiagRequestSendFailed));
+    }
+  }
+
+  /**
+   * @brief       Function to send Diagnostic Request and stream the Diagnostic Response to a sink
+   * @param[in]   message
+   *              The diagnostic request message wrapped in a unique pointer
+   * @param[in]   response_sink
+   *              The sink receiving the chunks of the diagnostic response
+   * @return      Empty result on success, DiagError in case of error
+   */
+  virtual Result<void, DiagError> SendDiagnosticRequest(uds_message::UdsRequestMessageConstPtr,
+                                                        DiagResponseSink) noexcept {
+    return Result<void, DiagError>::FromError(DiagError::kDiagRequestSendFailed);
+  }
+
+  /**
+   * @brief       Function to download an image into the memory of the Diagnostic Server
+   * @param[in]   download_request
+   *              The download parameters
+   * @return      The download result on success, DownloadError in case of error
+   */
+  virtual Result<flash::DownloadResponseType, DownloadError> SendDownloadRequest(
+      flash::DownloadRequestType const &) noexcept {
+    return Result<flash::DownloadResponseType, DownloadError>::FromError(
+        DownloadError::kRequestDownloadFailed);
+  }
+
   /**
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
    * @param[in]   vehicle_info_request
    *              Vehicle information sent along with request
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
+   */
+  virtual core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                            DiagClient::VehicleInfoResponseError>
+  SendVehicleIdentificationRequest(vehicle_info::VehicleInfoListRequestType,
+                                   vehicle_info::VehicleInfoResponseHandler) noexcept {
+    return core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                             DiagClient::VehicleInfoResponseError>::
+        FromError(DiagClient::VehicleInfoResponseError::kTransmitFailed);
+  }
+
+  /**
+   * @brief       Function to send a unicast vehicle identification request to every target
+   * @param[in]   sweep_request
+   *              The target addresses or IPv4 networks along with rate, window and timeout
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
    * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
    */
   virtual core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                             DiagClient::VehicleInfoResponseError>
-  SendVehicleIdentificationRequest(vehicle_info::VehicleInfoListRequestType) noexcept {
+  SendVehicleIdentificationSweep(vehicle_info::VehicleInfoSweepRequestType,
+                                 vehicle_info::VehicleInfoResponseHandler) noexcept {
     return core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                              DiagClient::VehicleInfoResponseError>::
         FromError(DiagClient::VehicleInfoResponseError::kTransmitFailed);
   }
 
+  /**
+   * @brief       Function to get the known DoIP entities matching the filter
+   * @return      The matching DoIP entities
+   */
+  virtual vehicle_info::VehicleEntityListType GetVehicleEntities(
+      vehicle_info::VehicleEntityFilter const &) const noexcept {
+    return vehicle_info::VehicleEntityListType{};
+  }
+
+  /**
+   * @brief       Function to set the handler notified when a known DoIP entity is added or changed
+   */
+  virtual void SetVehicleEntityChangeHandler(vehicle_info::VehicleEntityChangeHandler) noexcept {}
+
   /**
    * @brief       Get the current activity status of this conversation
    * @return      The activity status
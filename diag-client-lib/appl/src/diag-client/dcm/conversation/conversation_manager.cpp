@@ -68,29 +68,27 @@ diag::client::conversation::Conversation &ConversationManager::GetDiagnosticClie
         std::visit(core_type::visit::overloaded{
                        [this, &conversation_name_in_map](
                            conversation::DMConversationType conversation_type) noexcept {
-                         // Create the conversation
-                         std::unique_ptr<diag::client::conversation::Conversation> conversation{
-                             std::make_unique<diag::client::conversation::DmConversation>(
-                                 conversation_name_in_map, conversation_type)};
-                         // Register the connection
-                         conversation->RegisterConnection(
-                             uds_transport_mgr_.GetTransportProtocolHandler().CreateTcpConnection(
-                                 conversation->GetConversationHandler(),
-                                 conversation_type.tcp_address, conversation_type.port_num));
-                         return conversation;
+                         return std::unique_ptr<diag::client::conversation::Conversation>{
+                             CreateDmConversation(conversation_name_in_map, conversation_type)};
                        },
                        [this, &conversation_name_in_map](
                            conversation::VDConversationType conversation_type) noexcept {
                          // Create the conversation
-                         std::unique_ptr<diag::client::conversation::Conversation> conversation{
+                         std::unique_ptr<diag::client::conversation::VdConversation> conversation{
                              std::make_unique<diag::client::conversation::VdConversation>(
                                  conversation_name_in_map, conversation_type)};
-                         // Register the connection
-                         conversation->RegisterConnection(
-                             uds_transport_mgr_.GetTransportProtocolHandler().CreateUdpConnection(
-                                 conversation->GetConversationHandler(),
-                                 conversation_type.udp_address, conversation_type.port_num));
-                         return conversation;
+                         // Register one connection per endpoint
+                         for (std::size_t endpoint_index{0U};
+                              endpoint_index < conversation_type.endpoints.size(); endpoint_index++) {
+                           conversation->RegisterConnection(
+                               endpoint_index,
+                               uds_transport_mgr_.GetTransportProtocolHandler().CreateUdpConnection(
+                                   conversation->GetConversationHandler(endpoint_index),
+                                   conversation_type.endpoints[endpoint_index].udp_address,
+                                   conversation_type.port_num));
+                         }
+                         return std::unique_ptr<diag::client::conversation::Conversation>{
+                             std::move(conversation)};
                        }},
                    it->second.conversation_type);
   } else {
@@ -103,12 +101,48 @@ diag::client::conversation::Conversation &ConversationManager::GetDiagnosticClie
   return *(it->second.conversation);
 }
 
+std::unique_ptr<diag::client::conversation::DmConversation>
+ConversationManager::CreateDmConversation(std::string_view conversation_name) noexcept {
+  std::unique_ptr<diag::client::conversation::DmConversation> conversation{};
+  auto it = conversation_map_.find(std::string{conversation_name});
+  if ((it != conversation_map_.end()) &&
+      std::holds_alternative<conversation::DMConversationType>(it->second.conversation_type)) {
+    conversation = CreateDmConversation(
+        it->first, std::get<conversation::DMConversationType>(it->second.conversation_type));
+  } else {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [conversation_name](std::stringstream &msg) {
+          msg << "Invalid conversation name: '" << conversation_name
+              << "', provide correct name as per config file";
+        });
+  }
+  return conversation;
+}
+
+std::unique_ptr<diag::client::conversation::DmConversation>
+ConversationManager::CreateDmConversation(
+    std::string const &conversation_name,
+    conversation::DMConversationType conversation_type) noexcept {
+  // Create the conversation
+  std::unique_ptr<diag::client::conversation::DmConversation> conversation{
+      std::make_unique<diag::client::conversation::DmConversation>(conversation_name,
+                                                                   conversation_type)};
+  // Register the connection
+  conversation->RegisterConnection(
+      uds_transport_mgr_.GetTransportProtocolHandler().CreateTcpConnection(
+          conversation->GetConversationHandler(), conversation_type.tcp_address,
+          conversation_type.port_num));
+  return conversation;
+}
+
 void ConversationManager::StoreConversationConfig(
     diag::client::config_parser::DcmClientConfig &config) noexcept {
   {  // Create Vehicle discovery config
     conversation::VDConversationType conversion_identifier{};
-    conversion_identifier.udp_address = config.udp_ip_address;
-    conversion_identifier.udp_broadcast_address = config.udp_broadcast_address;
+    for (diag::client::config_parser::DiscoveryEndpointType const &endpoint: config.discovery_endpoints) {
+      conversion_identifier.endpoints.emplace_back(
+          conversation::VDEndpointType{endpoint.udp_ip_address, endpoint.udp_broadcast_address});
+    }
     conversion_identifier.port_num = kRandomPortNumber;  // random selection of port number
     conversation_map_.emplace(kVdConversationName,
                               ConversationStorage{conversion_identifier, nullptr});
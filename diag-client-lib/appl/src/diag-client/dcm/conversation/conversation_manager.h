@@ -15,6 +15,7 @@
 #include "diag-client/dcm/config_parser/config_parser_type.h"
 #include "diag-client/dcm/connection/uds_transport_protocol_manager.h"
 #include "diag-client/dcm/conversation/conversation.h"
+#include "diag-client/dcm/conversation/dm_conversation.h"
 #include "diag-client/dcm/conversation/dm_conversation_type.h"
 #include "diag-client/dcm/conversation/vd_conversation.h"
 #include "diag-client/dcm/conversation/vd_conversation_type.h"
@@ -63,6 +64,16 @@ class ConversationManager final {
   diag::client::conversation::Conversation &GetDiagnosticClientConversation(
       std::string_view conversation_name) noexcept;
 
+  /**
+   * @brief       Function to create a DM conversation owned by the caller
+   * @details     The conversation is not stored, it is independent of conversations handed out by name
+   * @param[in]   conversation_name
+   *              The conversation name
+   * @return      The dm conversation, nullptr if no dm conversation is configured with the name
+   */
+  std::unique_ptr<diag::client::conversation::DmConversation> CreateDmConversation(
+      std::string_view conversation_name) noexcept;
+
  private:
   /**
    * @brief      Store Dm conversation
@@ -97,6 +108,18 @@ class ConversationManager final {
    *              The Dcm client configuration
    */
   void StoreConversationConfig(diag::client::config_parser::DcmClientConfig &config) noexcept;
+
+  /**
+   * @brief       Function to create a dm conversation along with its tcp connection
+   * @param[in]   conversation_name
+   *              The conversation name
+   * @param[in]   conversation_type
+   *              The dm conversation settings
+   * @return      The dm conversation created
+   */
+  std::unique_ptr<diag::client::conversation::DmConversation> CreateDmConversation(
+      std::string const &conversation_name,
+      conversation::DMConversationType conversation_type) noexcept;
 };
 }  // namespace conversation_manager
 }  // namespace client
@@ -8,13 +8,44 @@
 
 #include "diag-client/dcm/conversation/dm_conversation.h"
 
+#include <algorithm>
+
 #include "diag-client/common/logger.h"
+#include "diag-client/dcm/flash/flash_engine.h"
 #include "diag-client/dcm/service/dm_uds_message.h"
 #include "uds_transport/conversation_handler.h"
+#include "utility/timer_service.h"
 
 namespace diag {
 namespace client {
 namespace conversation {
+namespace {
+
+/**
+ * @brief  Positive response SID of DiagnosticSessionControl
+ */
+constexpr std::uint8_t kDiagnosticSessionControlResponse{0x50U};
+
+/**
+ * @brief  Positive response SID of ECUReset
+ */
+constexpr std::uint8_t kEcuResetResponse{0x51U};
+
+/**
+ * @brief  Positive response SID of SecurityAccess
+ */
+constexpr std::uint8_t kSecurityAccessResponse{0x67U};
+
+/**
+ * @brief  Function to get the executor invoking the handlers of asynchronous requests of all conversations
+ * @return The reference to executor
+ */
+auto GetResponseHandlerExecutor() noexcept -> DmConversation::ResponseHandlerExecutor & {
+  static DmConversation::ResponseHandlerExecutor response_handler_executor{};
+  return response_handler_executor;
+}
+
+}  // namespace
 
 /**
  * @brief    Class to manage reception from transport protocol handler to dm connection handler
@@ -97,6 +128,34 @@ class DmConversationHandler final : public ::uds_transport::ConversionHandler {
     dm_conversation_.HandleMessage(std::move(message));
   }
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the received bytes, valid only within this function call
+   */
+  void HandleMessageChunk(::uds_transport::UdsMessage::Address source_addr,
+                          ::uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk) const noexcept override {
+    dm_conversation_.HandleMessageChunk(source_addr, target_addr, chunk);
+  }
+
+  /**
+   * @brief       Function to indicate the loss of connection to the diagnostic server
+   */
+  void HandleConnectionLoss() const noexcept override { dm_conversation_.HandleConnectionLoss(); }
+
+  /**
+   * @brief       Function to get the size of the largest response the conversation accepts
+   * @return      The configured reception buffer size
+   */
+  std::size_t GetRxBufferSize() const noexcept override {
+    return dm_conversation_.GetRxBufferSize();
+  }
+
  private:
   /**
    * @brief         Store the reference of dm conversation
@@ -116,9 +175,31 @@ DmConversation::DmConversation(std::string_view conversion_name,
       target_address_{},
       conversation_name_{conversion_name},
       dm_conversion_handler_{
-          std::make_unique<DmConversationHandler>(conversion_identifier.handler_id, *this)} {}
+          std::make_unique<DmConversationHandler>(conversion_identifier.handler_id, *this)},
+      received_response_{},
+      response_sink_{},
+      streamed_response_size_{0u},
+      streamed_size_{0u},
+      is_sink_running_{false},
+      connection_lost_{false},
+      conversation_state_{ConversationState::kIdle},
+      async_response_handler_{},
+      async_request_sequence_{0U},
+      async_timer_id_{utility::timer::TimerService::kInvalidTimerId},
+      is_transmission_pending_{false},
+      queued_handler_count_{0U} {}
 
-DmConversation::~DmConversation() = default;
+DmConversation::~DmConversation() {
+  std::unique_lock<std::mutex> lck{response_event_lock_};
+  // the handler of an outstanding asynchronous request is still invoked exactly once
+  if (async_response_handler_) {
+    CompleteAsyncRequest(lck, DiagResult::FromError(DiagError::kDiagConnectionLost));
+    lck.lock();
+  }
+  // the transport layer and the shared executor may still call into the conversation
+  response_event_cond_var_.wait(
+      lck, [this]() { return !is_transmission_pending_ && (queued_handler_count_ == 0U); });
+}
 
 void DmConversation::Startup() noexcept {
   // initialize the connection
@@ -159,9 +240,12 @@ DiagClientConversation::ConnectResult DmConversation::ConnectToDiagServer(
   DiagClientConversation::ConnectResult const connection_result{
       static_cast<DiagClientConversation::ConnectResult>(
           connection_->ConnectToHost(std::make_unique<diag::client::uds_message::DmUdsMessage>(
-              source_address_, target_address, host_ip_addr, payload)))};
+              source_address_, target_address, host_ip_addr, std::move(payload))))};
   remote_address_ = host_ip_addr;
   target_address_ = target_address;
+  // a newly connected server is assumed in default session until confirmed otherwise
+  active_session_ = SessionControlType::kDefaultSession;
+  active_security_level_ = SecurityLevelType::kLocked;
   if (connection_result == DiagClientConversation::ConnectResult::kConnectSuccess) {
     logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
         FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
@@ -218,121 +302,331 @@ DmConversation::SendDiagnosticRequest(uds_message::UdsRequestMessageConstPtr mes
       Result<uds_message::UdsResponseMessagePtr, DiagClientConversation::DiagError>::FromError(
           DiagClientConversation::DiagError::kDiagRequestSendFailed)};
   if (message) {
-    // fill the data
-    uds_transport::ByteVector payload{message->GetPayload()};
-    // Initiate Sending of diagnostic request
-    uds_transport::UdsTransportProtocolMgr::TransmissionResult const transmission_result{
-        connection_->Transmit(std::make_unique<diag::client::uds_message::DmUdsMessage>(
-            source_address_, target_address_, message->GetHostIpAddress(), payload))};
-    if (transmission_result ==
-        uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
-      // Diagnostic Request Sent successful
+    result = SendDiagnosticPayload(message->GetPayload());
+  } else {
+    result.EmplaceError(DiagClientConversation::DiagError::kDiagInvalidParameter);
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request message is empty";
+        });
+  }
+  return result;
+}
+
+auto DmConversation::SendDiagnosticPayload(uds_transport::ByteVector payload) noexcept
+    -> DiagResult {
+  return SendDiagnosticPayload(std::move(payload), DiagResponseSink{});
+}
+
+auto DmConversation::SendDiagnosticPayload(uds_transport::ByteVector payload,
+                                           DiagResponseSink response_sink) noexcept -> DiagResult {
+  DiagResult result{DiagResult::FromError(DiagError::kDiagRequestSendFailed)};
+  // Arm the response reception before transmission, as response may arrive before Transmit returns
+  bool is_request_started{false};
+  {
+    std::lock_guard<std::mutex> const lck{response_event_lock_};
+    // only one request can be outstanding on the conversation
+    is_request_started =
+        conversation_state_.TransitionTo(ConversationState::kIdle, ConversationState::kDiagWaitForRes);
+    if (is_request_started) {
+      connection_lost_ = false;
+      response_sink_ = std::move(response_sink);
+    }
+  }
+  if (!is_request_started) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request rejected, previous request still in progress";
+        });
+    result.EmplaceError(DiagError::kDiagBusyProcessing);
+    return result;
+  }
+  // Initiate Sending of diagnostic request
+  uds_transport::UdsTransportProtocolMgr::TransmissionResult const transmission_result{
+      connection_->Transmit(std::make_unique<diag::client::uds_message::DmUdsMessage>(
+          source_address_, target_address_, remote_address_, std::move(payload)))};
+  if (transmission_result ==
+      uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
+    // Diagnostic Request Sent successful
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request Sent & Positive Ack received";
+        });
+    // Wait until final response or timeout
+    result = WaitForResponse();
+    if (result.HasValue()) {
+      TrackSessionAndSecurity(core_type::Span<std::uint8_t const>{result.Value()->GetPayload()});
+    }
+  } else {
+    // failure, the connection may be lost before the transmission is confirmed
+    bool is_connection_lost{false};
+    {
+      std::unique_lock<std::mutex> lck{response_event_lock_};
+      is_connection_lost = connection_lost_;
+      response_event_cond_var_.wait(lck, [this]() { return !is_sink_running_; });
+      response_sink_ = nullptr;
+      static_cast<void>(conversation_state_.TransitionTo(ConversationState::kIdle));
+    }
+    result.EmplaceError(is_connection_lost ? DiagError::kDiagConnectionLost
+                                           : ConvertResponseType(transmission_result));
+  }
+  return result;
+}
+
+Result<void, DiagClientConversation::DiagError> DmConversation::SendDiagnosticRequest(
+    uds_message::UdsRequestMessageConstPtr message, DiagResponseSink response_sink) noexcept {
+  if (!response_sink) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Response sink is empty";
+        });
+    return Result<void, DiagError>::FromError(DiagError::kDiagInvalidParameter);
+  }
+  if (!message) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request message is empty";
+        });
+    return Result<void, DiagError>::FromError(DiagError::kDiagInvalidParameter);
+  }
+  DiagResult const diag_result{SendDiagnosticPayload(message->GetPayload(), std::move(response_sink))};
+  return diag_result.HasValue() ? Result<void, DiagError>::FromValue()
+                                : Result<void, DiagError>::FromError(diag_result.Error());
+}
+
+Result<flash::DownloadResponseType, DiagClientConversation::DownloadError>
+DmConversation::SendDownloadRequest(flash::DownloadRequestType const &download_request) noexcept {
+  // frames the next block on its own executor while the current one is transferred
+  flash::FlashEngine flash_engine{*this};
+  return flash_engine.Download(download_request, flash::FlashEngine::BlockHandler{});
+}
+
+void DmConversation::SendDiagnosticRequestAsync(uds_message::UdsRequestMessageConstPtr message,
+                                                DiagResponseHandler response_handler) noexcept {
+  if (!response_handler) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request handler is empty";
+        });
+  } else if (!message) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Request message is empty";
+        });
+    response_handler(DiagResult::FromError(DiagError::kDiagInvalidParameter));
+  } else {
+    bool is_request_started{false};
+    std::uint32_t request_sequence{0U};
+    {
+      std::lock_guard<std::mutex> const lck{response_event_lock_};
+      // only one request can be outstanding on the conversation
+      is_request_started =
+          conversation_state_.TransitionTo(ConversationState::kIdle, ConversationState::kDiagWaitForRes);
+      if (is_request_started) {
+        connection_lost_ = false;
+        async_response_handler_ = std::move(response_handler);
+        request_sequence = ++async_request_sequence_;
+        is_transmission_pending_ = true;
+      }
+    }
+    if (!is_request_started) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+          FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+            msg << "'" << conversation_name_ << "'"
+                << "-> "
+                << "Diagnostic Request rejected, previous request still in progress";
+          });
+      response_handler(DiagResult::FromError(DiagError::kDiagBusyProcessing));
+      return;
+    }
+    // Initiate Sending of diagnostic request, the acknowledgement is awaited by the transport layer
+    connection_->TransmitAsync(
+        std::make_unique<diag::client::uds_message::DmUdsMessage>(
+            source_address_, target_address_, remote_address_, message->GetPayload()),
+        [this, request_sequence](
+            uds_transport::UdsTransportProtocolMgr::TransmissionResult transmission_result) {
+          HandleAsyncTransmissionResult(request_sequence, transmission_result);
+        });
+  }
+}
+
+void DmConversation::HandleAsyncTransmissionResult(
+    std::uint32_t request_sequence,
+    uds_transport::UdsTransportProtocolMgr::TransmissionResult transmission_result) noexcept {
+  utility::timer::TimerService::TimerId stale_timer_id{utility::timer::TimerService::kInvalidTimerId};
+  std::unique_lock<std::mutex> lck{response_event_lock_};
+  is_transmission_pending_ = false;
+  // notified with the lock held, as the waiting destructor may release the conversation right after
+  response_event_cond_var_.notify_all();
+  // a connection loss may have been handled before the transmission result
+  if (async_request_sequence_ == request_sequence) {
+    if (transmission_result == uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
       logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
           FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
             msg << "'" << conversation_name_ << "'"
                 << "-> "
                 << "Diagnostic Request Sent & Positive Ack received";
           });
-      conversation_state_.GetConversationStateContext().TransitionTo(
-          ConversationState::kDiagWaitForRes);
-      // Wait P6Max / P2ClientMax
-      sync_timer_.WaitForTimeout(
-          [this, &result]() {
-            result.EmplaceError(DiagClientConversation::DiagError::kDiagResponseTimeout);
-            conversation_state_.GetConversationStateContext().TransitionTo(
-                ConversationState::kIdle);
-            logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-                FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
-                  msg << "'" << conversation_name_ << "'"
-                      << "-> "
-                      << "Diagnostic Response P2 Timeout happened after " << p2_client_max_
-                      << " milliseconds";
-                });
-          },
-          [this]() {
-            // pending or pos/neg response
-            if (conversation_state_.GetConversationStateContext().GetActiveState().GetState() ==
-                ConversationState::kDiagRecvdFinalRes) {
-              // pos/neg response received
-            } else if (conversation_state_.GetConversationStateContext()
-                           .GetActiveState()
-                           .GetState() == ConversationState::kDiagRecvdPendingRes) {
-              // first pending received
-              conversation_state_.GetConversationStateContext().TransitionTo(
-                  ConversationState::kDiagStartP2StarTimer);
-            }
-          },
-          std::chrono::milliseconds{p2_client_max_});
-
-      // Wait until final response or timeout
-      while (conversation_state_.GetConversationStateContext().GetActiveState().GetState() !=
-             ConversationState::kIdle) {
-        // Check the active state
-        switch (conversation_state_.GetConversationStateContext().GetActiveState().GetState()) {
-          case ConversationState::kDiagRecvdPendingRes:
-            conversation_state_.GetConversationStateContext().TransitionTo(
-                ConversationState::kDiagStartP2StarTimer);
-            break;
-          case ConversationState::kDiagRecvdFinalRes:
-            // do nothing
-            break;
-          case ConversationState::kDiagStartP2StarTimer:
-            // wait P6Star/ P2 star client time
-            sync_timer_.WaitForTimeout(
-                [this, &result]() {
-                  logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-                      FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
-                        msg << "'" << conversation_name_ << "'"
-                            << "-> "
-                            << "Diagnostic Response P2 Star Timeout "
-                               "happened after "
-                            << p2_star_client_max_ << " milliseconds";
-                      });
-                  result.EmplaceError(DiagClientConversation::DiagError::kDiagResponseTimeout);
-                  conversation_state_.GetConversationStateContext().TransitionTo(
-                      ConversationState::kIdle);
-                },
-                [this]() {
-                  // pending or pos/neg response
-                  if (conversation_state_.GetConversationStateContext()
-                          .GetActiveState()
-                          .GetState() == ConversationState::kDiagRecvdFinalRes) {
-                    // pos/neg response received
-                  } else if (conversation_state_.GetConversationStateContext()
-                                 .GetActiveState()
-                                 .GetState() == ConversationState::kDiagRecvdPendingRes) {
-                    // pending received again
-                    conversation_state_.GetConversationStateContext().TransitionTo(
-                        ConversationState::kDiagStartP2StarTimer);
-                  }
-                },
-                std::chrono::milliseconds{p2_star_client_max_});
-            break;
-          case ConversationState::kDiagSuccess:
-            // change state to idle, form the uds response and return
-            result.EmplaceValue(
-                std::make_unique<diag::client::uds_message::DmUdsResponse>(payload_rx_buffer_));
-            conversation_state_.GetConversationStateContext().TransitionTo(
-                ConversationState::kIdle);
-            break;
-          default:
-            // nothing
-            break;
-        }
+      // Wait P6Max / P2ClientMax first, restarted with P6Star / P2StarClientMax on every pending response
+      stale_timer_id = RestartAsyncResponseTimer(std::chrono::milliseconds{p2_client_max_});
+    } else {
+      CompleteAsyncRequest(lck, DiagResult::FromError(ConvertResponseType(transmission_result)));
+    }
+  }
+  if (lck.owns_lock()) { lck.unlock(); }
+  static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(stale_timer_id));
+}
+
+auto DmConversation::RestartAsyncResponseTimer(std::chrono::milliseconds timeout) noexcept
+    -> utility::timer::TimerService::TimerId {
+  utility::timer::TimerService::TimerId const stale_timer_id{async_timer_id_};
+  std::uint32_t const request_sequence{++async_request_sequence_};
+  async_timer_id_ = utility::timer::TimerService::GetTimerService().Arm(
+      timeout, [this, request_sequence]() { HandleAsyncResponseTimeout(request_sequence); });
+  return stale_timer_id;
+}
+
+void DmConversation::HandleAsyncResponseTimeout(std::uint32_t request_sequence) noexcept {
+  std::unique_lock<std::mutex> lck{response_event_lock_};
+  // the timer is stale if restarted or the request completed meanwhile
+  if (async_response_handler_ && (async_request_sequence_ == request_sequence)) {
+    if (conversation_state_.GetState() == ConversationState::kDiagRecvdFinalRes) {
+      // final response already indicated, it is handed over right after by the same reader context,
+      // the expired timer needs no cancellation
+      static_cast<void>(RestartAsyncResponseTimer(std::chrono::milliseconds{p2_client_max_}));
+    } else {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+          FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+            msg << "'" << conversation_name_ << "'"
+                << "-> "
+                << "Diagnostic Response P2 Timeout happened";
+          });
+      CompleteAsyncRequest(lck, DiagResult::FromError(DiagError::kDiagResponseTimeout));
+    }
+  }
+}
+
+void DmConversation::CompleteAsyncRequest(std::unique_lock<std::mutex> &lck,
+                                          DiagResult result) noexcept {
+  // std::function requires copyable callable, share the result with the executor job
+  std::shared_ptr<DiagResult> shared_result{std::make_shared<DiagResult>(std::move(result))};
+  DiagResponseHandler response_handler{std::move(async_response_handler_)};
+  async_response_handler_ = nullptr;
+  ++async_request_sequence_;
+  utility::timer::TimerService::TimerId const timer_id{async_timer_id_};
+  async_timer_id_ = utility::timer::TimerService::kInvalidTimerId;
+  static_cast<void>(conversation_state_.TransitionTo(ConversationState::kIdle));
+  ++queued_handler_count_;
+  lck.unlock();
+  // the timer callback takes the response lock so cancel without holding it
+  static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(timer_id));
+  // the handler is invoked outside the reception and timer context, so it may block or send the next request
+  GetResponseHandlerExecutor().AddExecute(
+      [this, response_handler = std::move(response_handler), shared_result]() {
+        response_handler(std::move(*shared_result));
+        std::lock_guard<std::mutex> const handler_lck{response_event_lock_};
+        --queued_handler_count_;
+        // notified with the lock held, as the waiting destructor may release the conversation right after
+        response_event_cond_var_.notify_all();
+      });
+}
+
+auto DmConversation::WaitForResponse() noexcept -> DiagResult {
+  DiagResult result{DiagResult::FromError(DiagError::kDiagResponseTimeout)};
+  utility::timer::TimerService &timer_service{utility::timer::TimerService::GetTimerService()};
+  // set by the timer service on expiry of the running P2 / P2Star timer
+  bool response_timeout{false};
+  auto const arm_response_timer{[this, &timer_service, &response_timeout](
+                                    std::chrono::milliseconds timeout) {
+    return timer_service.Arm(timeout, [this, &response_timeout]() {
+      {
+        std::lock_guard<std::mutex> const lck{response_event_lock_};
+        response_timeout = true;
       }
+      response_event_cond_var_.notify_all();
+    });
+  }};
+  std::unique_lock<std::mutex> lck{response_event_lock_};
+  auto const is_response_event_received{[this]() {
+    ConversationState const state{conversation_state_.GetState()};
+    return (state == ConversationState::kDiagRecvdPendingRes) ||
+           (state == ConversationState::kDiagSuccess);
+  }};
+  // Wait P6Max / P2ClientMax first, restarted with P6Star / P2StarClientMax on every pending response
+  std::chrono::milliseconds response_timeout_value{p2_client_max_};
+  utility::timer::TimerService::TimerId timer_id{arm_response_timer(response_timeout_value)};
+  // restart the timer, the timer callback takes the response lock so cancel without holding it
+  auto const restart_response_timer{[&](std::chrono::milliseconds timeout) {
+    lck.unlock();
+    static_cast<void>(timer_service.Cancel(timer_id));
+    lck.lock();
+    response_timeout = false;
+    response_timeout_value = timeout;
+    timer_id = arm_response_timer(timeout);
+  }};
+  bool wait_for_response{true};
+  while (wait_for_response) {
+    response_event_cond_var_.wait(lck, [this, &is_response_event_received, &response_timeout]() {
+      return response_timeout || connection_lost_ || is_response_event_received();
+    });
+    if (connection_lost_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
+            msg << "'" << conversation_name_ << "'"
+                << "-> "
+                << "Diagnostic Response not received, connection to server lost";
+          });
+      result.EmplaceError(DiagError::kDiagConnectionLost);
+      wait_for_response = false;
+    } else if (is_response_event_received()) {
+      if (conversation_state_.GetState() == ConversationState::kDiagRecvdPendingRes) {
+        static_cast<void>(
+            conversation_state_.TransitionTo(ConversationState::kDiagStartP2StarTimer));
+        restart_response_timer(std::chrono::milliseconds{p2_star_client_max_});
+      } else {
+        // change state to idle, move the received payload into uds response and return,
+        // a response streamed to the sink leaves nothing to hand over
+        result.EmplaceValue(std::make_unique<diag::client::uds_message::DmUdsResponse>(
+            received_response_ != nullptr ? std::move(received_response_->GetPayload())
+                                          : uds_transport::ByteVector{}));
+        received_response_.reset();
+        wait_for_response = false;
+      }
+    } else if (conversation_state_.GetState() == ConversationState::kDiagRecvdFinalRes) {
+      // final response already indicated, it is handed over right after by the same reader context
+      restart_response_timer(std::chrono::milliseconds{p2_client_max_});
     } else {
-      // failure
-      result.EmplaceError(ConvertResponseType(transmission_result));
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+          FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
+            msg << "'" << conversation_name_ << "'"
+                << "-> "
+                << "Diagnostic Response P2 Timeout happened after "
+                << response_timeout_value.count() << " milliseconds";
+          });
+      wait_for_response = false;
     }
-  } else {
-    result.EmplaceError(DiagClientConversation::DiagError::kDiagInvalidParameter);
-    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
-        FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
-          msg << "'" << conversation_name_ << "'"
-              << "-> "
-              << "Diagnostic Request message is empty";
-        });
   }
+  // late chunks after timeout are dropped as the conversation is idle again, a chunk being streamed
+  // must complete before the sink is released
+  response_event_cond_var_.wait(lck, [this]() { return !is_sink_running_; });
+  response_sink_ = nullptr;
+  static_cast<void>(conversation_state_.TransitionTo(ConversationState::kIdle));
+  lck.unlock();
+  static_cast<void>(timer_service.Cancel(timer_id));
   return result;
 }
 
@@ -354,8 +648,17 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address,
                                 core_type::Span<std::uint8_t const> payload_info) noexcept {
   std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
       ret_val{uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationNOk, nullptr};
+  utility::timer::TimerService::TimerId stale_timer_id{utility::timer::TimerService::kInvalidTimerId};
+  std::unique_lock<std::mutex> lck{response_event_lock_};
   // Verify the payload received :-
-  if (!payload_info.empty()) {
+  if (conversation_state_.GetState() == ConversationState::kIdle) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
+        FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic response ignored, no request outstanding";
+        });
+  } else if (!payload_info.empty()) {
     // Check for size, else kIndicationOverflow
     if (size <= rx_buffer_size_) {
       // Check for pending response
@@ -369,8 +672,14 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address,
             });
         ret_val.first =
             uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationPending;
-        conversation_state_.GetConversationStateContext().TransitionTo(
-            ConversationState::kDiagRecvdPendingRes);
+        static_cast<void>(
+            conversation_state_.TransitionTo(ConversationState::kDiagRecvdPendingRes));
+        if (async_response_handler_) {
+          // no requester waits for an asynchronous request, restart the timer with P2StarClientMax here
+          static_cast<void>(
+              conversation_state_.TransitionTo(ConversationState::kDiagStartP2StarTimer));
+          stale_timer_id = RestartAsyncResponseTimer(std::chrono::milliseconds{p2_star_client_max_});
+        }
       } else {
         logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogDebug(
             FILE_NAME, __LINE__, "", [this](std::stringstream &msg) {
@@ -378,16 +687,24 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address,
                   << "-> "
                   << "Diagnostic final response received in Conversation";
             });
-        // positive or negative response, provide valid buffer
-        // resize the global rx buffer
-        payload_rx_buffer_.resize(size);
-        ret_val.first = uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk;
-        ret_val.second = std::make_unique<diag::client::uds_message::DmUdsMessage>(
-            source_address_, target_address_, "", payload_rx_buffer_);
-        conversation_state_.GetConversationStateContext().TransitionTo(
-            ConversationState::kDiagRecvdFinalRes);
+        if (response_sink_) {
+          // positive or negative response, stream the payload to the sink as it is received
+          ret_val.first =
+              uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationStreamed;
+          streamed_response_size_ = size;
+          streamed_size_ = 0u;
+        } else {
+          // positive or negative response, provide message to take over the received payload
+          ret_val.first = uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk;
+          ret_val.second = std::make_unique<diag::client::uds_message::DmUdsMessage>(
+              source_address_, target_address_, "", uds_transport::ByteVector{});
+        }
+        static_cast<void>(
+            conversation_state_.TransitionTo(ConversationState::kDiagRecvdFinalRes));
       }
-      sync_timer_.CancelWait();
+      lck.unlock();
+      response_event_cond_var_.notify_all();
+      static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(stale_timer_id));
     } else {
       logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
           FILE_NAME, __LINE__, "", [&](std::stringstream &msg) {
@@ -410,7 +727,100 @@ DmConversation::IndicateMessage(uds_transport::UdsMessage::Address,
 
 void DmConversation::HandleMessage(uds_transport::UdsMessagePtr message) noexcept {
   if (message != nullptr) {
-    conversation_state_.GetConversationStateContext().TransitionTo(ConversationState::kDiagSuccess);
+    std::unique_lock<std::mutex> lck{response_event_lock_};
+    // hand over only the final response indicated before, requester may have timed out meanwhile
+    if (conversation_state_.TransitionTo(ConversationState::kDiagRecvdFinalRes,
+                                         ConversationState::kDiagSuccess)) {
+      if (async_response_handler_) {
+        // move the received payload into uds response and complete the asynchronous request
+        DiagResult result{DiagResult::FromValue(
+            std::make_unique<diag::client::uds_message::DmUdsResponse>(std::move(message->GetPayload())))};
+        TrackSessionAndSecurity(core_type::Span<std::uint8_t const>{result.Value()->GetPayload()});
+        CompleteAsyncRequest(lck, std::move(result));
+      } else {
+        received_response_ = std::move(message);
+      }
+    }
+    if (lck.owns_lock()) { lck.unlock(); }
+    response_event_cond_var_.notify_all();
+  }
+}
+
+void DmConversation::HandleMessageChunk(uds_transport::UdsMessage::Address,
+                                        uds_transport::UdsMessage::Address,
+                                        core_type::Span<std::uint8_t const> chunk) noexcept {
+  bool is_chunk_streamed{false};
+  std::size_t streamed_response_size{0u};
+  {
+    std::lock_guard<std::mutex> const lck{response_event_lock_};
+    // hand over only the final response streamed, requester may have timed out meanwhile
+    if (response_sink_ &&
+        conversation_state_.GetState() == ConversationState::kDiagRecvdFinalRes) {
+      is_sink_running_ = true;
+      is_chunk_streamed = true;
+      streamed_response_size = streamed_response_size_;
+    }
+  }
+  if (is_chunk_streamed) {
+    // the sink is called without holding the lock, as it may be slow or use the conversation, the
+    // requester keeps it until the call returns
+    response_sink_(streamed_response_size, chunk);
+    {
+      std::lock_guard<std::mutex> const lck{response_event_lock_};
+      is_sink_running_ = false;
+      streamed_size_ += chunk.size();
+      if (streamed_size_ >= streamed_response_size_) {
+        static_cast<void>(conversation_state_.TransitionTo(ConversationState::kDiagRecvdFinalRes,
+                                                           ConversationState::kDiagSuccess));
+      }
+    }
+    response_event_cond_var_.notify_all();
+  }
+}
+
+void DmConversation::TrackSessionAndSecurity(core_type::Span<std::uint8_t const> response) noexcept {
+  if (response.size() >= 2U) {
+    std::uint8_t const sub_function{static_cast<std::uint8_t>(response[1U] & 0x7FU)};
+    switch (response[0U]) {
+      case kDiagnosticSessionControlResponse:
+        // every session transition locks the server again
+        active_session_ = static_cast<SessionControlType>(sub_function);
+        active_security_level_ = SecurityLevelType::kLocked;
+        break;
+      case kEcuResetResponse:
+        active_session_ = SessionControlType::kDefaultSession;
+        active_security_level_ = SecurityLevelType::kLocked;
+        break;
+      case kSecurityAccessResponse:
+        // sendKey is even, a requestSeed answered with an all zero seed means already unlocked
+        if (((sub_function & 0x01U) == 0U) ||
+            ((response.size() > 2U) &&
+             std::all_of(response.begin() + 2, response.end(),
+                         [](std::uint8_t const byte) { return byte == 0U; }))) {
+          active_security_level_ = SecurityLevelType::kUnlocked;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+void DmConversation::HandleConnectionLoss() noexcept {
+  std::unique_lock<std::mutex> lck{response_event_lock_};
+  // only an outstanding request is affected, the next request fails on transmission
+  if (async_response_handler_) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Diagnostic Response not received, connection to server lost";
+        });
+    CompleteAsyncRequest(lck, DiagResult::FromError(DiagError::kDiagConnectionLost));
+  } else {
+    if (conversation_state_.GetState() != ConversationState::kIdle) { connection_lost_ = true; }
+    lck.unlock();
+    response_event_cond_var_.notify_all();
   }
 }
 
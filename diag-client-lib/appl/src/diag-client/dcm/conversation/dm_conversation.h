@@ -8,6 +8,11 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_H
 /* includes */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 #include <string_view>
 
 #include "diag-client/dcm/conversation/conversation.h"
@@ -16,7 +21,8 @@
 #include "diag-client/diagnostic_client_conversation.h"
 #include "uds_transport/connection.h"
 #include "uds_transport/protocol_types.h"
-#include "utility/sync_timer.h"
+#include "utility/executor.h"
+#include "utility/timer_service.h"
 
 namespace diag {
 namespace client {
@@ -32,9 +38,19 @@ class DmConversation final : public Conversation {
    */
   using ConversationState = conversation_state_impl::ConversationState;
   /**
-   * @brief         Type alias for synchronous timer
+   * @brief         Type alias for executor invoking the handlers of asynchronous requests
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using ResponseHandlerExecutor = utility::executor::Executor<std::function<void()>>;
+
+  /**
+   * @brief         Type alias for diagnostic session of the Diagnostic Server
+   */
+  using SessionControlType = flash::DiagnosticSession;
+
+  /**
+   * @brief         Type alias for security access state of the Diagnostic Server
+   */
+  using SecurityLevelType = flash::SecurityState;
 
  public:
   /**
@@ -149,6 +165,33 @@ class DmConversation final : public Conversation {
    */
   void HandleMessage(::uds_transport::UdsMessagePtr message) noexcept override;
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @details     The chunk is passed on to the response sink, the request finishes once the size indicated is
+   *              handed over
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the received bytes, valid only within this function call
+   */
+  void HandleMessageChunk(::uds_transport::UdsMessage::Address source_addr,
+                          ::uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk) noexcept;
+
+  /**
+   * @brief       Function to indicate the loss of connection to the diagnostic server
+   * @details     The request waiting for response is finished with kDiagConnectionLost
+   */
+  void HandleConnectionLoss() noexcept override;
+
+  /**
+   * @brief       Function to get the size of the largest response the conversation accepts
+   * @return      The size in bytes of the UdsMessage starting from SID
+   */
+  std::size_t GetRxBufferSize() const noexcept { return rx_buffer_size_; }
+
   /**
    * @brief       Function to send Diagnostic Request and get Diagnostic Response
    * @param[in]   message
@@ -161,24 +204,62 @@ class DmConversation final : public Conversation {
   Result<uds_message::UdsResponseMessagePtr, DiagError> SendDiagnosticRequest(
       uds_message::UdsRequestMessageConstPtr message) noexcept override;
 
- private:
   /**
-   * @brief  Definitions of active diagnostic session
+   * @brief       Function to send Diagnostic Request and stream the Diagnostic Response to a sink
+   * @details     The final response is indicated as streamed to the transport layer, which hands over its chunks
+   *              as they are received
+   * @param[in]   message
+   *              The diagnostic request message wrapped in a unique pointer
+   * @param[in]   response_sink
+   *              The sink receiving the chunks of the diagnostic response
+   * @return      Empty result on success, DiagError in case of error
    */
-  enum class SessionControlType : std::uint8_t {
-    kDefaultSession = 0x01,
-    kProgrammingSession = 0x02,
-    kExtendedSession = 0x03,
-    kSystemSafetySession = 0x04
-  };
+  Result<void, DiagError> SendDiagnosticRequest(uds_message::UdsRequestMessageConstPtr message,
+                                                DiagResponseSink response_sink) noexcept override;
 
   /**
-   * @brief  Definitions of active security level
+   * @brief       Function to send Diagnostic Request payload and get Diagnostic Response
+   * @details     The payload is handed over to the transport layer without copy
+   * @param[in]   payload
+   *              The diagnostic request payload starting from SID
+   * @return      DiagResult
+   *              Diagnostic Response message received, DiagError in case of error
    */
-  enum class SecurityLevelType : std::uint8_t {
-    kLocked = 0x00,
-    kUnLocked = 0x01,
-  };
+  DiagResult SendDiagnosticPayload(::uds_transport::ByteVector payload) noexcept;
+
+  /**
+   * @brief       Function to download an image into the memory of the Diagnostic Server
+   * @param[in]   download_request
+   *              The download parameters
+   * @return      The download result on success, DownloadError in case of error
+   */
+  Result<flash::DownloadResponseType, DownloadError> SendDownloadRequest(
+      flash::DownloadRequestType const &download_request) noexcept override;
+
+  /**
+   * @brief       Function to get the diagnostic session last confirmed by the Diagnostic Server
+   * @return      The active diagnostic session
+   */
+  SessionControlType GetActiveSession() const noexcept { return active_session_.load(); }
+
+  /**
+   * @brief       Function to get the security access state last confirmed by the Diagnostic Server
+   * @return      The active security access state
+   */
+  SecurityLevelType GetActiveSecurityLevel() const noexcept { return active_security_level_.load(); }
+
+  /**
+   * @brief       Function to send Diagnostic Request without blocking the caller
+   * @details     The caller returns once the request is handed over to the transport layer, its acknowledgement,
+   *              the final response, P2/P2Star timeout or connection loss complete the request from the reception
+   *              or timer service context
+   * @param[in]   message
+   *              The diagnostic request message wrapped in a unique pointer
+   * @param[in]   response_handler
+   *              The handler invoked once with Diagnostic Response message received, DiagError in case of error
+   */
+  void SendDiagnosticRequestAsync(uds_message::UdsRequestMessageConstPtr message,
+                                  DiagResponseHandler response_handler) noexcept override;
 
  private:
   /**
@@ -192,14 +273,83 @@ class DmConversation final : public Conversation {
       ::uds_transport::UdsTransportProtocolMgr::TransmissionResult result_type);
 
   /**
-   * @brief       Store the active diagnostic session
+   * @brief       Function to send Diagnostic Request payload and get Diagnostic Response
+   * @details     The request is rejected with kDiagBusyProcessing while another request is outstanding
+   * @param[in]   payload
+   *              The diagnostic request payload starting from SID
+   * @param[in]   response_sink
+   *              The sink receiving the chunks of the final response, empty to buffer the response
+   * @return      DiagResult
+   *              Diagnostic Response message received, DiagError in case of error
+   */
+  DiagResult SendDiagnosticPayload(::uds_transport::ByteVector payload,
+                                   DiagResponseSink response_sink) noexcept;
+
+  /**
+   * @brief       Function to wait for the final diagnostic response with P2/P2Star timeout monitoring
+   * @details     The calling thread sleeps until final response, pending response or timeout. The P2/P2Star
+   *              timeout is monitored by the timer service
+   * @return      DiagResult
+   *              Diagnostic Response message received, kDiagResponseTimeout in case of timeout
    */
-  SessionControlType active_session_;
+  DiagResult WaitForResponse() noexcept;
 
   /**
-   * @brief       Store the active diagnostic security level
+   * @brief       Function to arm the P2/P2Star timer of the outstanding asynchronous request
+   * @details     Must be called with response event lock held, the timer previously armed is returned to be
+   *              cancelled once the lock is released
+   * @param[in]   timeout
+   *              The P2/P2Star timeout
+   * @return      The identifier of the timer previously armed
    */
-  SecurityLevelType active_security_level_;
+  utility::timer::TimerService::TimerId RestartAsyncResponseTimer(std::chrono::milliseconds timeout) noexcept;
+
+  /**
+   * @brief       Function to handle the expiry of the P2/P2Star timer of the outstanding asynchronous request
+   * @param[in]   request_sequence
+   *              The request sequence at the time the timer was armed, a stale timer is ignored
+   */
+  void HandleAsyncResponseTimeout(std::uint32_t request_sequence) noexcept;
+
+  /**
+   * @brief       Function to handle the transmission result of the outstanding asynchronous request
+   * @details     Starts the P2 timer once acknowledged, otherwise completes the request with the error
+   * @param[in]   request_sequence
+   *              The request sequence at the time the request was started, a stale result is ignored
+   * @param[in]   transmission_result
+   *              The transmission result
+   */
+  void HandleAsyncTransmissionResult(
+      std::uint32_t request_sequence,
+      ::uds_transport::UdsTransportProtocolMgr::TransmissionResult transmission_result) noexcept;
+
+  /**
+   * @brief       Function to complete the outstanding asynchronous request
+   * @details     Must be called with response event lock held, the lock is released before the handler is
+   *              dispatched to the response handler executor shared by all conversations
+   * @param[in]   lck
+   *              The held response event lock
+   * @param[in]   result
+   *              Diagnostic Response message received, DiagError in case of error
+   */
+  void CompleteAsyncRequest(std::unique_lock<std::mutex> &lck, DiagResult result) noexcept;
+
+  /**
+   * @brief       Function to track the diagnostic session and security access state out of a positive response
+   * @param[in]   response
+   *              The diagnostic response starting from SID
+   */
+  void TrackSessionAndSecurity(core_type::Span<std::uint8_t const> response) noexcept;
+
+  /**
+   * @brief       Store the active diagnostic session, written from the reception context
+   */
+  std::atomic<SessionControlType> active_session_;
+
+  /**
+   * @brief       Store the active diagnostic security level, written from the reception context
+   */
+  std::atomic<SecurityLevelType> active_security_level_;
 
   /**
    * @brief       Store the size of reception buffer size setting
@@ -247,19 +397,74 @@ class DmConversation final : public Conversation {
   std::unique_ptr<::uds_transport::Connection> connection_;
 
   /**
-   * @brief       Store the synchronous timer
+   * @brief       Store the mutex protecting response reception events
+   */
+  std::mutex response_event_lock_;
+
+  /**
+   * @brief       Store the condition variable notified on response reception events
+   */
+  std::condition_variable response_event_cond_var_;
+
+  /**
+   * @brief       Store the received uds response handed over by the transport layer, owning its payload
+   */
+  ::uds_transport::UdsMessagePtr received_response_;
+
+  /**
+   * @brief       Store the sink receiving the streamed response of the request in progress, if any
+   */
+  DiagResponseSink response_sink_;
+
+  /**
+   * @brief       Store the size in bytes of the response being streamed
+   */
+  std::size_t streamed_response_size_;
+
+  /**
+   * @brief       Store the number of bytes of the response streamed so far
+   */
+  std::size_t streamed_size_;
+
+  /**
+   * @brief       Store whether a chunk is being passed to the sink outside the lock
    */
-  SyncTimer sync_timer_;
+  bool is_sink_running_;
 
   /**
-   * @brief       Store the received uds response
+   * @brief       Store the flag indicating the connection was lost while waiting for response
    */
-  ::uds_transport::ByteVector payload_rx_buffer_;
+  bool connection_lost_;
 
   /**
    * @brief       Store the conversation state
    */
-  conversation_state_impl::ConversationStateImpl conversation_state_;
+  conversation_state_impl::ConversationStateMachine conversation_state_;
+
+  /**
+   * @brief       Store the handler of the outstanding asynchronous request, empty for a synchronous request
+   */
+  DiagResponseHandler async_response_handler_;
+
+  /**
+   * @brief       Store the sequence advanced on every start, timer restart and completion of asynchronous request
+   */
+  std::uint32_t async_request_sequence_;
+
+  /**
+   * @brief       Store the identifier of the P2/P2Star timer of the outstanding asynchronous request
+   */
+  utility::timer::TimerService::TimerId async_timer_id_;
+
+  /**
+   * @brief       Store whether the transport layer still refers to the conversation for a transmission result
+   */
+  bool is_transmission_pending_;
+
+  /**
+   * @brief       Store the number of handlers queued to the response handler executor and not yet returned
+   */
+  std::size_t queued_handler_count_;
 };
 
 }  // namespace conversation
@@ -8,13 +8,14 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_STATE_IMPL_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_STATE_IMPL_H
 /* includes */
-#include "core/include/common_header.h"
-#include "utility/state.h"
+#include <cstdint>
+#include <utility>
+
+#include "utility/state_machine.h"
 
 namespace diag {
 namespace client {
 namespace conversation_state_impl {
-using namespace utility::state;
 // Conversation States
 enum class ConversationState : std::uint8_t {
   kIdle = 0x00,
@@ -25,130 +26,32 @@ enum class ConversationState : std::uint8_t {
   kDiagSuccess,
 };
 
-class ConversationStateImpl {
- public:
-  // ctor
-  ConversationStateImpl();
-
-  // dtor
-  ~ConversationStateImpl() = default;
-
-  // Function to get the Conversation State context
-  auto GetConversationStateContext() noexcept -> StateContext<ConversationState> &;
-
- private:
-  // conversation state
-  std::unique_ptr<StateContext<ConversationState>> conversation_state_;
-};
-
-class kIdle final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kIdle(ConversationState state);
-
-  // dtor
-  ~kIdle() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
-
-class kDiagWaitForRes final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kDiagWaitForRes(ConversationState state);
-
-  // dtor
-  ~kDiagWaitForRes() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
-
-class kDiagStartP2StarTimer final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kDiagStartP2StarTimer(ConversationState state);
-
-  // dtor
-  ~kDiagStartP2StarTimer() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
-
-class kDiagRecvdPendingRes final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kDiagRecvdPendingRes(ConversationState state);
-
-  // dtor
-  ~kDiagRecvdPendingRes() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
-
-class kDiagRecvdFinalRes final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kDiagRecvdFinalRes(ConversationState state);
+// Allowed conversation state transitions, every state may fall back to idle
+inline constexpr std::pair<ConversationState, ConversationState> kConversationTransitions[]{
+    {ConversationState::kIdle, ConversationState::kDiagWaitForRes},
+    {ConversationState::kDiagWaitForRes, ConversationState::kDiagRecvdPendingRes},
+    {ConversationState::kDiagWaitForRes, ConversationState::kDiagRecvdFinalRes},
+    {ConversationState::kDiagWaitForRes, ConversationState::kIdle},
+    {ConversationState::kDiagRecvdPendingRes, ConversationState::kDiagStartP2StarTimer},
+    {ConversationState::kDiagRecvdPendingRes, ConversationState::kDiagRecvdPendingRes},
+    {ConversationState::kDiagRecvdPendingRes, ConversationState::kDiagRecvdFinalRes},
+    {ConversationState::kDiagRecvdPendingRes, ConversationState::kIdle},
+    {ConversationState::kDiagStartP2StarTimer, ConversationState::kDiagRecvdPendingRes},
+    {ConversationState::kDiagStartP2StarTimer, ConversationState::kDiagRecvdFinalRes},
+    {ConversationState::kDiagStartP2StarTimer, ConversationState::kIdle},
+    {ConversationState::kDiagRecvdFinalRes, ConversationState::kDiagSuccess},
+    {ConversationState::kDiagRecvdFinalRes, ConversationState::kIdle},
+    {ConversationState::kDiagSuccess, ConversationState::kIdle}};
+
+// Conversation transition table
+inline constexpr utility::state::TransitionTable<ConversationState, 6u>
+    kConversationTransitionTable{kConversationTransitions};
+
+// Conversation state machine
+using ConversationStateMachine =
+    utility::state::StateMachine<ConversationState, kConversationTransitionTable>;
 
-  // dtor
-  ~kDiagRecvdFinalRes() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
-
-class kDiagSuccess final : public State<ConversationState> {
- public:
-  // ctor
-  explicit kDiagSuccess(ConversationState state);
-
-  // dtor
-  ~kDiagSuccess() override = default;
-
-  // start the state
-  void Start() override;
-
-  // Stop the state
-  void Stop() override;
-
-  // Handle invoked asynchronously
-  void HandleMessage() override;
-};
 }  // namespace conversation_state_impl
 }  // namespace client
 }  // namespace diag
-#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_STATE_IMPL_H
\ No newline at end of file
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_DM_CONVERSATION_STATE_IMPL_H
@@ -8,10 +8,13 @@
 
 #include "diag-client/dcm/conversation/vd_conversation.h"
 
+#include <future>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
+#include "boost-support/network/ip_address.h"
 #include "diag-client/common/logger.h"
 #include "diag-client/dcm/service/vd_message.h"
 
@@ -82,10 +85,11 @@ void SerializeVINFromString(std::string &input_string, std::vector<uint8_t> &out
 class VehicleInfoMessageImpl final : public vehicle_info::VehicleInfoMessage {
  public:
   explicit VehicleInfoMessageImpl(
-      std::map<std::uint16_t, vehicle_info::VehicleAddrInfoResponse> &vehicle_info_collection)
+      std::map<std::pair<std::uint16_t, std::string>, vehicle_info::VehicleAddrInfoResponse>
+          &vehicle_info_collection)
       : vehicle_info_messages_{} {
-    for (std::pair<std::uint16_t, vehicle_info::VehicleAddrInfoResponse> vehicle_info:
-         vehicle_info_collection) {
+    for (std::pair<std::pair<std::uint16_t, std::string> const, vehicle_info::VehicleAddrInfoResponse>
+             &vehicle_info: vehicle_info_collection) {
       Push(vehicle_info.second);
     }
   }
@@ -115,11 +119,14 @@ class VdConversationHandler final : public ::uds_transport::ConversionHandler {
    *                The handle id of conversation
    * @param[in]     vd_conversion
    *                The reference of vd conversation
+   * @param[in]     endpoint_index
+   *                The index of endpoint the messages are received on
    */
   VdConversationHandler(::uds_transport::conversion_manager::ConversionHandlerID handler_id,
-                        VdConversation &vd_conversion)
+                        VdConversation &vd_conversion, std::size_t endpoint_index)
       : ::uds_transport::ConversionHandler{handler_id},
-        vd_conversation_{vd_conversion} {}
+        vd_conversation_{vd_conversion},
+        endpoint_index_{endpoint_index} {}
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -182,34 +189,70 @@ class VdConversationHandler final : public ::uds_transport::ConversionHandler {
    *              back to the conversation here
    */
   void HandleMessage(::uds_transport::UdsMessagePtr message) const noexcept override {
-    vd_conversation_.HandleMessage(std::move(message));
+    vd_conversation_.HandleMessage(endpoint_index_, std::move(message));
   }
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed message, not applicable for vehicle discovery
+   */
+  void HandleMessageChunk(::uds_transport::UdsMessage::Address, ::uds_transport::UdsMessage::Address,
+                          core_type::Span<std::uint8_t const>) const noexcept override {}
+
+  /**
+   * @brief       Function to indicate the loss of connection, not applicable for vehicle discovery
+   */
+  void HandleConnectionLoss() const noexcept override {}
+
+  /**
+   * @brief       Function to get the size of the largest message accepted, not applicable for vehicle discovery
+   * @return      Zero, vehicle discovery responses are limited by the udp channel
+   */
+  std::size_t GetRxBufferSize() const noexcept override { return 0u; }
+
  private:
   /**
    * @brief         Store the reference of vd conversation
    */
   VdConversation &vd_conversation_;
+
+  /**
+   * @brief         Store the index of endpoint the messages are received on
+   */
+  std::size_t endpoint_index_;
 };
 
 // Conversation class
 VdConversation::VdConversation(std::string_view conversion_name,
                                VDConversationType &conversion_identifier)
-    : vd_conversion_handler_{std::make_unique<VdConversationHandler>(
-          conversion_identifier.handler_id, *this)},
-      conversation_name_{conversion_name},
-      broadcast_address_{conversion_identifier.udp_broadcast_address},
-      connection_ptr_{},
+    : conversation_name_{conversion_name},
+      endpoints_{},
       vehicle_info_collection_{},
-      vehicle_info_container_mutex_{} {}
+      response_handler_{},
+      expected_response_count_{0U},
+      is_collecting_{false},
+      collection_sequence_{0U},
+      vehicle_entity_registry_{},
+      vehicle_info_container_mutex_{},
+      response_handler_mutex_{} {
+  endpoints_.reserve(conversion_identifier.endpoints.size());
+  for (VDEndpointType const &endpoint: conversion_identifier.endpoints) {
+    endpoints_.emplace_back(DiscoveryEndpoint{
+        endpoint.udp_address, endpoint.udp_broadcast_address,
+        std::make_unique<VdConversationHandler>(conversion_identifier.handler_id, *this,
+                                                endpoints_.size()),
+        nullptr});
+  }
+}
 
 VdConversation::~VdConversation() = default;
 
 void VdConversation::Startup() noexcept {
-  // initialize the connection
-  static_cast<void>(connection_ptr_->Initialize());
-  // start the connection
-  connection_ptr_->Start();
+  for (DiscoveryEndpoint &endpoint: endpoints_) {
+    // initialize the connection
+    static_cast<void>(endpoint.connection->Initialize());
+    // start the connection
+    endpoint.connection->Start();
+  }
   // Change the state to Active
   activity_status_ = ActivityStatusType::kActive;
   logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
@@ -222,8 +265,8 @@ void VdConversation::Startup() noexcept {
 
 void VdConversation::Shutdown() noexcept {
   if (GetActivityStatus() == ActivityStatusType::kActive) {
-    // shutdown connection
-    connection_ptr_->Stop();
+    // shutdown connections
+    for (DiscoveryEndpoint &endpoint: endpoints_) { endpoint.connection->Stop(); }
     // Change the state to InActive
     activity_status_ = ActivityStatusType::kInactive;
     logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
@@ -237,13 +280,19 @@ void VdConversation::Shutdown() noexcept {
 
 void VdConversation::RegisterConnection(
     std::unique_ptr<uds_transport::Connection> connection) noexcept {
-  connection_ptr_ = std::move(connection);
+  RegisterConnection(0U, std::move(connection));
+}
+
+void VdConversation::RegisterConnection(
+    std::size_t endpoint_index, std::unique_ptr<uds_transport::Connection> connection) noexcept {
+  endpoints_[endpoint_index].connection = std::move(connection);
 }
 
 core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                   DiagClient::VehicleInfoResponseError>
 VdConversation::SendVehicleIdentificationRequest(
-    vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept {
+    vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
   using VehicleIdentificationResponseResult =
       core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                         DiagClient::VehicleInfoResponseError>;
@@ -258,33 +307,90 @@ VdConversation::SendVehicleIdentificationRequest(
   if (VerifyVehicleInfoRequest(
           vehicle_info_request_deserialized_value.first,
           static_cast<uint8_t>(vehicle_info_request_deserialized_value.second.size()))) {
-    if (connection_ptr_->Transmit(std::make_unique<diag::client::vd_message::VdMessage>(
-            vehicle_info_request_deserialized_value.first,
-            vehicle_info_request_deserialized_value.second, broadcast_address_)) !=
-        uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed) {
-      // Check if any response received
-      if (vehicle_info_collection_.empty()) {
-        // no response received
-        result.EmplaceError(DiagClient::VehicleInfoResponseError::kNoResponseReceived);
-        logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
-            FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
-              msg << "'" << conversation_name_ << "'"
-                  << "-> "
-                  << "No vehicle identification response received, timed out "
-                     "without response";
-            });
-      } else {
-        result.EmplaceValue(std::make_unique<VehicleInfoMessageImpl>(vehicle_info_collection_));
-        // all the responses are copied, now clear the map
-        vehicle_info_collection_.clear();
-      }
-    }
+    result = CollectVehicleInfoResponses(
+        [this, &vehicle_info_request_deserialized_value]() {
+          // every transmission blocks until DoIPCtrl expires or the collection is completed earlier, further
+          // endpoints wait in parallel to the first one
+          std::vector<std::future<uds_transport::UdsTransportProtocolMgr::TransmissionResult>>
+              endpoint_transmissions{};
+          for (std::size_t endpoint_index{1U}; endpoint_index < endpoints_.size(); endpoint_index++) {
+            endpoint_transmissions.emplace_back(std::async(
+                std::launch::async,
+                [this, endpoint_index](uds_transport::UdsMessageConstPtr message) {
+                  return endpoints_[endpoint_index].connection->Transmit(std::move(message));
+                },
+                std::make_unique<diag::client::vd_message::VdMessage>(
+                    vehicle_info_request_deserialized_value.first,
+                    vehicle_info_request_deserialized_value.second,
+                    endpoints_[endpoint_index].broadcast_address)));
+          }
+          uds_transport::UdsTransportProtocolMgr::TransmissionResult transmission_result{
+              endpoints_[0U].connection->Transmit(std::make_unique<diag::client::vd_message::VdMessage>(
+                  vehicle_info_request_deserialized_value.first,
+                  vehicle_info_request_deserialized_value.second, endpoints_[0U].broadcast_address))};
+          // the request is sent if any endpoint transmitted it
+          for (std::future<uds_transport::UdsTransportProtocolMgr::TransmissionResult>
+                   &endpoint_transmission: endpoint_transmissions) {
+            if (endpoint_transmission.get() !=
+                uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed) {
+              transmission_result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
+            }
+          }
+          return transmission_result;
+        },
+        std::move(response_handler), vehicle_info_request.expected_response_count);
   } else {
     result.EmplaceError(DiagClient::VehicleInfoResponseError::kInvalidParameters);
   }
   return result;
 }
 
+core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                  DiagClient::VehicleInfoResponseError>
+VdConversation::SendVehicleIdentificationSweep(
+    vehicle_info::VehicleInfoSweepRequestType sweep_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+  using VehicleIdentificationResponseResult =
+      core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                        DiagClient::VehicleInfoResponseError>;
+
+  VehicleIdentificationResponseResult result{VehicleIdentificationResponseResult::FromError(
+      DiagClient::VehicleInfoResponseError::kInvalidParameters)};
+
+  std::optional<std::vector<std::string>> const target_addresses{
+      DeserializeVehicleInfoSweepTargets(sweep_request.targets)};
+  if (target_addresses.has_value() && (sweep_request.in_flight_window != 0U) &&
+      (sweep_request.response_timeout.count() > 0) &&
+      (sweep_request.response_timeout <= kMaxSweepResponseTimeout)) {
+    result = CollectVehicleInfoResponses(
+        [this, &sweep_request, &target_addresses]() {
+          // the sweep blocks until every target answered or timed out, or the collection is completed earlier
+          return endpoints_[0U].connection->Transmit(std::make_unique<diag::client::vd_message::VdMessage>(
+              sweep_request.requests_per_second, sweep_request.in_flight_window,
+              sweep_request.response_timeout, target_addresses.value()));
+        },
+        std::move(response_handler), 0U);
+  } else {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
+          msg << "'" << conversation_name_ << "'"
+              << "-> "
+              << "Vehicle identification sweep rejected, invalid targets or settings";
+        });
+  }
+  return result;
+}
+
+vehicle_info::VehicleEntityListType VdConversation::GetVehicleEntities(
+    vehicle_info::VehicleEntityFilter const &filter) const noexcept {
+  return vehicle_entity_registry_.Find(filter);
+}
+
+void VdConversation::SetVehicleEntityChangeHandler(
+    vehicle_info::VehicleEntityChangeHandler change_handler) noexcept {
+  vehicle_entity_registry_.SetChangeHandler(std::move(change_handler));
+}
+
 vehicle_info::VehicleInfoMessageResponseUniquePtr VdConversation::GetDiagnosticServerList() {
   return nullptr;
 }
@@ -293,7 +399,7 @@ std::pair<::uds_transport::UdsTransportProtocolMgr::IndicationResult,
           ::uds_transport::UdsMessagePtr>
 VdConversation::IndicateMessage(uds_transport::UdsMessage::Address /* source_addr */,
                                 uds_transport::UdsMessage::Address /* target_addr */,
-                                uds_transport::UdsMessage::TargetAddressType /* type */,
+                                uds_transport::UdsMessage::TargetAddressType type,
                                 uds_transport::ChannelID, std::size_t size, uds_transport::Priority,
                                 uds_transport::ProtocolKind,
                                 core_type::Span<std::uint8_t const> payload_info) noexcept {
@@ -303,20 +409,126 @@ VdConversation::IndicateMessage(uds_transport::UdsMessage::Address /* source_add
       ::uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationNOk, nullptr};
   if (!payload_info.empty()) {
     ret_val.first = ::uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk;
-    ret_val.second = std::make_unique<diag::client::vd_message::VdMessage>();
+    ret_val.second = std::make_unique<diag::client::vd_message::VdMessage>(type);
     ret_val.second->GetPayload().resize(size);
   }
   return ret_val;
 }
 
 void VdConversation::HandleMessage(uds_transport::UdsMessagePtr message) noexcept {
+  HandleMessage(0U, std::move(message));
+}
+
+void VdConversation::HandleMessage(std::size_t endpoint_index,
+                                   uds_transport::UdsMessagePtr message) noexcept {
   if (message != nullptr) {
-    std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
-    std::pair<std::uint16_t, VehicleAddrInfoResponseStruct> vehicle_info_request{
+    // vehicle announcements are broadcast by the DoIP entities, identification responses are sent to the tester
+    bool const is_announcement{message->GetTaType() ==
+                               uds_transport::UdsMessage::TargetAddressType::kFunctional};
+    std::pair<std::uint16_t, VehicleAddrInfoResponseStruct> vehicle_info_response{
         DeserializeVehicleInfoResponse(std::move(message))};
+    vehicle_info_response.second.interface_address = endpoints_[endpoint_index].interface_address;
+    vehicle_entity_registry_.Update(vehicle_info_response.second, std::chrono::steady_clock::now());
+    if (!is_announcement) {
+      bool is_new_entity{false};
+      std::size_t collection_sequence{};
+      {
+        std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
+        // every DoIP entity is reported once, repeated responses and responses on further endpoints are ignored
+        is_new_entity =
+            is_collecting_ &&
+            vehicle_info_collection_
+                .emplace(VehicleInfoKey{vehicle_info_response.first, vehicle_info_response.second.eid},
+                         vehicle_info_response.second)
+                .second;
+        collection_sequence = collection_sequence_;
+      }
+      if (is_new_entity) {
+        // handler is called without holding the collection lock, so that it may use the conversation
+        std::lock_guard<std::recursive_mutex> const handler_lock{response_handler_mutex_};
+        vehicle_info::VehicleInfoResponseHandler response_handler{};
+        {
+          std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
+          // the request may have completed meanwhile, its handler must not be called any more
+          if (is_collecting_ && (collection_sequence == collection_sequence_)) {
+            response_handler = response_handler_;
+          }
+        }
+        bool const is_stop_requested{response_handler &&
+                                     response_handler(vehicle_info_response.second)};
+        bool is_completed{false};
+        {
+          std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
+          if (is_collecting_ && (collection_sequence == collection_sequence_)) {
+            is_completed = is_stop_requested ||
+                           ((expected_response_count_ != 0U) &&
+                            (vehicle_info_collection_.size() >= expected_response_count_));
+            if (is_completed) { is_collecting_ = false; }
+          }
+        }
+        // stop waiting for DoIPCtrl, the pending request returns with the responses collected. Cancelled while
+        // holding the handler lock, so that it never reaches the endpoints of the next collection
+        if (is_completed) { CancelTransmit(); }
+      }
+    }
+  }
+}
 
-    vehicle_info_collection_.emplace(vehicle_info_request.first, vehicle_info_request.second);
+void VdConversation::CancelTransmit() noexcept {
+  for (DiscoveryEndpoint &endpoint: endpoints_) { endpoint.connection->CancelTransmit(); }
+}
+
+core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                  DiagClient::VehicleInfoResponseError>
+VdConversation::CollectVehicleInfoResponses(
+    std::function<uds_transport::UdsTransportProtocolMgr::TransmissionResult()> const &transmit,
+    vehicle_info::VehicleInfoResponseHandler response_handler,
+    std::size_t expected_response_count) noexcept {
+  using VehicleIdentificationResponseResult =
+      core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                        DiagClient::VehicleInfoResponseError>;
+
+  VehicleIdentificationResponseResult result{VehicleIdentificationResponseResult::FromError(
+      DiagClient::VehicleInfoResponseError::kTransmitFailed)};
+  // the completion of the previous collection may have cancelled endpoints not waiting any more
+  for (DiscoveryEndpoint &endpoint: endpoints_) { endpoint.connection->ResetCancelTransmit(); }
+  {
+    std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
+    vehicle_info_collection_.clear();
+    ++collection_sequence_;
+    response_handler_ = std::move(response_handler);
+    expected_response_count_ = expected_response_count;
+    is_collecting_ = true;
   }
+  uds_transport::UdsTransportProtocolMgr::TransmissionResult const transmission_result{transmit()};
+  std::map<VehicleInfoKey, VehicleAddrInfoResponseStruct> vehicle_info_collection{};
+  {
+    // wait for a handler being called, the caller may release what the handler refers to on return,
+    // the mutex is recursive as the handler itself may issue a request
+    std::lock_guard<std::recursive_mutex> const handler_lock{response_handler_mutex_};
+    std::lock_guard<std::mutex> const lock{vehicle_info_container_mutex_};
+    is_collecting_ = false;
+    response_handler_ = nullptr;
+    vehicle_info_collection.swap(vehicle_info_collection_);
+  }
+  if (transmission_result !=
+      uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed) {
+    // Check if any response received
+    if (vehicle_info_collection.empty()) {
+      // no response received
+      result.EmplaceError(DiagClient::VehicleInfoResponseError::kNoResponseReceived);
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+          FILE_NAME, __LINE__, __func__, [&](std::stringstream &msg) {
+            msg << "'" << conversation_name_ << "'"
+                << "-> "
+                << "No vehicle identification response received, timed out "
+                   "without response";
+          });
+    } else {
+      result.EmplaceValue(std::make_unique<VehicleInfoMessageImpl>(vehicle_info_collection));
+    }
+  }
+  return result;
 }
 
 bool VdConversation::VerifyVehicleInfoRequest(PreselectionMode preselection_mode,
@@ -371,7 +583,12 @@ VdConversation::DeserializeVehicleInfoResponse(uds_transport::UdsMessagePtr mess
 }
 
 ::uds_transport::ConversionHandler &VdConversation::GetConversationHandler() noexcept {
-  return *vd_conversion_handler_;
+  return GetConversationHandler(0U);
+}
+
+::uds_transport::ConversionHandler &VdConversation::GetConversationHandler(
+    std::size_t endpoint_index) noexcept {
+  return *endpoints_[endpoint_index].conversion_handler;
 }
 
 std::pair<VdConversation::PreselectionMode, VdConversation::PreselectionValue>
@@ -401,6 +618,27 @@ VdConversation::DeserializeVehicleInfoRequest(
   return ret_val;
 }
 
+std::optional<std::vector<std::string>> VdConversation::DeserializeVehicleInfoSweepTargets(
+    std::vector<std::string> const &targets) {
+  std::optional<std::vector<std::string>> ret_val{std::vector<std::string>{}};
+  std::unordered_set<std::string> known_addresses{};
+  for (std::string const &target: targets) {
+    std::size_t const remaining_count{kMaxSweepTargetCount - ret_val->size()};
+    core_type::Result<std::vector<std::string>, boost_support::network::IpAddressErrorCode> const
+        host_addresses{boost_support::network::GetHostAddresses(target, remaining_count)};
+    if (!host_addresses.HasValue()) {
+      ret_val.reset();
+      break;
+    }
+    // every target is requested once even if contained in several networks
+    for (std::string const &host_address: host_addresses.Value()) {
+      if (known_addresses.insert(host_address).second) { ret_val->emplace_back(host_address); }
+    }
+  }
+  if (ret_val.has_value() && ret_val->empty()) { ret_val.reset(); }
+  return ret_val;
+}
+
 }  // namespace conversation
 }  // namespace client
 }  // namespace diag
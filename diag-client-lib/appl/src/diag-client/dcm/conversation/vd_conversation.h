@@ -10,12 +10,19 @@
 
 /* includes */
 #include <chrono>
+#include <functional>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "core/include/result.h"
 #include "diag-client/dcm/conversation/conversation.h"
 #include "diag-client/dcm/conversation/vd_conversation_type.h"
+#include "diag-client/dcm/conversation/vehicle_entity_registry.h"
 #include "diag-client/diagnostic_client.h"
 #include "diag-client/diagnostic_client_uds_message_type.h"
 #include "diag-client/diagnostic_client_vehicle_info_message_type.h"
@@ -29,6 +36,9 @@ namespace conversation {
 
 /**
  * @brief       Class to search for available diagnostic server over a network
+ * @details     Vehicle identification requests are sent from every configured endpoint in parallel, the responses of
+ *              all endpoints are merged into one response set. Where broadcasts are not routed, a unicast sweep over a
+ *              list of target addresses is sent from the first endpoint instead
  */
 class VdConversation final : public Conversation {
  private:
@@ -52,6 +62,22 @@ class VdConversation final : public Conversation {
    */
   using LogicalAddress = std::uint16_t;
 
+  /**
+   * @brief         Type alias of the key identifying a DoIP entity within the responses, the same entity responding on
+   *                several endpoints is reported once while vehicles sharing logical addresses are kept apart
+   */
+  using VehicleInfoKey = std::pair<LogicalAddress, std::string>;
+
+  /**
+   * @brief         Maximum number of target addresses of one sweep, the host addresses of a /16 network
+   */
+  static constexpr std::size_t kMaxSweepTargetCount{65536U};
+
+  /**
+   * @brief         Maximum time waited for the answer of a single sweep target
+   */
+  static constexpr std::chrono::milliseconds kMaxSweepResponseTimeout{60000U};
+
  public:
   /**
    * @brief         Constructs an instance of VdConversation
@@ -91,19 +117,39 @@ class VdConversation final : public Conversation {
 
   /**
    * @brief       Function to register the conversation to underlying transport protocol handler
+   * @details     The connection is registered for the first endpoint
    * @param[in]   connection
    *              The conversation connection object
    */
   void RegisterConnection(
       std::unique_ptr<::uds_transport::Connection> connection) noexcept override;
 
+  /**
+   * @brief       Function to register the connection of an endpoint to underlying transport protocol handler
+   * @param[in]   endpoint_index
+   *              The index of endpoint as configured
+   * @param[in]   connection
+   *              The connection created for the endpoint
+   */
+  void RegisterConnection(std::size_t endpoint_index,
+                          std::unique_ptr<::uds_transport::Connection> connection) noexcept;
+
   /**
    * @brief       Function to get the conversation handler from conversation object
    * @return      ConversionHandler &
-   *              The reference to conversation handler
+   *              The reference to conversation handler of the first endpoint
    */
   ::uds_transport::ConversionHandler &GetConversationHandler() noexcept override;
 
+  /**
+   * @brief       Function to get the conversation handler of an endpoint
+   * @param[in]   endpoint_index
+   *              The index of endpoint as configured
+   * @return      ConversionHandler &
+   *              The reference to conversation handler tagging the messages with the endpoint
+   */
+  ::uds_transport::ConversionHandler &GetConversationHandler(std::size_t endpoint_index) noexcept;
+
   /**
    * @brief       Function to indicate a start of reception of message
    * @details     This is called to indicate the reception of new message by underlying transport protocol handler
@@ -146,16 +192,64 @@ class VdConversation final : public Conversation {
    */
   void HandleMessage(::uds_transport::UdsMessagePtr message) noexcept override;
 
+  /**
+   * @brief       Function to Hands over a valid received Uds message received on an endpoint
+   * @param[in]   endpoint_index
+   *              The index of endpoint the message was received on
+   * @param[in]   message
+   *              The The Uds message ptr (unique_ptr semantics) with the request. Ownership of the UdsMessage is given
+   *              back to the conversation here
+   */
+  void HandleMessage(std::size_t endpoint_index, ::uds_transport::UdsMessagePtr message) noexcept;
+
   /**
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
+   * @details     Every DoIP entity responding is handed to the response handler, the request completes without
+   *              waiting for DoIPCtrl once the expected number of entities responded or the handler asked to stop
    * @param[in]   vehicle_info_request
    *              Vehicle information sent along with request
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
    * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
    */
   core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                     DiagClient::VehicleInfoResponseError>
   SendVehicleIdentificationRequest(
-      vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept override;
+      vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+      vehicle_info::VehicleInfoResponseHandler response_handler) noexcept override;
+
+  /**
+   * @brief       Function to send a unicast vehicle identification request to every target and collect the responses
+   * @details     Networks are expanded to their host addresses and duplicates are requested once. The sweep is sent
+   *              from the first endpoint and completes once every target answered or timed out, or the handler asked
+   *              to stop
+   * @param[in]   sweep_request
+   *              The target addresses or IPv4 networks along with rate, window and timeout
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
+   */
+  core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                    DiagClient::VehicleInfoResponseError>
+  SendVehicleIdentificationSweep(vehicle_info::VehicleInfoSweepRequestType sweep_request,
+                                 vehicle_info::VehicleInfoResponseHandler response_handler) noexcept override;
+
+  /**
+   * @brief       Function to get the known DoIP entities matching the filter
+   * @param[in]   filter
+   *              The keys matched
+   * @return      The matching DoIP entities
+   */
+  vehicle_info::VehicleEntityListType GetVehicleEntities(
+      vehicle_info::VehicleEntityFilter const &filter) const noexcept override;
+
+  /**
+   * @brief       Function to set the handler notified when a known DoIP entity is added or changed
+   * @param[in]   change_handler
+   *              The handler to be set, empty to stop notifications
+   */
+  void SetVehicleEntityChangeHandler(
+      vehicle_info::VehicleEntityChangeHandler change_handler) noexcept override;
 
   /**
    * @brief       Function to get the list of available diagnostic server
@@ -184,6 +278,37 @@ class VdConversation final : public Conversation {
   static std::pair<LogicalAddress, VehicleAddrInfoResponseStruct> DeserializeVehicleInfoResponse(
       ::uds_transport::UdsMessagePtr message);
 
+  /**
+   * @brief       Function to stop all endpoints waiting for further vehicle identification responses
+   */
+  void CancelTransmit() noexcept;
+
+  /**
+   * @brief       Function to collect the vehicle identification responses received while the request is transmitted
+   * @param[in]   transmit
+   *              The function transmitting the request, returns once the responses are collected
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @param[in]   expected_response_count
+   *              The number of DoIP entities completing the request, zero to wait until transmit returns
+   * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
+   */
+  core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                    DiagClient::VehicleInfoResponseError>
+  CollectVehicleInfoResponses(
+      std::function<::uds_transport::UdsTransportProtocolMgr::TransmissionResult()> const &transmit,
+      vehicle_info::VehicleInfoResponseHandler response_handler,
+      std::size_t expected_response_count) noexcept;
+
+  /**
+   * @brief       Function to deserialize the targets of a vehicle identification sweep into host addresses
+   * @param[in]   targets
+   *              The ip addresses or IPv4 networks in CIDR notation
+   * @return      The distinct host addresses, empty if any target is invalid, none is given or too many are given
+   */
+  static std::optional<std::vector<std::string>> DeserializeVehicleInfoSweepTargets(
+      std::vector<std::string> const &targets);
+
   /**
    * @brief       Function to deserialize the Vehicle Information request from user
    * @param[in]   vehicle_info_request
@@ -194,9 +319,29 @@ class VdConversation final : public Conversation {
       vehicle_info::VehicleInfoListRequestType &vehicle_info_request);
 
   /**
-   * @brief       Store the vd conversation handler
+   * @brief       Structure containing a network endpoint vehicle identification requests are sent from
    */
-  std::unique_ptr<::uds_transport::ConversionHandler> vd_conversion_handler_;
+  struct DiscoveryEndpoint {
+    /**
+     * @brief       The Udp IP address of the local network interface, tagged on the responses
+     */
+    std::string interface_address;
+
+    /**
+     * @brief       The Udp broadcast IP address the requests are sent to
+     */
+    std::string broadcast_address;
+
+    /**
+     * @brief       The vd conversation handler of endpoint
+     */
+    std::unique_ptr<::uds_transport::ConversionHandler> conversion_handler;
+
+    /**
+     * @brief       The underlying transport protocol connection object
+     */
+    std::unique_ptr<::uds_transport::Connection> connection;
+  };
 
   /**
    * @brief       Store the conversation name
@@ -204,24 +349,49 @@ class VdConversation final : public Conversation {
   std::string conversation_name_;
 
   /**
-   * @brief       Store the broadcast Ip address of the conversation
+   * @brief       Store the endpoints of the conversation
    */
-  std::string broadcast_address_;
+  std::vector<DiscoveryEndpoint> endpoints_;
 
   /**
-   * @brief       Store the underlying transport protocol connection object
+   * @brief       Store the vehicle info collection received till now
    */
-  std::unique_ptr<::uds_transport::Connection> connection_ptr_;
+  std::map<VehicleInfoKey, VehicleAddrInfoResponseStruct> vehicle_info_collection_;
 
   /**
-   * @brief       Store the vehicle info collection received till now
+   * @brief       Store the handler notified for every DoIP entity responding to the pending request
+   */
+  vehicle_info::VehicleInfoResponseHandler response_handler_;
+
+  /**
+   * @brief       Store the number of DoIP entities completing the pending request, zero to wait for DoIPCtrl
+   */
+  std::size_t expected_response_count_;
+
+  /**
+   * @brief       Store whether responses are collected, false once the pending request is completed
+   */
+  bool is_collecting_;
+
+  /**
+   * @brief       Store the sequence of the pending request, so that a late response is not reported to the next one
+   */
+  std::size_t collection_sequence_;
+
+  /**
+   * @brief       Store the DoIP entities seen from vehicle announcements and identification responses
    */
-  std::map<std::uint16_t, VehicleAddrInfoResponseStruct> vehicle_info_collection_;
+  VehicleEntityRegistry vehicle_entity_registry_;
 
   /**
    * @brief       Mutex to lock the vehicle info collection container
    */
   std::mutex vehicle_info_container_mutex_;
+
+  /**
+   * @brief       Mutex to serialize the calls of the response handler, taken before the collection mutex
+   */
+  std::recursive_mutex response_handler_mutex_;
 };
 
 }  // namespace conversation
@@ -10,24 +10,35 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace diag {
 namespace client {
 namespace conversation {
 
 /**
- * @brief       Structure containing VD conversation type
+ * @brief       Structure containing a network endpoint vehicle identification requests are sent from
  */
-struct VDConversationType {
+struct VDEndpointType {
   /**
-   * @brief       The Udp IP address of conversation
+   * @brief       The Udp IP address of the local network interface
    */
   std::string udp_address{};
 
   /**
-   * @brief       The Udp broadcast IP address of conversation
+   * @brief       The Udp broadcast IP address reached through the network interface
    */
   std::string udp_broadcast_address{};
+};
+
+/**
+ * @brief       Structure containing VD conversation type
+ */
+struct VDConversationType {
+  /**
+   * @brief       The endpoints probed in parallel, at least one
+   */
+  std::vector<VDEndpointType> endpoints{};
 
   /**
    * @brief       The Port number of conversation
@@ -0,0 +1,122 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "diag-client/dcm/conversation/vehicle_entity_registry.h"
+
+#include <optional>
+#include <utility>
+
+namespace diag {
+namespace client {
+namespace conversation {
+
+VehicleEntityRegistry::VehicleEntityRegistry() noexcept
+    : entities_{},
+      logical_address_index_{},
+      vin_index_{},
+      entities_mutex_{},
+      change_handler_{},
+      change_handler_mutex_{} {}
+
+VehicleEntityRegistry::~VehicleEntityRegistry() noexcept = default;
+
+void VehicleEntityRegistry::Update(vehicle_info::VehicleAddrInfoResponse const &address_info,
+                                   std::chrono::steady_clock::time_point seen_at) noexcept {
+  std::optional<std::pair<vehicle_info::VehicleEntityChange, vehicle_info::VehicleEntity>>
+      change{};
+  {
+    std::unique_lock<std::shared_mutex> const lock{entities_mutex_};
+    auto const [it, is_added]{entities_.try_emplace(address_info.eid)};
+    vehicle_info::VehicleAddrInfoResponse &known_info{it->second.address_info};
+    it->second.last_seen = seen_at;
+    if (is_added) {
+      known_info = address_info;
+      logical_address_index_.emplace(address_info.logical_address, address_info.eid);
+      vin_index_.emplace(address_info.vin, address_info.eid);
+      change.emplace(vehicle_info::VehicleEntityChange::kAdded, it->second);
+    } else if ((known_info.ip_address != address_info.ip_address) ||
+               (known_info.logical_address != address_info.logical_address) ||
+               (known_info.vin != address_info.vin) || (known_info.gid != address_info.gid)) {
+      if (known_info.logical_address != address_info.logical_address) {
+        RemoveFromIndex(logical_address_index_, known_info.logical_address, address_info.eid);
+        logical_address_index_.emplace(address_info.logical_address, address_info.eid);
+      }
+      if (known_info.vin != address_info.vin) {
+        // VIN is reported once synchronized within the vehicle
+        RemoveFromIndex(vin_index_, known_info.vin, address_info.eid);
+        vin_index_.emplace(address_info.vin, address_info.eid);
+      }
+      known_info = address_info;
+      change.emplace(vehicle_info::VehicleEntityChange::kChanged, it->second);
+    } else {
+      // only refreshed
+    }
+  }
+  // notify outside of entity lock so that the handler can look up the registry
+  if (change.has_value()) {
+    std::lock_guard<std::mutex> const lock{change_handler_mutex_};
+    if (change_handler_) { change_handler_(change->first, change->second); }
+  }
+}
+
+vehicle_info::VehicleEntityListType VehicleEntityRegistry::Find(
+    vehicle_info::VehicleEntityFilter const &filter) const noexcept {
+  vehicle_info::VehicleEntityListType result{};
+  std::shared_lock<std::shared_mutex> const lock{entities_mutex_};
+  auto const add_matching_entity{[this, &filter, &result](std::string const &eid) {
+    auto const it{entities_.find(eid)};
+    if ((it != entities_.end()) && IsMatching(it->second, filter)) {
+      result.emplace_back(it->second);
+    }
+  }};
+  if (!filter.eid.empty()) {
+    add_matching_entity(filter.eid);
+  } else if (filter.logical_address.has_value()) {
+    auto const range{logical_address_index_.equal_range(filter.logical_address.value())};
+    for (auto it{range.first}; it != range.second; ++it) { add_matching_entity(it->second); }
+  } else if (!filter.vin.empty()) {
+    auto const range{vin_index_.equal_range(filter.vin)};
+    for (auto it{range.first}; it != range.second; ++it) { add_matching_entity(it->second); }
+  } else {
+    result.reserve(entities_.size());
+    for (std::pair<std::string const, vehicle_info::VehicleEntity> const &entity: entities_) {
+      result.emplace_back(entity.second);
+    }
+  }
+  return result;
+}
+
+void VehicleEntityRegistry::SetChangeHandler(
+    vehicle_info::VehicleEntityChangeHandler change_handler) noexcept {
+  std::lock_guard<std::mutex> const lock{change_handler_mutex_};
+  change_handler_ = std::move(change_handler);
+}
+
+template<typename Key>
+void VehicleEntityRegistry::RemoveFromIndex(std::unordered_multimap<Key, std::string> &index,
+                                            Key const &key, std::string const &eid) noexcept {
+  auto const range{index.equal_range(key)};
+  for (auto it{range.first}; it != range.second; ++it) {
+    if (it->second == eid) {
+      static_cast<void>(index.erase(it));
+      break;
+    }
+  }
+}
+
+bool VehicleEntityRegistry::IsMatching(vehicle_info::VehicleEntity const &entity,
+                                       vehicle_info::VehicleEntityFilter const &filter) noexcept {
+  return (!filter.logical_address.has_value() ||
+          (entity.address_info.logical_address == filter.logical_address.value())) &&
+         (filter.vin.empty() || (entity.address_info.vin == filter.vin)) &&
+         (filter.eid.empty() || (entity.address_info.eid == filter.eid));
+}
+
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
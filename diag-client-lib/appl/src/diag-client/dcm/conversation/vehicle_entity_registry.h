@@ -0,0 +1,144 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_VEHICLE_ENTITY_REGISTRY_H
+#define DIAG_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_VEHICLE_ENTITY_REGISTRY_H
+
+/* includes */
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "diag-client/diagnostic_client_vehicle_info_message_type.h"
+
+namespace diag {
+namespace client {
+namespace conversation {
+
+/**
+ * @brief       Class to store all DoIP entities seen on the network
+ * @details     Entities are identified by their EID and additionally indexed by logical address and VIN, as several
+ *              vehicles may use the same logical addresses and several DoIP entities of one vehicle report the same
+ *              VIN. Updates are done from the udp reception context while lookups are done concurrently by the
+ *              application
+ */
+class VehicleEntityRegistry final {
+ public:
+  /**
+   * @brief         Constructs an instance of VehicleEntityRegistry
+   */
+  VehicleEntityRegistry() noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  VehicleEntityRegistry(const VehicleEntityRegistry &other) noexcept = delete;
+  VehicleEntityRegistry &operator=(const VehicleEntityRegistry &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  VehicleEntityRegistry(VehicleEntityRegistry &&other) noexcept = delete;
+  VehicleEntityRegistry &operator=(VehicleEntityRegistry &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of VehicleEntityRegistry
+   */
+  ~VehicleEntityRegistry() noexcept;
+
+  /**
+   * @brief       Function to add or refresh a DoIP entity from a received announcement or identification response
+   * @details     The change handler is notified when the entity is new or any of its address information changed
+   * @param[in]   address_info
+   *              The vehicle address information received
+   * @param[in]   seen_at
+   *              The time of reception
+   */
+  void Update(vehicle_info::VehicleAddrInfoResponse const &address_info,
+              std::chrono::steady_clock::time_point seen_at) noexcept;
+
+  /**
+   * @brief       Function to get all DoIP entities matching the filter
+   * @details     The most selective key set is looked up through its index, EID before logical address before VIN
+   * @param[in]   filter
+   *              The keys matched
+   * @return      The matching DoIP entities
+   */
+  vehicle_info::VehicleEntityListType Find(vehicle_info::VehicleEntityFilter const &filter) const noexcept;
+
+  /**
+   * @brief       Function to set the handler notified when a DoIP entity is added or changed
+   * @details     Waits for a running notification of the previous handler to finish
+   * @param[in]   change_handler
+   *              The handler to be set, empty to stop notifications
+   */
+  void SetChangeHandler(vehicle_info::VehicleEntityChangeHandler change_handler) noexcept;
+
+ private:
+  /**
+   * @brief       Function to remove the index entry of an entity
+   * @param[in]   index
+   *              The index changed
+   * @param[in]   key
+   *              The key of index entry
+   * @param[in]   eid
+   *              The EID of entity
+   */
+  template<typename Key>
+  static void RemoveFromIndex(std::unordered_multimap<Key, std::string> &index, Key const &key,
+                              std::string const &eid) noexcept;
+
+  /**
+   * @brief       Function to check whether an entity matches the filter
+   * @param[in]   entity
+   *              The entity checked
+   * @param[in]   filter
+   *              The keys matched
+   * @return      True if all keys set are matching, otherwise False
+   */
+  static bool IsMatching(vehicle_info::VehicleEntity const &entity,
+                         vehicle_info::VehicleEntityFilter const &filter) noexcept;
+
+  /**
+   * @brief       Store all DoIP entities identified by their EID
+   */
+  std::unordered_map<std::string, vehicle_info::VehicleEntity> entities_;
+
+  /**
+   * @brief       Store the EIDs of all DoIP entities per logical address
+   */
+  std::unordered_multimap<std::uint16_t, std::string> logical_address_index_;
+
+  /**
+   * @brief       Store the EIDs of all DoIP entities per VIN
+   */
+  std::unordered_multimap<std::string, std::string> vin_index_;
+
+  /**
+   * @brief       Store the lock protecting entities and indexes, shared by concurrent lookups
+   */
+  mutable std::shared_mutex entities_mutex_;
+
+  /**
+   * @brief       Store the handler notified on changes
+   */
+  vehicle_info::VehicleEntityChangeHandler change_handler_;
+
+  /**
+   * @brief       Store the lock serializing notifications and changes of the handler
+   */
+  std::mutex change_handler_mutex_;
+};
+
+}  // namespace conversation
+}  // namespace client
+}  // namespace diag
+
+#endif  // DIAG_CLIENT_LIB_APPL_SRC_DCM_CONVERSATION_VEHICLE_ENTITY_REGISTRY_H
@@ -11,6 +11,7 @@
 #include <optional>
 
 #include "diag-client/common/logger.h"
+#include "diag-client/dcm/flash/flash_orchestrator.h"
 
 namespace diag {
 namespace client {
@@ -83,8 +84,36 @@ conversation::DiagClientConversation DCMClient::GetDiagnosticClientConversation(
 core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
                   DiagClient::VehicleInfoResponseError>
 DCMClient::SendVehicleIdentificationRequest(
-    diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept {
-  return vehicle_discovery_conversation_.SendVehicleIdentificationRequest(vehicle_info_request);
+    diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+  return vehicle_discovery_conversation_.SendVehicleIdentificationRequest(
+      std::move(vehicle_info_request), std::move(response_handler));
+}
+
+core_type::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                  DiagClient::VehicleInfoResponseError>
+DCMClient::SendVehicleIdentificationSweep(
+    vehicle_info::VehicleInfoSweepRequestType sweep_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+  return vehicle_discovery_conversation_.SendVehicleIdentificationSweep(std::move(sweep_request),
+                                                                        std::move(response_handler));
+}
+
+vehicle_info::VehicleEntityListType DCMClient::GetVehicleEntities(
+    vehicle_info::VehicleEntityFilter const &filter) const noexcept {
+  return vehicle_discovery_conversation_.GetVehicleEntities(filter);
+}
+
+void DCMClient::SetVehicleEntityChangeHandler(
+    vehicle_info::VehicleEntityChangeHandler change_handler) noexcept {
+  vehicle_discovery_conversation_.SetVehicleEntityChangeHandler(std::move(change_handler));
+}
+
+core_type::Result<flash::FlashResponseType, DiagClient::FlashError> DCMClient::SendFlashRequest(
+    flash::FlashRequestType flash_request, flash::FlashProgressHandler progress_handler) noexcept {
+  flash::FlashOrchestrator flash_orchestrator{conversation_mgr_, std::move(flash_request),
+                                              std::move(progress_handler)};
+  return flash_orchestrator.Flash();
 }
 
 auto GetConversationManager() noexcept -> conversation_manager::ConversationManager & {
@@ -0,0 +1,393 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "diag-client/dcm/flash/flash_engine.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "diag-client/common/logger.h"
+#include "diag-client/dcm/conversation/dm_conversation.h"
+#include "utility/checksum.h"
+
+namespace diag {
+namespace client {
+namespace flash {
+namespace {
+
+/**
+ * @brief  Service identifier of RequestDownload
+ */
+constexpr std::uint8_t kRequestDownload{0x34U};
+
+/**
+ * @brief  Service identifier of TransferData
+ */
+constexpr std::uint8_t kTransferData{0x36U};
+
+/**
+ * @brief  Service identifier of RequestTransferExit
+ */
+constexpr std::uint8_t kRequestTransferExit{0x37U};
+
+/**
+ * @brief  Offset added to service identifier in positive response
+ */
+constexpr std::uint8_t kPositiveResponseOffset{0x40U};
+
+/**
+ * @brief  Length of SID and block sequence counter preceding the block in TransferData
+ */
+constexpr std::size_t kTransferDataHeaderLength{2U};
+
+/**
+ * @brief  Maximum length in bytes of address, size and block length parameter
+ */
+constexpr std::uint8_t kMaxParameterLength{8U};
+
+/**
+ * @brief       Function to append a value in big endian order
+ * @param[in]   value
+ *              The value appended
+ * @param[in]   length
+ *              The number of bytes appended
+ * @param[out]  buffer
+ *              The buffer appended to
+ * @return      True if the value is representable within length bytes, otherwise False
+ */
+bool AppendBigEndian(std::uint64_t value, std::uint8_t length,
+                     ::uds_transport::ByteVector &buffer) noexcept {
+  bool const is_representable{(length >= kMaxParameterLength) ||
+                              ((value >> (length * 8U)) == 0U)};
+  if (is_representable) {
+    for (std::uint8_t index{length}; index > 0U; --index) {
+      buffer.emplace_back(static_cast<std::uint8_t>(value >> ((index - 1U) * 8U)));
+    }
+  }
+  return is_representable;
+}
+
+/**
+ * @brief       Function to check if the response is positive response of the service
+ * @param[in]   response
+ *              The response starting from SID
+ * @param[in]   service_id
+ *              The service identifier of the request
+ * @return      True if positive response, otherwise False
+ */
+bool IsPositiveResponse(core_type::Span<std::uint8_t const> response,
+                        std::uint8_t service_id) noexcept {
+  return !response.empty() &&
+         (response[0U] == static_cast<std::uint8_t>(service_id + kPositiveResponseOffset));
+}
+
+/**
+ * @brief       Function to get the response payload of the diagnostic result
+ * @param[in]   diag_result
+ *              The diagnostic result
+ * @return      The view onto the response, empty in case of error
+ */
+core_type::Span<std::uint8_t const> GetResponse(
+    conversation::DiagClientConversation::DiagResult const &diag_result) noexcept {
+  return diag_result.HasValue()
+             ? core_type::Span<std::uint8_t const>{diag_result.Value()->GetPayload()}
+             : core_type::Span<std::uint8_t const>{};
+}
+
+}  // namespace
+
+/**
+ * @brief    Class calculating the requested checksum over the data of a segment
+ */
+class FlashEngine::ChecksumCalculator final {
+ public:
+  /**
+   * @brief         Constructs an instance of ChecksumCalculator
+   * @param[in]     checksum_type
+   *                The checksum calculated
+   */
+  explicit ChecksumCalculator(ChecksumType checksum_type) noexcept
+      : checksum_type_{checksum_type},
+        crc32_{},
+        crc16_{} {}
+
+  /**
+   * @brief         Function to continue the calculation with further data
+   * @param[in]     data
+   *                The data
+   */
+  void Update(core_type::Span<std::uint8_t const> data) noexcept {
+    if (checksum_type_ == ChecksumType::kCrc32) {
+      crc32_.Update(data.data(), data.size());
+    } else if (checksum_type_ == ChecksumType::kCrc16Ccitt) {
+      crc16_.Update(data.data(), data.size());
+    }
+  }
+
+  /**
+   * @brief         Function to get the checksum of all data passed so far
+   * @return        The checksum, zero if none is requested
+   */
+  std::uint32_t GetValue() const noexcept {
+    std::uint32_t value{0U};
+    if (checksum_type_ == ChecksumType::kCrc32) {
+      value = crc32_.GetValue();
+    } else if (checksum_type_ == ChecksumType::kCrc16Ccitt) {
+      value = crc16_.GetValue();
+    }
+    return value;
+  }
+
+ private:
+  /**
+   * @brief         Store the checksum calculated
+   */
+  ChecksumType checksum_type_;
+
+  /**
+   * @brief         Store the CRC-32 calculation
+   */
+  utility::checksum::Crc32 crc32_;
+
+  /**
+   * @brief         Store the CRC-16 calculation
+   */
+  utility::checksum::Crc16Ccitt crc16_;
+};
+
+FlashEngine::FlashEngine(conversation::DmConversation &conversation) noexcept
+    : conversation_{conversation},
+      framing_executor_{} {}
+
+auto FlashEngine::Download(DownloadRequestType const &download_request,
+                           BlockHandler const &block_handler) noexcept -> DownloadResult {
+  DownloadResult result{DownloadResult::FromError(DownloadError::kImageNotAvailable)};
+  std::chrono::steady_clock::time_point const download_start{std::chrono::steady_clock::now()};
+  // map and validate the image, segment data is decoded on demand while framing the blocks
+  core_type::Result<boost_support::file::ImageFile, boost_support::file::ImageFileErrorCode>
+      image_result{boost_support::file::ImageFile::Open(download_request.image_path,
+                                                        download_request.memory_address)};
+  if (!image_result.HasValue()) {
+    if (image_result.Error() != boost_support::file::ImageFileErrorCode::kOpenFailed) {
+      result.EmplaceError(DownloadError::kImageInvalid);
+    }
+    return result;
+  }
+  boost_support::file::ImageFile const &image{image_result.Value()};
+  if (image.GetSegments().empty()) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&download_request](std::stringstream &msg) {
+          msg << "Image <" << download_request.image_path << "> contains no data";
+        });
+    result.EmplaceError(DownloadError::kInvalidParameter);
+    return result;
+  }
+
+  DownloadResponseType download_response{};
+  for (boost_support::file::ImageSegment const &segment: image.GetSegments()) {
+    std::optional<DownloadError> const error{
+        DownloadSegment(download_request, image, segment, block_handler, download_response)};
+    if (error.has_value()) {
+      result.EmplaceError(error.value());
+      return result;
+    }
+  }
+
+  download_response.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - download_start);
+  logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+      FILE_NAME, __LINE__, __func__,
+      [&download_response, &image](std::stringstream &msg) {
+        msg << "Downloaded " << download_response.transferred_length << " bytes of "
+            << image.GetSegments().size() << " segments in "
+            << download_response.block_timings.size() << " blocks within "
+            << download_response.duration.count() << " microseconds";
+      });
+  result.EmplaceValue(std::move(download_response));
+  return result;
+}
+
+auto FlashEngine::DownloadSegment(DownloadRequestType const &download_request,
+                                  boost_support::file::ImageFile const &image,
+                                  boost_support::file::ImageSegment const &segment,
+                                  BlockHandler const &block_handler,
+                                  DownloadResponseType &download_response) noexcept
+    -> std::optional<DownloadError> {
+  ::uds_transport::ByteVector request_download{};
+  if (!CreateRequestDownload(download_request, segment.address, segment.length,
+                             request_download)) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&download_request, &segment](std::stringstream &msg) {
+          msg << "Segment at address 0x" << std::hex << segment.address << " of <"
+              << download_request.image_path
+              << "> not representable with address and length format identifier 0x"
+              << static_cast<std::uint32_t>(download_request.address_and_length_format_identifier);
+        });
+    return DownloadError::kInvalidParameter;
+  }
+
+  conversation::DiagClientConversation::DiagResult const request_download_result{
+      conversation_.SendDiagnosticPayload(std::move(request_download))};
+  download_response.max_number_of_block_length =
+      ParseMaxNumberOfBlockLength(GetResponse(request_download_result));
+  if (download_response.max_number_of_block_length <= kTransferDataHeaderLength) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__,
+        [](std::stringstream &msg) { msg << "RequestDownload not accepted by server"; });
+    return DownloadError::kRequestDownloadFailed;
+  }
+
+  boost_support::file::ImageFile::SegmentReader segment_reader{image.GetSegmentReader(segment)};
+  ChecksumCalculator checksum{download_request.checksum_type};
+  if (!TransferData(segment_reader,
+                    download_response.max_number_of_block_length - kTransferDataHeaderLength,
+                    checksum, block_handler, download_response)) {
+    return DownloadError::kTransferDataFailed;
+  }
+  if (download_request.checksum_type != ChecksumType::kNone) {
+    download_response.segment_checksums.emplace_back(
+        SegmentChecksum{segment.address, segment.length, checksum.GetValue()});
+  }
+
+  conversation::DiagClientConversation::DiagResult const request_transfer_exit_result{
+      conversation_.SendDiagnosticPayload(::uds_transport::ByteVector{kRequestTransferExit})};
+  if (!IsPositiveResponse(GetResponse(request_transfer_exit_result), kRequestTransferExit)) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__,
+        [](std::stringstream &msg) { msg << "RequestTransferExit not accepted by server"; });
+    return DownloadError::kRequestTransferExitFailed;
+  }
+  return std::nullopt;
+}
+
+bool FlashEngine::CreateRequestDownload(DownloadRequestType const &download_request,
+                                        std::uint64_t memory_address, std::size_t memory_size,
+                                        ::uds_transport::ByteVector &request) noexcept {
+  std::uint8_t const address_length{
+      static_cast<std::uint8_t>(download_request.address_and_length_format_identifier & 0x0FU)};
+  std::uint8_t const size_length{
+      static_cast<std::uint8_t>(download_request.address_and_length_format_identifier >> 4U)};
+  bool is_valid{(address_length != 0U) && (address_length <= kMaxParameterLength) &&
+                (size_length != 0U) && (size_length <= kMaxParameterLength)};
+  if (is_valid) {
+    request.clear();
+    request.reserve(3U + address_length + size_length);
+    request.emplace_back(kRequestDownload);
+    request.emplace_back(download_request.data_format_identifier);
+    request.emplace_back(download_request.address_and_length_format_identifier);
+    is_valid = AppendBigEndian(memory_address, address_length, request) &&
+               AppendBigEndian(memory_size, size_length, request);
+  }
+  return is_valid;
+}
+
+std::size_t FlashEngine::ParseMaxNumberOfBlockLength(
+    core_type::Span<std::uint8_t const> response) noexcept {
+  std::size_t max_number_of_block_length{0U};
+  // response = 0x74, lengthFormatIdentifier, maxNumberOfBlockLength
+  if (IsPositiveResponse(response, kRequestDownload) && (response.size() >= 2U)) {
+    std::size_t const length{static_cast<std::size_t>(response[1U] >> 4U)};
+    if ((length != 0U) && (length <= sizeof(std::size_t)) && (response.size() >= (2U + length))) {
+      for (std::uint8_t const byte: response.subspan(2U, length)) {
+        max_number_of_block_length = (max_number_of_block_length << 8U) | byte;
+      }
+    }
+  }
+  return max_number_of_block_length;
+}
+
+::uds_transport::ByteVector FlashEngine::CreateTransferData(
+    std::uint8_t block_sequence_counter, core_type::Span<std::uint8_t const> block) noexcept {
+  ::uds_transport::ByteVector request{};
+  request.reserve(kTransferDataHeaderLength + block.size());
+  request.emplace_back(kTransferData);
+  request.emplace_back(block_sequence_counter);
+  request.insert(request.end(), block.begin(), block.end());
+  return request;
+}
+
+std::future<::uds_transport::ByteVector> FlashEngine::FrameBlock(
+    std::uint8_t block_sequence_counter,
+    boost_support::file::ImageFile::SegmentReader &segment_reader,
+    std::size_t max_block_data_length, ChecksumCalculator &checksum) noexcept {
+  // std::function requires copyable callable, share the task with the executor job
+  std::shared_ptr<std::packaged_task<::uds_transport::ByteVector()>> framing_task{
+      std::make_shared<std::packaged_task<::uds_transport::ByteVector()>>(
+          [block_sequence_counter, &segment_reader, max_block_data_length, &checksum]() {
+            core_type::Span<std::uint8_t const> const block{
+                segment_reader.Read(max_block_data_length)};
+            // checksum the block while it is hot in cache from decoding, before it is copied
+            checksum.Update(block);
+            return CreateTransferData(block_sequence_counter, block);
+          })};
+  std::future<::uds_transport::ByteVector> framed_block{framing_task->get_future()};
+  framing_executor_.AddExecute([framing_task]() { (*framing_task)(); });
+  return framed_block;
+}
+
+bool FlashEngine::TransferData(boost_support::file::ImageFile::SegmentReader &segment_reader,
+                               std::size_t max_block_data_length,
+                               ChecksumCalculator &checksum, BlockHandler const &block_handler,
+                               DownloadResponseType &download_response) noexcept {
+  std::size_t const number_of_blocks{
+      (segment_reader.GetRemainingLength() + max_block_data_length - 1U) / max_block_data_length};
+  download_response.block_timings.reserve(download_response.block_timings.size() +
+                                          number_of_blocks);
+  // block sequence counter starts with 0x01 after every RequestDownload and wraps from 0xFF to 0x00
+  std::uint8_t block_sequence_counter{0x01U};
+  std::future<::uds_transport::ByteVector> next_block{
+      FrameBlock(block_sequence_counter, segment_reader, max_block_data_length, checksum)};
+  bool is_transferred{true};
+  bool is_block_pending{true};
+  while (is_transferred && is_block_pending) {
+    ::uds_transport::ByteVector transfer_data{next_block.get()};
+    std::size_t const block_length{transfer_data.size() - kTransferDataHeaderLength};
+    if (block_length == 0U) {
+      // the segment ended before its announced length
+      is_transferred = false;
+      break;
+    }
+    // frame the following block while this one is on the network
+    is_block_pending = segment_reader.GetRemainingLength() != 0U;
+    if (is_block_pending) {
+      next_block = FrameBlock(static_cast<std::uint8_t>(block_sequence_counter + 1U),
+                              segment_reader, max_block_data_length, checksum);
+    }
+    std::chrono::steady_clock::time_point const block_start{std::chrono::steady_clock::now()};
+    conversation::DiagClientConversation::DiagResult const transfer_data_result{
+        conversation_.SendDiagnosticPayload(std::move(transfer_data))};
+    core_type::Span<std::uint8_t const> const response{GetResponse(transfer_data_result)};
+    // response = 0x76, blockSequenceCounter
+    if (IsPositiveResponse(response, kTransferData) && (response.size() >= 2U) &&
+        (response[1U] == block_sequence_counter)) {
+      download_response.block_timings.emplace_back(BlockTiming{
+          block_sequence_counter, block_length,
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                block_start)});
+      download_response.transferred_length += block_length;
+      if (block_handler) { block_handler(download_response.block_timings.back()); }
+      ++block_sequence_counter;
+    } else {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [block_sequence_counter](std::stringstream &msg) {
+            msg << "TransferData of block 0x" << std::hex
+                << static_cast<std::uint32_t>(block_sequence_counter)
+                << " not accepted by server";
+          });
+      is_transferred = false;
+    }
+  }
+  // the framing job refers to the segment reader, it must be finished before the reader is destroyed
+  if (next_block.valid()) { next_block.wait(); }
+  return is_transferred;
+}
+
+}  // namespace flash
+}  // namespace client
+}  // namespace diag
@@ -0,0 +1,210 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ENGINE_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ENGINE_H
+/* includes */
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <optional>
+
+#include "boost-support/file/image_file.h"
+#include "core/include/span.h"
+#include "diag-client/diagnostic_client_conversation.h"
+#include "diag-client/diagnostic_client_flash_message_type.h"
+#include "uds_transport/protocol_types.h"
+#include "utility/executor.h"
+
+namespace diag {
+namespace client {
+// forward declaration
+namespace conversation {
+class DmConversation;
+}  // namespace conversation
+
+namespace flash {
+
+/**
+ * @brief    Class to download an image into the memory of the Diagnostic Server
+ * @details  The TransferData request of the next block is framed on the engine executor while the current block
+ *           is transferred, so that reading the image overlaps with waiting on the network. The requested checksum
+ *           is calculated over each block while it is framed
+ */
+class FlashEngine final {
+ public:
+  /**
+   * @brief         Type alias for Download errors
+   */
+  using DownloadError = conversation::DiagClientConversation::DownloadError;
+
+  /**
+   * @brief         Type alias for Download result
+   */
+  using DownloadResult = Result<DownloadResponseType, DownloadError>;
+
+  /**
+   * @brief         Type alias for executor framing blocks
+   */
+  using FramingExecutor = utility::executor::Executor<std::function<void()>>;
+
+  /**
+   * @brief         Type alias for handler notified after every block answered positively
+   */
+  using BlockHandler = std::function<void(BlockTiming const &)>;
+
+ public:
+  /**
+   * @brief         Constructs an instance of FlashEngine
+   * @param[in]     conversation
+   *                The reference to dm conversation used for transmission
+   */
+  explicit FlashEngine(conversation::DmConversation &conversation) noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  FlashEngine(const FlashEngine &other) noexcept = delete;
+  FlashEngine &operator=(const FlashEngine &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  FlashEngine(FlashEngine &&other) noexcept = delete;
+  FlashEngine &operator=(FlashEngine &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of FlashEngine
+   */
+  ~FlashEngine() noexcept = default;
+
+  /**
+   * @brief         Function to download an image with RequestDownload, TransferData and RequestTransferExit
+   * @details       Every segment of the image is downloaded with its own RequestDownload
+   * @param[in]     download_request
+   *                The download parameters
+   * @param[in]     block_handler
+   *                The handler notified after every block transferred, may be empty
+   * @return        The download result on success, DownloadError in case of error
+   */
+  DownloadResult Download(DownloadRequestType const &download_request,
+                          BlockHandler const &block_handler) noexcept;
+
+  /**
+   * @brief         Function to create the RequestDownload request
+   * @param[in]     download_request
+   *                The download parameters
+   * @param[in]     memory_address
+   *                The start address of memory downloaded to
+   * @param[in]     memory_size
+   *                The number of bytes downloaded
+   * @param[out]    request
+   *                The request created
+   * @return        True if the address and size are representable as requested, otherwise False
+   */
+  static bool CreateRequestDownload(DownloadRequestType const &download_request,
+                                    std::uint64_t memory_address, std::size_t memory_size,
+                                    ::uds_transport::ByteVector &request) noexcept;
+
+  /**
+   * @brief         Function to parse the maxNumberOfBlockLength of RequestDownload positive response
+   * @param[in]     response
+   *                The RequestDownload response starting from SID
+   * @return        The maximum length of TransferData request, zero if response is not valid
+   */
+  static std::size_t ParseMaxNumberOfBlockLength(
+      core_type::Span<std::uint8_t const> response) noexcept;
+
+  /**
+   * @brief         Function to create the TransferData request of a block
+   * @param[in]     block_sequence_counter
+   *                The block sequence counter
+   * @param[in]     block
+   *                The image bytes of the block
+   * @return        The request created
+   */
+  static ::uds_transport::ByteVector CreateTransferData(
+      std::uint8_t block_sequence_counter, core_type::Span<std::uint8_t const> block) noexcept;
+
+ private:
+  /**
+   * @brief         Forward declaration of checksum calculated while framing
+   */
+  class ChecksumCalculator;
+
+  /**
+   * @brief         Function to download a single segment with RequestDownload, TransferData and RequestTransferExit
+   * @param[in]     download_request
+   *                The download parameters
+   * @param[in]     image
+   *                The image containing the segment
+   * @param[in]     segment
+   *                The segment downloaded
+   * @param[in]     block_handler
+   *                The handler notified after every block transferred, may be empty
+   * @param[in,out] download_response
+   *                The download response getting the block timings
+   * @return        Nothing on success, DownloadError in case of error
+   */
+  std::optional<DownloadError> DownloadSegment(DownloadRequestType const &download_request,
+                                               boost_support::file::ImageFile const &image,
+                                               boost_support::file::ImageSegment const &segment,
+                                               BlockHandler const &block_handler,
+                                               DownloadResponseType &download_response) noexcept;
+
+  /**
+   * @brief         Function to frame a block on the executor
+   * @param[in]     block_sequence_counter
+   *                The block sequence counter
+   * @param[in]     segment_reader
+   *                The reader of the segment, must be valid until the future is ready
+   * @param[in]     max_block_data_length
+   *                The maximum number of image bytes of the block
+   * @param[in,out] checksum
+   *                The checksum updated with the image bytes, must be valid until the future is ready
+   * @return        The future holding the framed request
+   */
+  std::future<::uds_transport::ByteVector> FrameBlock(
+      std::uint8_t block_sequence_counter,
+      boost_support::file::ImageFile::SegmentReader &segment_reader,
+      std::size_t max_block_data_length, ChecksumCalculator &checksum) noexcept;
+
+  /**
+   * @brief         Function to transfer a segment in blocks
+   * @param[in]     segment_reader
+   *                The reader of the segment
+   * @param[in]     max_block_data_length
+   *                The number of image bytes per block
+   * @param[in,out] checksum
+   *                The checksum updated with the image bytes
+   * @param[in]     block_handler
+   *                The handler notified after every block transferred, may be empty
+   * @param[in,out] download_response
+   *                The download response getting the block timings
+   * @return        True if all blocks are answered positively, otherwise False
+   */
+  bool TransferData(boost_support::file::ImageFile::SegmentReader &segment_reader,
+                    std::size_t max_block_data_length, ChecksumCalculator &checksum,
+                    BlockHandler const &block_handler,
+                    DownloadResponseType &download_response) noexcept;
+
+  /**
+   * @brief         Store the reference to dm conversation
+   */
+  conversation::DmConversation &conversation_;
+
+  /**
+   * @brief         Store the executor framing the next block, declared last to be destroyed first
+   */
+  FramingExecutor framing_executor_;
+};
+
+}  // namespace flash
+}  // namespace client
+}  // namespace diag
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ENGINE_H
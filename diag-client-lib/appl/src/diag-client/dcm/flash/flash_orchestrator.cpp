@@ -0,0 +1,295 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "diag-client/dcm/flash/flash_orchestrator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "boost-support/file/image_file.h"
+#include "diag-client/common/logger.h"
+#include "diag-client/dcm/conversation/conversation_manager.h"
+#include "diag-client/dcm/conversation/dm_conversation.h"
+#include "diag-client/dcm/flash/flash_engine.h"
+#include "utility/thread.h"
+
+namespace diag {
+namespace client {
+namespace flash {
+namespace {
+
+/**
+ * @brief  Service identifier of DiagnosticSessionControl
+ */
+constexpr std::uint8_t kDiagnosticSessionControl{0x10U};
+
+/**
+ * @brief  Service identifier of SecurityAccess
+ */
+constexpr std::uint8_t kSecurityAccess{0x27U};
+
+/**
+ * @brief       Function to get the number of data bytes of an image
+ * @param[in]   download_request
+ *              The download request naming the image
+ * @return      The length of image data, zero if not available
+ */
+std::size_t GetImageLength(DownloadRequestType const &download_request) noexcept {
+  core_type::Result<boost_support::file::ImageFile, boost_support::file::ImageFileErrorCode> const
+      image_result{boost_support::file::ImageFile::Open(download_request.image_path,
+                                                        download_request.memory_address)};
+  return image_result.HasValue() ? image_result.Value().GetLength() : 0U;
+}
+
+}  // namespace
+
+FlashOrchestrator::FlashOrchestrator(conversation_manager::ConversationManager &conversation_mgr,
+                                     FlashRequestType flash_request,
+                                     FlashProgressHandler progress_handler) noexcept
+    : conversation_mgr_{conversation_mgr},
+      flash_request_{std::move(flash_request)},
+      progress_handler_{std::move(progress_handler)},
+      ecu_states_{},
+      progress_{},
+      ecu_started_(flash_request_.ecu_requests.size(), false),
+      gateway_sessions_{},
+      bus_sessions_{},
+      state_lock_{},
+      state_cond_var_{},
+      progress_lock_{} {
+  ecu_states_.reserve(flash_request_.ecu_requests.size());
+  for (EcuFlashRequest const &ecu_request: flash_request_.ecu_requests) {
+    EcuFlashState ecu_state{};
+    ecu_state.ecu_name = ecu_request.ecu_name;
+    ecu_state.image_length = GetImageLength(ecu_request.download_request);
+    progress_.total_length += ecu_state.image_length;
+    ecu_states_.emplace_back(std::move(ecu_state));
+  }
+  progress_.number_of_ecus = ecu_states_.size();
+}
+
+auto FlashOrchestrator::Flash() noexcept -> FlashResult {
+  FlashResult result{FlashResult::FromError(FlashError::kInvalidParameter)};
+  if (!IsRequestValid()) { return result; }
+
+  std::vector<std::unique_ptr<conversation::DmConversation>> conversations{};
+  conversations.reserve(flash_request_.conversation_names.size());
+  for (std::string const &conversation_name: flash_request_.conversation_names) {
+    std::unique_ptr<conversation::DmConversation> conversation{
+        conversation_mgr_.CreateDmConversation(conversation_name)};
+    if (conversation == nullptr) { return result; }
+    conversations.emplace_back(std::move(conversation));
+  }
+
+  std::chrono::steady_clock::time_point const flash_start{std::chrono::steady_clock::now()};
+  {
+    // threads are joined on leaving the scope
+    std::vector<utility::thread::Thread> flash_threads{};
+    flash_threads.reserve(conversations.size());
+    for (std::unique_ptr<conversation::DmConversation> &conversation: conversations) {
+      conversation->Startup();
+      flash_threads.emplace_back("FlashChannel",
+                                 [this, &conversation]() { RunConversation(*conversation); });
+    }
+  }
+  for (std::unique_ptr<conversation::DmConversation> &conversation: conversations) {
+    conversation->Shutdown();
+  }
+
+  FlashResponseType flash_response{};
+  flash_response.duration = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - flash_start);
+  logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+      FILE_NAME, __LINE__, __func__, [this, &flash_response](std::stringstream &msg) {
+        msg << "Flashed " << progress_.completed_ecus << " of " << progress_.number_of_ecus
+            << " ECUs within " << flash_response.duration.count() << " microseconds";
+      });
+  flash_response.ecu_states = std::move(ecu_states_);
+  result.EmplaceValue(std::move(flash_response));
+  return result;
+}
+
+bool FlashOrchestrator::IsRequestValid() const noexcept {
+  bool const is_security_key_required{
+      std::any_of(flash_request_.ecu_requests.begin(), flash_request_.ecu_requests.end(),
+                  [](EcuFlashRequest const &ecu_request) {
+                    return ecu_request.security_level.has_value();
+                  })};
+  bool const is_valid{!flash_request_.ecu_requests.empty() &&
+                      !flash_request_.conversation_names.empty() &&
+                      (flash_request_.max_sessions_per_gateway != 0U) &&
+                      (flash_request_.max_sessions_per_bus != 0U) &&
+                      (!is_security_key_required || flash_request_.security_key_handler)};
+  if (!is_valid) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+          msg << "Flash request requires ECUs, conversations, session limits above zero and a "
+                 "security key handler for ECUs requesting a security level";
+        });
+  }
+  return is_valid;
+}
+
+void FlashOrchestrator::RunConversation(conversation::DmConversation &conversation) noexcept {
+  for (std::optional<std::size_t> ecu_index{AcquireEcu()}; ecu_index.has_value();
+       ecu_index = AcquireEcu()) {
+    bool const is_flashed{FlashEcu(conversation, ecu_index.value())};
+    static_cast<void>(conversation.DisconnectFromDiagServer());
+    UpdateEcuState(ecu_index.value(), [this, is_flashed](EcuFlashState &ecu_state) {
+      ecu_state.phase = is_flashed ? FlashPhase::kCompleted : FlashPhase::kFailed;
+      --progress_.active_ecus;
+      if (is_flashed) {
+        ++progress_.completed_ecus;
+      } else {
+        ++progress_.failed_ecus;
+      }
+    });
+    ReleaseEcu(ecu_index.value());
+  }
+}
+
+std::optional<std::size_t> FlashOrchestrator::AcquireEcu() noexcept {
+  std::optional<std::size_t> ecu_index{};
+  std::unique_lock<std::mutex> lck{state_lock_};
+  bool is_ecu_pending{true};
+  state_cond_var_.wait(lck, [this, &ecu_index, &is_ecu_pending]() {
+    is_ecu_pending = false;
+    for (std::size_t index{0U}; index < ecu_started_.size(); ++index) {
+      if (!ecu_started_[index]) {
+        is_ecu_pending = true;
+        EcuFlashRequest const &ecu_request{flash_request_.ecu_requests[index]};
+        if ((gateway_sessions_[ecu_request.gateway_ip_address] <
+             flash_request_.max_sessions_per_gateway) &&
+            (bus_sessions_[BusKey{ecu_request.gateway_ip_address, ecu_request.bus_id}] <
+             flash_request_.max_sessions_per_bus)) {
+          ecu_index = index;
+          break;
+        }
+      }
+    }
+    return ecu_index.has_value() || !is_ecu_pending;
+  });
+  if (ecu_index.has_value()) {
+    EcuFlashRequest const &ecu_request{flash_request_.ecu_requests[ecu_index.value()]};
+    ecu_started_[ecu_index.value()] = true;
+    ++gateway_sessions_[ecu_request.gateway_ip_address];
+    ++bus_sessions_[BusKey{ecu_request.gateway_ip_address, ecu_request.bus_id}];
+  }
+  return ecu_index;
+}
+
+void FlashOrchestrator::ReleaseEcu(std::size_t ecu_index) noexcept {
+  {
+    std::lock_guard<std::mutex> const lck{state_lock_};
+    EcuFlashRequest const &ecu_request{flash_request_.ecu_requests[ecu_index]};
+    --gateway_sessions_[ecu_request.gateway_ip_address];
+    --bus_sessions_[BusKey{ecu_request.gateway_ip_address, ecu_request.bus_id}];
+  }
+  state_cond_var_.notify_all();
+}
+
+bool FlashOrchestrator::FlashEcu(conversation::DmConversation &conversation,
+                                 std::size_t ecu_index) noexcept {
+  EcuFlashRequest const &ecu_request{flash_request_.ecu_requests[ecu_index]};
+  auto const enter_phase{[this, ecu_index, &conversation](FlashPhase phase) {
+    UpdateEcuState(ecu_index, [this, phase, &conversation](EcuFlashState &ecu_state) {
+      if (phase == FlashPhase::kConnecting) { ++progress_.active_ecus; }
+      ecu_state.phase = phase;
+      ecu_state.session = conversation.GetActiveSession();
+      ecu_state.security = conversation.GetActiveSecurityLevel();
+    });
+  }};
+
+  enter_phase(FlashPhase::kConnecting);
+  if (conversation.ConnectToDiagServer(ecu_request.target_address,
+                                       ecu_request.gateway_ip_address) !=
+      conversation::DiagClientConversation::ConnectResult::kConnectSuccess) {
+    return false;
+  }
+
+  enter_phase(FlashPhase::kSessionControl);
+  static_cast<void>(conversation.SendDiagnosticPayload(::uds_transport::ByteVector{
+      kDiagnosticSessionControl, static_cast<std::uint8_t>(DiagnosticSession::kProgrammingSession)}));
+  if (conversation.GetActiveSession() != DiagnosticSession::kProgrammingSession) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&ecu_request](std::stringstream &msg) {
+          msg << "'" << ecu_request.ecu_name << "'-> Programming session not entered";
+        });
+    return false;
+  }
+
+  if (ecu_request.security_level.has_value()) {
+    enter_phase(FlashPhase::kSecurityAccess);
+    if (!UnlockSecurityLevel(conversation, ecu_request)) { return false; }
+  }
+
+  enter_phase(FlashPhase::kDownloading);
+  FlashEngine flash_engine{conversation};
+  FlashEngine::DownloadResult download_result{flash_engine.Download(
+      ecu_request.download_request, [this, ecu_index](BlockTiming const &block_timing) {
+        UpdateEcuState(ecu_index, [this, &block_timing](EcuFlashState &ecu_state) {
+          ecu_state.transferred_length += block_timing.block_length;
+          progress_.transferred_length += block_timing.block_length;
+        });
+      })};
+  if (!download_result.HasValue()) { return false; }
+  UpdateEcuState(ecu_index, [&download_result](EcuFlashState &ecu_state) {
+    ecu_state.download_response = std::move(download_result).Value();
+  });
+  return true;
+}
+
+bool FlashOrchestrator::UnlockSecurityLevel(conversation::DmConversation &conversation,
+                                            EcuFlashRequest const &ecu_request) noexcept {
+  std::uint8_t const request_seed{ecu_request.security_level.value()};
+  conversation::DiagClientConversation::DiagResult const seed_result{
+      conversation.SendDiagnosticPayload(::uds_transport::ByteVector{kSecurityAccess, request_seed})};
+  // a zero seed already unlocks the security level
+  if (seed_result.HasValue() &&
+      (conversation.GetActiveSecurityLevel() == SecurityState::kLocked)) {
+    // response = 0x67, requestSeed, securitySeed
+    ::uds_transport::ByteVector const &seed_response{seed_result.Value()->GetPayload()};
+    if (seed_response.size() > 2U) {
+      std::vector<std::uint8_t> const key{flash_request_.security_key_handler(
+          ecu_request, core_type::Span<std::uint8_t const>{seed_response}.subspan(2U))};
+      ::uds_transport::ByteVector send_key{kSecurityAccess,
+                                           static_cast<std::uint8_t>(request_seed + 1U)};
+      send_key.insert(send_key.end(), key.begin(), key.end());
+      static_cast<void>(conversation.SendDiagnosticPayload(std::move(send_key)));
+    }
+  }
+  bool const is_unlocked{conversation.GetActiveSecurityLevel() == SecurityState::kUnlocked};
+  if (!is_unlocked) {
+    logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&ecu_request, request_seed](std::stringstream &msg) {
+          msg << "'" << ecu_request.ecu_name << "'-> Security level 0x" << std::hex
+              << static_cast<std::uint32_t>(request_seed) << " not unlocked";
+        });
+  }
+  return is_unlocked;
+}
+
+template<typename Update>
+void FlashOrchestrator::UpdateEcuState(std::size_t ecu_index, Update &&update) noexcept {
+  // notifications are taken in the order of updates
+  std::lock_guard<std::mutex> const progress_lck{progress_lock_};
+  std::optional<std::pair<FlashProgress, EcuFlashState>> notification{};
+  {
+    std::lock_guard<std::mutex> const lck{state_lock_};
+    update(ecu_states_[ecu_index]);
+    if (progress_handler_) { notification.emplace(progress_, ecu_states_[ecu_index]); }
+  }
+  if (notification.has_value()) {
+    progress_handler_(notification.value().first, notification.value().second);
+  }
+}
+
+}  // namespace flash
+}  // namespace client
+}  // namespace diag
@@ -0,0 +1,213 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ORCHESTRATOR_H
+#define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ORCHESTRATOR_H
+/* includes */
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "diag-client/diagnostic_client.h"
+#include "diag-client/diagnostic_client_flash_message_type.h"
+
+namespace diag {
+namespace client {
+// forward declaration
+namespace conversation {
+class DmConversation;
+}  // namespace conversation
+
+namespace conversation_manager {
+class ConversationManager;
+}  // namespace conversation_manager
+
+namespace flash {
+
+/**
+ * @brief    Class to flash several ECUs concurrently through their DoIP gateways
+ * @details  Every conversation runs on its own thread and flashes one ECU after the other. An ECU is only started
+ *           while its gateway and its bus stay within the configured number of concurrent sessions, so that the
+ *           total flashing time approaches the time of the slowest ECU instead of the sum of all ECUs
+ */
+class FlashOrchestrator final {
+ public:
+  /**
+   * @brief         Type alias for Flash errors
+   */
+  using FlashError = DiagClient::FlashError;
+
+  /**
+   * @brief         Type alias for Flash result
+   */
+  using FlashResult = Result<FlashResponseType, FlashError>;
+
+ public:
+  /**
+   * @brief         Constructs an instance of FlashOrchestrator
+   * @param[in]     conversation_mgr
+   *                The reference to conversation manager creating the conversations
+   * @param[in]     flash_request
+   *                The ECUs flashed along with the limits
+   * @param[in]     progress_handler
+   *                The handler notified on progress, may be empty
+   */
+  FlashOrchestrator(conversation_manager::ConversationManager &conversation_mgr,
+                    FlashRequestType flash_request, FlashProgressHandler progress_handler) noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  FlashOrchestrator(const FlashOrchestrator &other) noexcept = delete;
+  FlashOrchestrator &operator=(const FlashOrchestrator &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  FlashOrchestrator(FlashOrchestrator &&other) noexcept = delete;
+  FlashOrchestrator &operator=(FlashOrchestrator &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of FlashOrchestrator
+   */
+  ~FlashOrchestrator() noexcept = default;
+
+  /**
+   * @brief         Function to flash all ECUs, blocks until every ECU is completed or failed
+   * @return        The state of every ECU, FlashError in case the request is invalid
+   */
+  FlashResult Flash() noexcept;
+
+ private:
+  /**
+   * @brief         Type alias for key of a bus behind a gateway
+   */
+  using BusKey = std::pair<std::string, std::uint16_t>;
+
+  /**
+   * @brief         Function to check the flash request
+   * @return        True if the request can be processed, otherwise False
+   */
+  bool IsRequestValid() const noexcept;
+
+  /**
+   * @brief         Function to flash ECUs one after the other on a conversation until none is left
+   * @param[in]     conversation
+   *                The conversation used for flashing
+   */
+  void RunConversation(conversation::DmConversation &conversation) noexcept;
+
+  /**
+   * @brief         Function to wait for the next ECU allowed to start within the limits
+   * @return        The index of the ECU, nothing if all ECUs are started
+   */
+  std::optional<std::size_t> AcquireEcu() noexcept;
+
+  /**
+   * @brief         Function to release the gateway and bus of a finished ECU
+   * @param[in]     ecu_index
+   *                The index of the ECU
+   */
+  void ReleaseEcu(std::size_t ecu_index) noexcept;
+
+  /**
+   * @brief         Function to flash a single ECU
+   * @param[in]     conversation
+   *                The conversation used for flashing
+   * @param[in]     ecu_index
+   *                The index of the ECU
+   * @return        True if the ECU is flashed, otherwise False
+   */
+  bool FlashEcu(conversation::DmConversation &conversation, std::size_t ecu_index) noexcept;
+
+  /**
+   * @brief         Function to unlock the requested security level with seed and key
+   * @param[in]     conversation
+   *                The conversation connected to the ECU
+   * @param[in]     ecu_request
+   *                The ECU parameters
+   * @return        True if the security level is unlocked, otherwise False
+   */
+  bool UnlockSecurityLevel(conversation::DmConversation &conversation,
+                           EcuFlashRequest const &ecu_request) noexcept;
+
+  /**
+   * @brief         Function to update the state of an ECU and notify the progress
+   * @param[in]     ecu_index
+   *                The index of the ECU
+   * @param[in]     update
+   *                The function updating the ECU state, called with state lock held
+   */
+  template<typename Update>
+  void UpdateEcuState(std::size_t ecu_index, Update &&update) noexcept;
+
+  /**
+   * @brief         Store the reference to conversation manager
+   */
+  conversation_manager::ConversationManager &conversation_mgr_;
+
+  /**
+   * @brief         Store the flash request
+   */
+  FlashRequestType flash_request_;
+
+  /**
+   * @brief         Store the progress handler
+   */
+  FlashProgressHandler progress_handler_;
+
+  /**
+   * @brief         Store the state of every ECU
+   */
+  std::vector<EcuFlashState> ecu_states_;
+
+  /**
+   * @brief         Store the progress aggregated over all ECUs
+   */
+  FlashProgress progress_;
+
+  /**
+   * @brief         Store whether an ECU is already started
+   */
+  std::vector<bool> ecu_started_;
+
+  /**
+   * @brief         Store the number of active sessions per gateway
+   */
+  std::map<std::string, std::size_t> gateway_sessions_;
+
+  /**
+   * @brief         Store the number of active sessions per bus
+   */
+  std::map<BusKey, std::size_t> bus_sessions_;
+
+  /**
+   * @brief         Mutex to protect the states and session counters
+   */
+  std::mutex state_lock_;
+
+  /**
+   * @brief         Conditional variable to wait for a gateway or bus getting free
+   */
+  std::condition_variable state_cond_var_;
+
+  /**
+   * @brief         Mutex to serialize the progress notifications
+   */
+  std::mutex progress_lock_;
+};
+
+}  // namespace flash
+}  // namespace client
+}  // namespace diag
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_FLASH_FLASH_ORCHESTRATOR_H
@@ -7,19 +7,21 @@
  */
 #include "dm_uds_message.h"
 
+#include <utility>
+
 namespace diag {
 namespace client {
 namespace uds_message {
 DmUdsMessage::DmUdsMessage(Address sa, Address ta, IpAddress host_ip_address,
-                           uds_transport::ByteVector &payload)
+                           uds_transport::ByteVector payload)
     : uds_transport::UdsMessage(),
       source_address_{sa},
       target_address_{ta},
       target_address_type_{TargetAddressType::kPhysical},
       host_ip_address_{host_ip_address},
-      uds_payload_{payload} {}
+      uds_payload_{std::move(payload)} {}
 
-DmUdsResponse::DmUdsResponse(ByteVector &payload) : uds_payload_{payload} {}
+DmUdsResponse::DmUdsResponse(ByteVector payload) : uds_payload_{std::move(payload)} {}
 
 }  // namespace uds_message
 }  // namespace client
@@ -20,7 +20,7 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
  public:
   // ctor
   DmUdsMessage(Address sa, Address ta, IpAddress host_ip_address,
-               uds_transport::ByteVector &payload);
+               uds_transport::ByteVector payload);
 
   // dtor
   ~DmUdsMessage() noexcept override = default;
@@ -38,8 +38,8 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
   // Host Ip Address
   std::string host_ip_address_;
 
-  // store only UDS payload to be sent
-  uds_transport::ByteVector &uds_payload_;
+  // store only UDS payload to be sent or received
+  uds_transport::ByteVector uds_payload_;
 
   // add new metaInfo to this message.
   void AddMetaInfo(std::shared_ptr<const MetaInfoMap>) override {
@@ -70,13 +70,13 @@ class DmUdsMessage final : public uds_transport::UdsMessage {
 
 class DmUdsResponse final : public UdsMessage {
  public:
-  explicit DmUdsResponse(ByteVector &payload);
+  explicit DmUdsResponse(ByteVector payload);
 
   ~DmUdsResponse() noexcept override = default;
 
  private:
-  // store only UDS payload to be sent
-  ByteVector &uds_payload_;
+  // store only UDS payload received, owned so that it stays valid after next request
+  ByteVector uds_payload_;
   // Host Ip Address
   IpAddress host_ip_address_;
 
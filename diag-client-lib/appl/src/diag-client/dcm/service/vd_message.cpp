@@ -33,12 +33,56 @@ VdMessage::VdMessage(std::uint8_t preselection_mode, uds_transport::ByteVector&
       host_ip_address_{host_ip_address},
       vehicle_info_payload_{SerializeVehicleInfoList(preselection_mode, preselection_value)} {}
 
+auto SerializeVehicleInfoSweep(std::uint32_t requests_per_second, std::uint16_t in_flight_window,
+                               std::chrono::milliseconds response_timeout,
+                               std::vector<std::string> const& target_addresses) noexcept
+    -> uds_transport::ByteVector {
+  constexpr std::uint8_t VehicleIdentificationSweepHandler{2U};
+  std::uint32_t const response_timeout_ms{static_cast<std::uint32_t>(response_timeout.count())};
+
+  uds_transport::ByteVector payload{
+      VehicleIdentificationSweepHandler,
+      static_cast<std::uint8_t>((requests_per_second & 0xFF000000U) >> 24U),
+      static_cast<std::uint8_t>((requests_per_second & 0x00FF0000U) >> 16U),
+      static_cast<std::uint8_t>((requests_per_second & 0x0000FF00U) >> 8U),
+      static_cast<std::uint8_t>(requests_per_second & 0x000000FFU),
+      static_cast<std::uint8_t>((in_flight_window & 0xFF00U) >> 8U),
+      static_cast<std::uint8_t>(in_flight_window & 0x00FFU),
+      static_cast<std::uint8_t>((response_timeout_ms & 0xFF000000U) >> 24U),
+      static_cast<std::uint8_t>((response_timeout_ms & 0x00FF0000U) >> 16U),
+      static_cast<std::uint8_t>((response_timeout_ms & 0x0000FF00U) >> 8U),
+      static_cast<std::uint8_t>(response_timeout_ms & 0x000000FFU)};
+  // every target address is prefixed with its length
+  for (std::string const& target_address: target_addresses) {
+    payload.emplace_back(static_cast<std::uint8_t>(target_address.size()));
+    payload.insert(payload.end(), target_address.begin(), target_address.end());
+  }
+  return payload;
+}
+
+VdMessage::VdMessage(std::uint32_t requests_per_second, std::uint16_t in_flight_window,
+                     std::chrono::milliseconds response_timeout,
+                     std::vector<std::string> const& target_addresses)
+    : uds_transport::UdsMessage(),
+      source_address_{0U},
+      target_address_{0U},
+      target_address_type{TargetAddressType::kPhysical},
+      host_ip_address_{},
+      vehicle_info_payload_{SerializeVehicleInfoSweep(requests_per_second, in_flight_window,
+                                                      response_timeout, target_addresses)} {}
+
 VdMessage::VdMessage() noexcept
     : uds_transport::UdsMessage(),
       source_address_{0U},
       target_address_{0U},
       target_address_type{TargetAddressType::kPhysical} {}
 
+VdMessage::VdMessage(TargetAddressType target_address_type) noexcept
+    : uds_transport::UdsMessage(),
+      source_address_{0U},
+      target_address_{0U},
+      target_address_type{target_address_type} {}
+
 }  // namespace vd_message
 }  // namespace client
 }  // namespace diag
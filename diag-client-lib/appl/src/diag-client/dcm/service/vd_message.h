@@ -8,6 +8,10 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_SERVICE_VD_MESSAGE_H
 #define DIAGNOSTIC_CLIENT_LIB_APPL_SRC_DCM_SERVICE_VD_MESSAGE_H
 /* includes */
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include "diag-client/diagnostic_client_uds_message_type.h"
 #include "diag-client/diagnostic_client_vehicle_info_message_type.h"
 #include "uds_transport/uds_message.h"
@@ -22,9 +26,16 @@ class VdMessage final : public uds_transport::UdsMessage {
   VdMessage(std::uint8_t preselection_mode, uds_transport::ByteVector& preselection_value,
             std::string_view host_ip_address);
 
+  // ctor of unicast vehicle identification sweep over the target addresses
+  VdMessage(std::uint32_t requests_per_second, std::uint16_t in_flight_window,
+            std::chrono::milliseconds response_timeout, std::vector<std::string> const& target_addresses);
+
   // default ctor
   VdMessage() noexcept;
 
+  // ctor of received message, functional for vehicle announcements
+  explicit VdMessage(TargetAddressType target_address_type) noexcept;
+
   // dtor
   ~VdMessage() noexcept override = default;
 
@@ -9,15 +9,19 @@
 
 #include <pthread.h>
 
+#include <chrono>
 #include <memory>
 #include <string>
 
+#include "boost-support/client/io_thread_pool.h"
+#include "boost-support/client/tcp/tcp_client.h"
 #include "boost-support/parser/json_parser.h"
 #include "core/include/result.h"
 #include "diag-client/common/diagnostic_manager.h"
 #include "diag-client/common/logger.h"
 #include "diag-client/dcm/dcm_client.h"
 #include "diag-client/dcm/error_domain/dm_error_domain.h"
+#include "utility/logger.h"
 #include "utility/thread.h"
 
 namespace diag {
@@ -71,9 +75,21 @@ class DiagClient::DiagClientImpl final {
     // read configuration
     return boost_support::parser::Read(diag_client_config_path_)
         .AndThen([this](boost_support::parser::boost_tree config) {
+          config_parser::DcmClientConfig dcm_client_config{
+              config_parser::ReadDcmClientConfig(config)};
+          utility::logger::Logger::SetLogLevel(dcm_client_config.log_level);
+          if (!dcm_client_config.log_file.empty()) {
+            utility::logger::LogSink::GetLogSink().SetOutput(utility::logger::LogOutput::kFile,
+                                                             dcm_client_config.log_file);
+          }
+          // Size the shared io thread pool before any connection is created
+          boost_support::client::SetIoThreadCount(dcm_client_config.io_thread_count);
+          // Probe liveness of all tcp connections created afterwards
+          boost_support::client::tcp::SetLivenessTimeout(
+              std::chrono::milliseconds{dcm_client_config.liveness_timeout});
           // Create single dcm instance and pass the configuration
-          dcm_instance_ = std::make_unique<diag::client::dcm::DCMClient>(
-              config_parser::ReadDcmClientConfig(config));
+          dcm_instance_ =
+              std::make_unique<diag::client::dcm::DCMClient>(std::move(dcm_client_config));
           // Start dcm client main thread
           dcm_thread_ = utility::thread::Thread{"DcmClientMain",
                                                 [this]() noexcept { dcm_instance_->Main(); }};
@@ -135,18 +151,95 @@ class DiagClient::DiagClientImpl final {
    * @brief       Function to send vehicle identification request and get the Diagnostic Server list
    * @param[in]   vehicle_info_request
    *              Vehicle information sent along with request
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
    * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
    * @implements  DiagClientLib-VehicleDiscovery
    */
   Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
   SendVehicleIdentificationRequest(
-      diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept {
+      diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+      vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
     if (!dcm_instance_) {
       logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatalAndTerminate(
           FILE_NAME, __LINE__, "",
           [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
     }
-    return dcm_instance_->SendVehicleIdentificationRequest(std::move(vehicle_info_request));
+    return dcm_instance_->SendVehicleIdentificationRequest(std::move(vehicle_info_request),
+                                                           std::move(response_handler));
+  }
+
+  /**
+   * @brief       Function to send a unicast vehicle identification request to every target
+   * @param[in]   sweep_request
+   *              The target addresses or IPv4 networks along with rate, window and timeout
+   * @param[in]   response_handler
+   *              The handler notified for every DoIP entity responding, may be empty
+   * @return      Result containing available vehicle information response on success, VehicleResponseErrorCode on error
+   * @implements  DiagClientLib-VehicleDiscovery
+   */
+  Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
+  SendVehicleIdentificationSweep(vehicle_info::VehicleInfoSweepRequestType sweep_request,
+                                 vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatalAndTerminate(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+    }
+    return dcm_instance_->SendVehicleIdentificationSweep(std::move(sweep_request),
+                                                         std::move(response_handler));
+  }
+
+  /**
+   * @brief       Function to flash several ECUs concurrently
+   * @param[in]   flash_request
+   *              The ECUs flashed along with conversations and limits
+   * @param[in]   progress_handler
+   *              The handler notified on every state change and transferred block, may be empty
+   * @return      Result containing the state of every ECU on success, FlashError on error
+   * @implements  DiagClientLib-Flash-Orchestration
+   */
+  Result<flash::FlashResponseType, DiagClient::FlashError> SendFlashRequest(
+      flash::FlashRequestType flash_request, flash::FlashProgressHandler progress_handler) noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatalAndTerminate(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+    }
+    return dcm_instance_->SendFlashRequest(std::move(flash_request), std::move(progress_handler));
+  }
+
+  /**
+   * @brief       Function to get the DoIP entities known from vehicle announcements and identification responses
+   * @param[in]   filter
+   *              The keys matched
+   * @return      The matching DoIP entities
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  vehicle_info::VehicleEntityListType GetVehicleEntities(
+      vehicle_info::VehicleEntityFilter const &filter) const noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatalAndTerminate(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+    }
+    return dcm_instance_->GetVehicleEntities(filter);
+  }
+
+  /**
+   * @brief       Function to set the handler notified when a known DoIP entity is added or changed
+   * @param[in]   change_handler
+   *              The handler to be set, empty to stop notifications
+   * @implements  DiagClientLib-VehicleEntityRegistry
+   */
+  void SetVehicleEntityChangeHandler(
+      vehicle_info::VehicleEntityChangeHandler change_handler) noexcept {
+    if (!dcm_instance_) {
+      logger::DiagClientLogger::GetDiagClientLogger().GetLogger().LogFatalAndTerminate(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "DiagClient is not Initialized"; });
+    }
+    dcm_instance_->SetVehicleEntityChangeHandler(std::move(change_handler));
   }
 
  private:
@@ -178,7 +271,33 @@ Result<void> DiagClient::DeInitialize() noexcept { return diag_client_impl_->DeI
 Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
 DiagClient::SendVehicleIdentificationRequest(
     diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request) noexcept {
-  return diag_client_impl_->SendVehicleIdentificationRequest(std::move(vehicle_info_request));
+  return diag_client_impl_->SendVehicleIdentificationRequest(std::move(vehicle_info_request), {});
+}
+
+Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
+DiagClient::SendVehicleIdentificationRequest(
+    diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+  return diag_client_impl_->SendVehicleIdentificationRequest(std::move(vehicle_info_request),
+                                                             std::move(response_handler));
+}
+
+Result<vehicle_info::VehicleInfoMessageResponseUniquePtr, DiagClient::VehicleInfoResponseError>
+DiagClient::SendVehicleIdentificationSweep(
+    vehicle_info::VehicleInfoSweepRequestType sweep_request,
+    vehicle_info::VehicleInfoResponseHandler response_handler) noexcept {
+  return diag_client_impl_->SendVehicleIdentificationSweep(std::move(sweep_request),
+                                                           std::move(response_handler));
+}
+
+vehicle_info::VehicleEntityListType DiagClient::GetVehicleEntities(
+    vehicle_info::VehicleEntityFilter const &filter) const noexcept {
+  return diag_client_impl_->GetVehicleEntities(filter);
+}
+
+void DiagClient::SetVehicleEntityChangeHandler(
+    vehicle_info::VehicleEntityChangeHandler change_handler) noexcept {
+  diag_client_impl_->SetVehicleEntityChangeHandler(std::move(change_handler));
 }
 
 conversation::DiagClientConversation DiagClient::GetDiagnosticClientConversation(
@@ -186,6 +305,11 @@ conversation::DiagClientConversation DiagClient::GetDiagnosticClientConversation
   return diag_client_impl_->GetDiagnosticClientConversation(conversation_name);
 }
 
+Result<flash::FlashResponseType, DiagClient::FlashError> DiagClient::SendFlashRequest(
+    flash::FlashRequestType flash_request, flash::FlashProgressHandler progress_handler) noexcept {
+  return diag_client_impl_->SendFlashRequest(std::move(flash_request), std::move(progress_handler));
+}
+
 std::unique_ptr<DiagClient> CreateDiagnosticClient(std::string_view diag_client_config_path) {
   return (std::make_unique<DiagClient>(diag_client_config_path));
 }
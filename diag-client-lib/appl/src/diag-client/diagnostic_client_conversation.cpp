@@ -81,6 +81,64 @@ class DiagClientConversation::DiagClientConversationImpl final {
     return internal_conversation_.SendDiagnosticRequest(std::move(message));
   }
 
+  /**
+   * @brief         Function to send Diagnostic Request without blocking the caller
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @param[in]     response_handler
+   *                The handler invoked with the diagnostic result
+   */
+  void SendDiagnosticRequestAsync(uds_message::UdsRequestMessageConstPtr message,
+                                  DiagResponseHandler response_handler) noexcept {
+    internal_conversation_.SendDiagnosticRequestAsync(std::move(message),
+                                                      std::move(response_handler));
+  }
+
+  /**
+   * @brief         Function to send Diagnostic Request and get the Diagnostic Response via future
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @return        std::future<DiagResult>
+   *                The future holding the diagnostic result
+   */
+  std::future<DiagResult> SendDiagnosticRequestAsync(
+      uds_message::UdsRequestMessageConstPtr message) noexcept {
+    // promise is shared with the handler, as std::function requires copyable callable
+    std::shared_ptr<std::promise<DiagResult>> diag_result_promise{
+        std::make_shared<std::promise<DiagResult>>()};
+    std::future<DiagResult> diag_result_future{diag_result_promise->get_future()};
+    internal_conversation_.SendDiagnosticRequestAsync(
+        std::move(message), [diag_result_promise](DiagResult diag_result) {
+          diag_result_promise->set_value(std::move(diag_result));
+        });
+    return diag_result_future;
+  }
+
+  /**
+   * @brief         Function to send Diagnostic Request and stream the Diagnostic Response to a sink
+   * @param[in]     message
+   *                The diagnostic request message wrapped in a unique pointer
+   * @param[in]     response_sink
+   *                The sink receiving the chunks of the diagnostic response
+   * @return        Empty result on success, DiagError in case of error
+   */
+  Result<void, DiagError> SendDiagnosticRequest(uds_message::UdsRequestMessageConstPtr message,
+                                                DiagResponseSink response_sink) noexcept {
+    return internal_conversation_.SendDiagnosticRequest(std::move(message),
+                                                        std::move(response_sink));
+  }
+
+  /**
+   * @brief         Function to download an image into the memory of the Diagnostic Server
+   * @param[in]     download_request
+   *                The download parameters
+   * @return        The download result on success, DownloadError in case of error
+   */
+  Result<flash::DownloadResponseType, DownloadError> SendDownloadRequest(
+      flash::DownloadRequestType const &download_request) noexcept {
+    return internal_conversation_.SendDownloadRequest(download_request);
+  }
+
  private:
   /**
    * @brief         Reference to valid conversation created
@@ -114,6 +172,31 @@ DiagClientConversation::SendDiagnosticRequest(
   return diag_client_conversation_impl_->SendDiagnosticRequest(std::move(message));
 }
 
+void DiagClientConversation::SendDiagnosticRequestAsync(
+    uds_message::UdsRequestMessageConstPtr message,
+    DiagClientConversation::DiagResponseHandler response_handler) noexcept {
+  diag_client_conversation_impl_->SendDiagnosticRequestAsync(std::move(message),
+                                                             std::move(response_handler));
+}
+
+std::future<DiagClientConversation::DiagResult> DiagClientConversation::SendDiagnosticRequestAsync(
+    uds_message::UdsRequestMessageConstPtr message) noexcept {
+  return diag_client_conversation_impl_->SendDiagnosticRequestAsync(std::move(message));
+}
+
+Result<void, DiagClientConversation::DiagError> DiagClientConversation::SendDiagnosticRequest(
+    uds_message::UdsRequestMessageConstPtr message,
+    DiagClientConversation::DiagResponseSink response_sink) noexcept {
+  return diag_client_conversation_impl_->SendDiagnosticRequest(std::move(message),
+                                                               std::move(response_sink));
+}
+
+Result<flash::DownloadResponseType, DiagClientConversation::DownloadError>
+DiagClientConversation::SendDownloadRequest(
+    flash::DownloadRequestType const &download_request) noexcept {
+  return diag_client_conversation_impl_->SendDownloadRequest(download_request);
+}
+
 }  // namespace conversation
 }  // namespace client
 }  // namespace diag
@@ -0,0 +1,26 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_INCLUDE_BOOST_SUPPORT_CLIENT_IO_THREAD_POOL_H_
+#define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_INCLUDE_BOOST_SUPPORT_CLIENT_IO_THREAD_POOL_H_
+
+#include <cstddef>
+
+namespace boost_support {
+namespace client {
+
+/**
+ * @brief         Function to set the number of threads of the io thread pool shared by all clients
+ * @details       Must be called before the first client is created, later calls have no effect
+ * @param[in]     thread_count
+ *                The number of threads, zero selects the number of hardware threads
+ */
+void SetIoThreadCount(std::size_t thread_count) noexcept;
+
+}  // namespace client
+}  // namespace boost_support
+#endif  // DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_INCLUDE_BOOST_SUPPORT_CLIENT_IO_THREAD_POOL_H_
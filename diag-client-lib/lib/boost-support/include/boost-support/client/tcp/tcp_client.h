@@ -8,6 +8,7 @@
 #ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_INCLUDE_BOOST_SUPPORT_CLIENT_TCP_TCP_CLIENT_H_
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_INCLUDE_BOOST_SUPPORT_CLIENT_TCP_TCP_CLIENT_H_
 
+#include <chrono>
 #include <functional>
 #include <string_view>
 
@@ -38,11 +39,21 @@ class TcpClient final {
    */
   using MessageConstPtr = boost_support::message::tcp::TcpMessageConstPtr;
 
+  /**
+   * @brief  Type alias for views on buffers of Tcp message
+   */
+  using MessageBufferViews = boost_support::message::tcp::TcpMessageBufferViews;
+
   /**
    * @brief         Tcp function template used for reception
    */
   using HandlerRead = std::function<void(MessagePtr)>;
 
+  /**
+   * @brief         Tcp function template used for notification of connection loss
+   */
+  using HandlerDisconnect = std::function<void()>;
+
  public:
   /**
    * @brief         Constructs an instance of TcpClient
@@ -91,6 +102,32 @@ class TcpClient final {
    */
   void SetReadHandler(HandlerRead read_handler) noexcept;
 
+  /**
+   * @brief         Function to set the handler that is invoked when the connection to remote host is lost
+   * @details       The ownership of provided disconnect handler is moved
+   * @param[in]     disconnect_handler
+   *                The handler to be set
+   */
+  void SetDisconnectHandler(HandlerDisconnect disconnect_handler) noexcept;
+
+  /**
+   * @brief         Function to limit the payload length of received messages
+   * @details       Messages with larger payload or with corrupted header are delivered as header only, the rest is
+   *                skipped without being stored. May be changed while connected.
+   * @param[in]     max_payload_length
+   *                The maximum payload length received
+   */
+  void SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept;
+
+  /**
+   * @brief         Function to enable delivery of messages larger than the receive buffer in fragments
+   * @details       The first fragment starts with the header announcing the complete length, the following fragments
+   *                carry their offset within the message. Large messages are thereby never stored as a whole.
+   * @param[in]     fragmented_reception
+   *                True to deliver fragments, disabled by default
+   */
+  void SetFragmentedReception(bool fragmented_reception) noexcept;
+
   /**
    * @brief         Function to connect to remote ip address and port number
    * @param[in]     host_ip_address
@@ -108,6 +145,12 @@ class TcpClient final {
    */
   core_type::Result<void> DisconnectFromHost();
 
+  /**
+   * @brief         Function to abort the connection to remote host, e.g. on protocol violation of remote
+   * @details       The connection loss is reported to the disconnect handler, DisconnectFromHost is still required
+   */
+  void AbortConnection() noexcept;
+
   /**
    * @brief         Function to get the connection status
    * @return        True if connected, False otherwise
@@ -122,6 +165,14 @@ class TcpClient final {
    */
   core_type::Result<void> Transmit(MessageConstPtr tcp_message);
 
+  /**
+   * @brief         Function to transmit the provided buffers as one tcp message without copying them
+   * @param[in]     buffer_views
+   *                The views on buffers, valid until the function returns
+   * @return        Empty void on success, otherwise error is returned
+   */
+  core_type::Result<void> Transmit(MessageBufferViews buffer_views);
+
  private:
   /**
    * @brief    Forward declaration of tcp client implementation
@@ -134,6 +185,15 @@ class TcpClient final {
   std::unique_ptr<TcpClientImpl> tcp_client_impl_;
 };
 
+/**
+ * @brief         Function to set the liveness timeout applied to all tcp clients connected afterwards
+ * @details       A remote host not answering keep-alive probes or not acknowledging sent data is detected as lost
+ *                within the timeout. The socket options work in full seconds, shorter timeouts are rounded up.
+ * @param[in]     liveness_timeout
+ *                The liveness timeout, zero keeps the operating system defaults
+ */
+void SetLivenessTimeout(std::chrono::milliseconds liveness_timeout) noexcept;
+
 }  // namespace tcp
 }  // namespace client
 }  // namespace boost_support
@@ -0,0 +1,253 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_IMAGE_FILE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_IMAGE_FILE_H
+// includes
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "boost-support/file/mapped_file.h"
+#include "core/include/result.h"
+#include "core/include/span.h"
+
+namespace boost_support {
+namespace file {
+
+/**
+ * @brief  Definitions of supported image formats
+ */
+enum class ImageFormat : std::uint8_t {
+  kBinary = 0U,         /**< Raw binary image without addresses */
+  kIntelHex = 1U,       /**< Intel HEX records */
+  kMotorolaSRecord = 2U /**< Motorola S-records */
+};
+
+/**
+ * @brief  Definitions of image loading failure error codes
+ */
+enum class ImageFileErrorCode : std::uint8_t {
+  kOpenFailed = 0U,         /**< File could not be mapped */
+  kInvalidRecord = 1U,      /**< Record is truncated, has invalid characters or unknown type */
+  kChecksumMismatch = 2U,   /**< Record checksum does not match its content */
+  kOverlappingSegment = 3U, /**< Address ranges of two segments overlap */
+  kMissingEndOfFile = 4U    /**< Intel HEX end of file record is missing */
+};
+
+/**
+ * @brief       Structure describing a contiguous address range of an image
+ */
+struct ImageSegment {
+  /**
+   * @brief     Start address of the segment
+   */
+  std::uint64_t address{0U};
+
+  /**
+   * @brief     Number of data bytes of the segment
+   */
+  std::size_t length{0U};
+
+  /**
+   * @brief     Offset of the first record of the segment within the file
+   */
+  std::size_t file_offset{0U};
+};
+
+/**
+ * @brief       Class providing the segments of a raw binary, Intel HEX or Motorola S-record image
+ * @details     The file is mapped and all records are validated once on open, only the segment boundaries are stored.
+ *              Segment data is decoded on demand by a segment reader, so that the image is never materialized as a
+ *              whole
+ */
+class ImageFile final {
+ public:
+  /**
+   * @brief     Class reading the data of a single segment incrementally
+   */
+  class SegmentReader final {
+   public:
+    /**
+     * @brief         Constructs an instance of SegmentReader
+     * @param[in]     content
+     *                The whole file content, must outlive the reader
+     * @param[in]     format
+     *                The image format
+     * @param[in]     segment
+     *                The segment read
+     */
+    SegmentReader(core_type::Span<std::uint8_t const> content, ImageFormat format,
+                  ImageSegment const &segment) noexcept;
+
+    /**
+     * @brief         Function to read the next data of the segment
+     * @details       Raw binary data is returned as view onto the mapped file, record data is decoded into a
+     *                buffer reused on every call
+     * @param[in]     max_length
+     *                The maximum number of bytes read
+     * @return        The view onto the bytes read, valid until the next call, empty once the segment is read
+     */
+    core_type::Span<std::uint8_t const> Read(std::size_t max_length) noexcept;
+
+    /**
+     * @brief         Function to get the number of bytes not yet read
+     * @return        The remaining length of the segment
+     */
+    std::size_t GetRemainingLength() const noexcept { return remaining_length_; }
+
+   private:
+    /**
+     * @brief         Function to advance to the next data record of the segment
+     * @return        True if a data record is found, otherwise False
+     */
+    bool NextDataRecord() noexcept;
+
+    /**
+     * @brief         Store the file content
+     */
+    core_type::Span<std::uint8_t const> content_;
+
+    /**
+     * @brief         Store the image format
+     */
+    ImageFormat format_;
+
+    /**
+     * @brief         Store the offset of the next byte for binary, of the next record otherwise
+     */
+    std::size_t position_;
+
+    /**
+     * @brief         Store the number of segment bytes not yet read
+     */
+    std::size_t remaining_length_;
+
+    /**
+     * @brief         Store the hex encoded data of the current record not yet decoded
+     */
+    std::uint8_t const *record_data_;
+
+    /**
+     * @brief         Store the number of data bytes of the current record not yet decoded
+     */
+    std::size_t record_remaining_;
+
+    /**
+     * @brief         Store the decoded data
+     */
+    std::vector<std::uint8_t> buffer_;
+  };
+
+ public:
+  /**
+   * @brief         Constructs an instance of ImageFile without image
+   */
+  ImageFile() noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  ImageFile(const ImageFile &other) noexcept = delete;
+  ImageFile &operator=(const ImageFile &other) noexcept = delete;
+
+  /**
+   * @brief         Move assignment and move constructor
+   */
+  ImageFile(ImageFile &&other) noexcept = default;
+  ImageFile &operator=(ImageFile &&other) noexcept = default;
+
+  /**
+   * @brief         Destructs an instance of ImageFile, unmapping the file
+   */
+  ~ImageFile() noexcept = default;
+
+  /**
+   * @brief         Function to get the image format
+   * @return        The image format
+   */
+  ImageFormat GetFormat() const noexcept { return format_; }
+
+  /**
+   * @brief         Function to get the segments in file order
+   * @return        The view onto the segments
+   */
+  core_type::Span<ImageSegment const> GetSegments() const noexcept {
+    return core_type::Span<ImageSegment const>{segments_};
+  }
+
+  /**
+   * @brief         Function to get the number of data bytes of all segments
+   * @return        The image length
+   */
+  std::size_t GetLength() const noexcept;
+
+  /**
+   * @brief         Function to create a reader of segment data
+   * @param[in]     segment
+   *                The segment read, one of GetSegments()
+   * @return        The segment reader, valid as long as the instance lives
+   */
+  SegmentReader GetSegmentReader(ImageSegment const &segment) const noexcept;
+
+  /**
+   * @brief         Function to detect the image format from the file extension
+   * @details       Extensions .hex and .ihex are Intel HEX, .s19, .s28, .s37, .srec and .mot are Motorola S-record,
+   *                everything else raw binary
+   * @param[in]     file_path
+   *                The path to file
+   * @return        The image format detected
+   */
+  static ImageFormat DetectFormat(std::string_view file_path) noexcept;
+
+  /**
+   * @brief         Function to open an image with format detected from file extension
+   * @param[in]     file_path
+   *                The path to file
+   * @param[in]     binary_address
+   *                The start address of raw binary image, unused for other formats
+   * @return        The image on success, error code otherwise
+   */
+  static core_type::Result<ImageFile, ImageFileErrorCode> Open(
+      std::string_view file_path, std::uint64_t binary_address) noexcept;
+
+  /**
+   * @brief         Function to parse the segments of image content
+   * @param[in]     content
+   *                The image content
+   * @param[in]     format
+   *                The image format
+   * @param[in]     binary_address
+   *                The start address of raw binary image, unused for other formats
+   * @return        The segments in file order on success, error code otherwise
+   */
+  static core_type::Result<std::vector<ImageSegment>, ImageFileErrorCode> Parse(
+      core_type::Span<std::uint8_t const> content, ImageFormat format,
+      std::uint64_t binary_address) noexcept;
+
+ private:
+  /**
+   * @brief         Store the mapped file
+   */
+  MappedFile mapped_file_;
+
+  /**
+   * @brief         Store the image format
+   */
+  ImageFormat format_;
+
+  /**
+   * @brief         Store the segments in file order
+   */
+  std::vector<ImageSegment> segments_;
+};
+
+}  // namespace file
+}  // namespace boost_support
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_IMAGE_FILE_H
@@ -0,0 +1,84 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_MAPPED_FILE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_MAPPED_FILE_H
+// includes
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include "core/include/result.h"
+#include "core/include/span.h"
+
+namespace boost_support {
+namespace file {
+
+/**
+ * @brief  Definitions of file mapping failure error codes
+ */
+enum class MappedFileErrorCode : std::uint8_t { kOpenFailed = 0U };
+
+/**
+ * @brief       Class providing read only access to a file mapped into memory
+ * @details     Pages are loaded on first access, the file content is never copied as a whole
+ */
+class MappedFile final {
+ public:
+  /**
+   * @brief         Constructs an instance of MappedFile without mapping
+   */
+  MappedFile() noexcept;
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  MappedFile(const MappedFile &other) noexcept = delete;
+  MappedFile &operator=(const MappedFile &other) noexcept = delete;
+
+  /**
+   * @brief         Move assignment and move constructor
+   */
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+
+  /**
+   * @brief         Destructs an instance of MappedFile, unmapping the file
+   */
+  ~MappedFile() noexcept;
+
+  /**
+   * @brief         Function to get the mapped file content
+   * @return        The view onto the whole file, valid as long as the instance lives
+   */
+  core_type::Span<std::uint8_t const> GetData() const noexcept;
+
+  /**
+   * @brief         Function to open and map the file for reading
+   * @details       The kernel is advised about sequential access, so that pages are read ahead
+   * @param[in]     file_path
+   *                The path to file
+   * @return        The mapped file on success, error code otherwise
+   */
+  static core_type::Result<MappedFile, MappedFileErrorCode> Open(std::string_view file_path) noexcept;
+
+ private:
+  /**
+   * @brief         Forward declaration of mapped file implementation
+   */
+  class MappedFileImpl;
+
+  /**
+   * @brief         Unique pointer to mapped file implementation
+   */
+  std::unique_ptr<MappedFileImpl> mapped_file_impl_;
+};
+
+}  // namespace file
+}  // namespace boost_support
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_FILE_MAPPED_FILE_H
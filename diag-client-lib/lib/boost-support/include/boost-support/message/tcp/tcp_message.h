@@ -8,10 +8,12 @@
 #ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_TCP_TCP_MESSAGE_H_
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_TCP_TCP_MESSAGE_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "core/include/span.h"
@@ -64,11 +66,27 @@ class TcpMessage final {
    *                The received data payload
    */
   TcpMessage(IpAddressType host_ip_address, std::uint16_t host_port_number, BufferType payload)
+      : TcpMessage{host_ip_address, host_port_number, std::move(payload), 0u} {}
+
+  /**
+   * @brief         Constructs an instance of TcpMessage holding a fragment of a received frame
+   * @param[in]     host_ip_address
+   *                The host ip address
+   * @param[in]     host_port_number
+   *                The host port number
+   * @param[in]     payload
+   *                The received data payload
+   * @param[in]     frame_offset
+   *                The offset of payload within the frame, zero for the fragment starting with the header
+   */
+  TcpMessage(IpAddressType host_ip_address, std::uint16_t host_port_number, BufferType payload,
+             std::size_t frame_offset)
       : socket_state_{SocketState::kIdle},
         socket_error_{SocketError::kNone},
         payload_{std::move(payload)},
         host_ip_address_{host_ip_address},
-        host_port_number_{host_port_number} {}
+        host_port_number_{host_port_number},
+        frame_offset_{frame_offset} {}
 
   TcpMessage(TcpMessage &&other) noexcept = default;
   TcpMessage &operator=(TcpMessage &&other) noexcept = default;
@@ -101,6 +119,21 @@ class TcpMessage final {
     return core_type::Span<std::uint8_t const>{payload_};
   }
 
+  /**
+   * @brief       Take over the received payload without copying
+   * @details     The message is left with an empty payload afterwards
+   * @return      The received payload
+   */
+  BufferType ReleasePayload() noexcept { return std::move(payload_); }
+
+  /**
+   * @brief       Get the offset of payload within the received frame
+   * @details     Frames are delivered in fragments only if enabled on the socket, the fragment at offset zero starts
+   *              with the header announcing the complete frame length
+   * @return      The frame offset, zero for complete frames
+   */
+  std::size_t GetFrameOffset() const noexcept { return frame_offset_; }
+
   /**
    * @brief       Get the state of underlying socket
    * @return      The socket state
@@ -138,6 +171,11 @@ class TcpMessage final {
    * @brief    Store remote port number
    */
   std::uint16_t host_port_number_;
+
+  /**
+   * @brief    Store the offset of payload within the received frame
+   */
+  std::size_t frame_offset_;
 };
 
 /**
@@ -150,6 +188,16 @@ using TcpMessageConstPtr = std::unique_ptr<TcpMessage const>;
  */
 using TcpMessagePtr = std::unique_ptr<TcpMessage>;
 
+/**
+ * @brief    The view on one buffer of a tcp message to be transmitted
+ */
+using TcpMessageBufferView = core_type::Span<std::uint8_t const>;
+
+/**
+ * @brief    The views on buffers transmitted back to back as one tcp message, without copying them
+ */
+using TcpMessageBufferViews = core_type::Span<TcpMessageBufferView const>;
+
 /**
  * @brief    Doip HeaderSize
  */
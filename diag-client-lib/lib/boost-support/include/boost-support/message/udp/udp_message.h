@@ -10,6 +10,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -22,9 +23,75 @@ namespace message {
 namespace udp {
 
 /**
- * @brief    Maximum response size
+ * @brief    Maximum response size, DoIP header with vehicle announcement including VIN/GID sync status as largest
+ *           udp payload. Larger datagrams are discarded on reception
  */
-constexpr std::uint8_t kMaxUdpResSize{40u};
+constexpr std::size_t kMaxUdpResSize{41u};
+
+/**
+ * @brief    Class to keep the buffers of released udp messages for reuse by later receptions
+ */
+class UdpMessageBufferPool final {
+ public:
+  /**
+   * @brief    Type alias for underlying buffer
+   */
+  using BufferType = std::vector<std::uint8_t>;
+
+ public:
+  /**
+   * @brief         Constructs an instance of UdpMessageBufferPool
+   * @param[in]     max_buffer_count
+   *                The maximum number of buffers kept, further released buffers are freed
+   */
+  explicit UdpMessageBufferPool(std::size_t max_buffer_count) noexcept
+      : buffers_{},
+        max_buffer_count_{max_buffer_count},
+        mutex_{} {
+    buffers_.reserve(max_buffer_count_);
+  }
+
+  /**
+   * @brief       Function to get an empty buffer, reusing the capacity of a released buffer if available
+   * @return      The buffer
+   */
+  BufferType Acquire() noexcept {
+    BufferType buffer{};
+    std::lock_guard<std::mutex> const lock{mutex_};
+    if (!buffers_.empty()) {
+      buffer = std::move(buffers_.back());
+      buffers_.pop_back();
+    }
+    return buffer;
+  }
+
+  /**
+   * @brief       Function to give back a buffer no longer used
+   * @param[in]   buffer
+   *              The buffer released
+   */
+  void Release(BufferType buffer) noexcept {
+    buffer.clear();
+    std::lock_guard<std::mutex> const lock{mutex_};
+    if (buffers_.size() < max_buffer_count_) { buffers_.emplace_back(std::move(buffer)); }
+  }
+
+ private:
+  /**
+   * @brief    Store the released buffers
+   */
+  std::vector<BufferType> buffers_;
+
+  /**
+   * @brief    Store the maximum number of buffers kept
+   */
+  std::size_t max_buffer_count_;
+
+  /**
+   * @brief    mutex to lock critical section
+   */
+  std::mutex mutex_;
+};
 
 /**
  * @brief    Immutable class to store received udp message
@@ -49,7 +116,26 @@ class UdpMessage final {
   UdpMessage(std::string_view host_ip_address, std::uint16_t host_port_number, BufferType payload)
       : payload_{std::move(payload)},
         host_ip_address_{host_ip_address},
-        host_port_number_{host_port_number} {}
+        host_port_number_{host_port_number},
+        buffer_pool_{} {}
+
+  /**
+   * @brief         Constructs an instance of UdpMessage with payload buffer given back to the pool on destruction
+   * @param[in]     host_ip_address
+   *                The host ip address
+   * @param[in]     host_port_number
+   *                The host port number
+   * @param[in]     payload
+   *                The received data payload, acquired from the pool
+   * @param[in]     buffer_pool
+   *                The pool the payload buffer is released to
+   */
+  UdpMessage(std::string_view host_ip_address, std::uint16_t host_port_number, BufferType payload,
+             std::shared_ptr<UdpMessageBufferPool> buffer_pool)
+      : payload_{std::move(payload)},
+        host_ip_address_{host_ip_address},
+        host_port_number_{host_port_number},
+        buffer_pool_{std::move(buffer_pool)} {}
 
   UdpMessage(UdpMessage &&other) noexcept = default;
   UdpMessage &operator=(UdpMessage &&other) noexcept = default;
@@ -60,7 +146,9 @@ class UdpMessage final {
   /**
    * @brief         Destructs an instance of UdpMessage
    */
-  ~UdpMessage() = default;
+  ~UdpMessage() {
+    if (buffer_pool_) { buffer_pool_->Release(std::move(payload_)); }
+  }
 
   /**
    * @brief       Get the host ip address
@@ -97,6 +185,11 @@ class UdpMessage final {
    * @brief    Store remote port number
    */
   std::uint16_t host_port_number_;
+
+  /**
+   * @brief    Store the pool the payload buffer is released to, empty if not pooled
+   */
+  std::shared_ptr<UdpMessageBufferPool> buffer_pool_;
 };
 
 /**
@@ -0,0 +1,46 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ * 
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_NETWORK_IP_ADDRESS_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_NETWORK_IP_ADDRESS_H
+// includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "core/include/result.h"
+
+namespace boost_support {
+namespace network {
+
+/**
+ * @brief  Definitions of ip address error codes
+ */
+enum class IpAddressErrorCode : std::uint8_t {
+  kInvalidAddress = 0U,   /**< Neither an ip address nor an IPv4 network in CIDR notation */
+  kTooManyAddresses = 1U  /**< The network contains more host addresses than allowed */
+};
+
+/**
+ * @brief           Function to get the host addresses of an ip address or IPv4 network
+ * @details         The addresses are returned in the notation of received udp messages, so that responses can be
+ *                  matched against them
+ * @param[in]       address
+ *                  The ip address or IPv4 network in CIDR notation e.g. "172.16.4.0/22"
+ * @param[in]       max_address_count
+ *                  The maximum number of host addresses returned
+ * @return          The host addresses on success or error code
+ */
+core_type::Result<std::vector<std::string>, IpAddressErrorCode> GetHostAddresses(
+    std::string_view address, std::size_t max_address_count) noexcept;
+
+}  // namespace network
+}  // namespace boost_support
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_BOOST_SUPPORT_NETWORK_IP_ADDRESS_H
@@ -0,0 +1,21 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "boost-support/client/io_thread_pool.h"
+
+#include "boost-support/socket/io_thread_pool.h"
+
+namespace boost_support {
+namespace client {
+
+void SetIoThreadCount(std::size_t thread_count) noexcept {
+  socket::IoThreadPool::SetThreadCount(thread_count);
+}
+
+}  // namespace client
+}  // namespace boost_support
@@ -13,7 +13,7 @@
 #include "boost-support/common/logger.h"
 #include "boost-support/connection/tcp/tcp_connection.h"
 #include "boost-support/error_domain/boost_support_error_domain.h"
-#include "boost-support/socket/io_context.h"
+#include "boost-support/socket/io_thread_pool.h"
 #include "boost-support/socket/tcp/tcp_socket.h"
 #include "boost-support/socket/tls/tls_socket.h"
 #include "core/include/variant_helper.h"
@@ -55,11 +55,6 @@ class TcpClient::TcpClientImpl final {
     kDisconnected = 1U /**< Disconnected from remote server */
   };
 
-  /**
-   * @brief  Type alias for boost context
-   */
-  using IoContext = boost_support::socket::IoContext;
-
  public:
   /**
    * @brief         Constructs an instance of TcpClientImpl
@@ -70,11 +65,12 @@ class TcpClient::TcpClientImpl final {
    */
   TcpClientImpl(std::string_view client_name, std::string_view local_ip_address,
                 std::uint16_t local_port_num) noexcept
-      : io_context_{},
-        connection_state_{State::kDisconnected},
+      : connection_state_{State::kDisconnected},
         client_name_{AppendIpAddressAndPort(client_name, local_ip_address, local_port_num)},
         tcp_connection_{client_name,
-                        socket::tcp::TcpSocket{local_ip_address, local_port_num, io_context_}} {}
+                        socket::tcp::TcpSocket{
+                            local_ip_address, local_port_num,
+                            socket::IoThreadPool::GetIoThreadPool().GetContext()}} {}
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -113,6 +109,33 @@ class TcpClient::TcpClientImpl final {
     tcp_connection_.SetReadHandler(std::move(read_handler));
   }
 
+  /**
+   * @brief         Function to set the handler that is invoked when the connection to remote host is lost
+   * @param[in]     disconnect_handler
+   *                The handler to be set
+   */
+  void SetDisconnectHandler(HandlerDisconnect disconnect_handler) noexcept {
+    tcp_connection_.SetDisconnectHandler(std::move(disconnect_handler));
+  }
+
+  /**
+   * @brief         Function to limit the payload length of received messages
+   * @param[in]     max_payload_length
+   *                The maximum payload length received
+   */
+  void SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept {
+    tcp_connection_.SetMaxPayloadLength(max_payload_length);
+  }
+
+  /**
+   * @brief         Function to enable delivery of large messages in fragments
+   * @param[in]     fragmented_reception
+   *                True to deliver fragments
+   */
+  void SetFragmentedReception(bool fragmented_reception) noexcept {
+    tcp_connection_.SetFragmentedReception(fragmented_reception);
+  }
+
   /**
    * @brief         Function to connect to remote ip address and port number
    * @param[in]     host_ip_address
@@ -160,6 +183,16 @@ class TcpClient::TcpClientImpl final {
     return result;
   }
 
+  /**
+   * @brief         Function to abort the connection to remote host, the connection state is kept until
+   *                disconnected
+   */
+  void AbortConnection() noexcept {
+    if (connection_state_.load(std::memory_order_seq_cst) == State::kConnected) {
+      tcp_connection_.AbortConnection();
+    }
+  }
+
   /**
    * @brief         Function to get the connection status
    * @return        True if connected, False otherwise
@@ -189,12 +222,28 @@ class TcpClient::TcpClientImpl final {
     return result;
   }
 
- private:
   /**
-   * @brief  Stores the io context
+   * @brief         Function to transmit the provided buffers as one tcp message
+   * @param[in]     buffer_views
+   *                The views on buffers
+   * @return        Empty void on success, otherwise error is returned
    */
-  IoContext io_context_;
+  core_type::Result<void> Transmit(MessageBufferViews buffer_views) {
+    core_type::Result<void> result{
+        error_domain::MakeErrorCode(error_domain::BoostSupportErrorErrc::kGenericError)};
+    if (connection_state_.load(std::memory_order_seq_cst) == State::kConnected) {
+      if (tcp_connection_.Transmit(buffer_views)) { result.EmplaceValue(); }
+    } else {
+      // not connected
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+            msg << "Tcp client is Offline, please connect to server first";
+          });
+    }
+    return result;
+  }
 
+ private:
   /**
    * @brief  Store the state of tcp connection
    */
@@ -230,6 +279,18 @@ void TcpClient::SetReadHandler(TcpClient::HandlerRead read_handler) noexcept {
   tcp_client_impl_->SetReadHandler(std::move(read_handler));
 }
 
+void TcpClient::SetDisconnectHandler(TcpClient::HandlerDisconnect disconnect_handler) noexcept {
+  tcp_client_impl_->SetDisconnectHandler(std::move(disconnect_handler));
+}
+
+void TcpClient::SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept {
+  tcp_client_impl_->SetMaxPayloadLength(max_payload_length);
+}
+
+void TcpClient::SetFragmentedReception(bool fragmented_reception) noexcept {
+  tcp_client_impl_->SetFragmentedReception(fragmented_reception);
+}
+
 core_type::Result<void> TcpClient::ConnectToHost(std::string_view host_ip_address,
                                                  std::uint16_t host_port_num) {
   return tcp_client_impl_->ConnectToHost(host_ip_address, host_port_num);
@@ -239,6 +300,8 @@ core_type::Result<void> TcpClient::DisconnectFromHost() {
   return tcp_client_impl_->DisconnectFromHost();
 }
 
+void TcpClient::AbortConnection() noexcept { tcp_client_impl_->AbortConnection(); }
+
 auto TcpClient::IsConnectedToHost() const noexcept -> bool {
   return tcp_client_impl_->IsConnectedToHost();
 }
@@ -247,6 +310,14 @@ core_type::Result<void> TcpClient::Transmit(MessageConstPtr tcp_message) {
   return tcp_client_impl_->Transmit(std::move(tcp_message));
 }
 
+core_type::Result<void> TcpClient::Transmit(MessageBufferViews buffer_views) {
+  return tcp_client_impl_->Transmit(buffer_views);
+}
+
+void SetLivenessTimeout(std::chrono::milliseconds liveness_timeout) noexcept {
+  socket::tcp::TcpSocket::SetLivenessTimeout(liveness_timeout);
+}
+
 }  // namespace tcp
 }  // namespace client
 }  // namespace boost_support
@@ -11,7 +11,7 @@
 #include "boost-support/common/logger.h"
 #include "boost-support/connection/tcp/tcp_connection.h"
 #include "boost-support/error_domain/boost_support_error_domain.h"
-#include "boost-support/socket/io_context.h"
+#include "boost-support/socket/io_thread_pool.h"
 #include "boost-support/socket/tls/tls_context.h"
 #include "boost-support/socket/tls/tls_socket.h"
 
@@ -58,11 +58,6 @@ class TlsClient<TlsVersion>::TlsClientImpl final {
     kDisconnected = 1U /**< Disconnected from remote server */
   };
 
-  /**
-   * @brief  Type alias for boost context
-   */
-  using IoContext = boost_support::socket::IoContext;
-
   /**
    * @brief  Type alias for tls context
    */
@@ -79,12 +74,12 @@ class TlsClient<TlsVersion>::TlsClientImpl final {
   TlsClientImpl(std::string_view client_name, std::string_view local_ip_address,
                 std::uint16_t local_port_num, std::string_view ca_certification_path,
                 TlsVersion tls_version) noexcept
-      : io_context_{},
-        tls_context_{tls_version, ca_certification_path},
+      : tls_context_{tls_version, ca_certification_path},
         connection_state_{State::kDisconnected},
         client_name_{AppendIpAddressAndPort(client_name, local_ip_address, local_port_num)},
         tcp_connection_{client_name,
-                        TlsSocket{local_ip_address, local_port_num, tls_context_, io_context_}} {}
+                        TlsSocket{local_ip_address, local_port_num, tls_context_,
+                                  socket::IoThreadPool::GetIoThreadPool().GetContext()}} {}
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -200,11 +195,6 @@ class TlsClient<TlsVersion>::TlsClientImpl final {
   }
 
  private:
-  /**
-   * @brief  Stores the io context
-   */
-  IoContext io_context_;
-
   /**
    * @brief  Stores the tls context
    */
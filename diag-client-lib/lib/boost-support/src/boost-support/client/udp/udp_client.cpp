@@ -9,7 +9,7 @@
 #include "boost-support/client/udp/udp_client.h"
 
 #include "boost-support/connection/udp/udp_connection.h"
-#include "boost-support/socket/io_context.h"
+#include "boost-support/socket/io_thread_pool.h"
 #include "boost-support/socket/udp/udp_socket.h"
 
 namespace boost_support {
@@ -29,9 +29,8 @@ class UdpClient::UdpClientImpl final {
    *                The local port number of client
    */
   UdpClientImpl(std::string_view local_ip_address, std::uint16_t local_port_num) noexcept
-      : io_context_{"UdpClient"},
-        udp_connection_{
-            socket::udp::UdpSocket{local_ip_address, local_port_num, io_context_.GetContext()}} {}
+      : udp_connection_{socket::udp::UdpSocket{
+            local_ip_address, local_port_num, socket::IoThreadPool::GetIoThreadPool().GetContext()}} {}
 
   /**
    * @brief         Deleted copy assignment and copy constructor
@@ -53,18 +52,12 @@ class UdpClient::UdpClientImpl final {
   /**
    * @brief         Initialize the client
    */
-  void Initialize() noexcept {
-    io_context_.Initialize();
-    udp_connection_.Initialize();
-  }
+  void Initialize() noexcept { udp_connection_.Initialize(); }
 
   /**
    * @brief         De-initialize the client
    */
-  void DeInitialize() noexcept {
-    udp_connection_.DeInitialize();
-    io_context_.DeInitialize();
-  }
+  void DeInitialize() noexcept { udp_connection_.DeInitialize(); }
 
   /**
    * @brief         Function to set the read handler that is invoked when message is received
@@ -92,16 +85,6 @@ class UdpClient::UdpClientImpl final {
    */
   using UdpConnection = connection::udp::UdpConnection<socket::udp::UdpSocket>;
 
-  /**
-   * @brief  Type alias for boost context
-   */
-  using IoContext = boost_support::socket::IoContext;
-
-  /**
-   * @brief  Stores the io context
-   */
-  IoContext io_context_;
-
   /**
    * @brief      Store the udp connection
    */
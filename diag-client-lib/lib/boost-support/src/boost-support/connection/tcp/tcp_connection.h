@@ -63,11 +63,21 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
    */
   using TcpMessageConstPtr = typename Socket::TcpMessageConstPtr;
 
+  /**
+   * @brief  Type alias for views on buffers of Tcp message
+   */
+  using TcpMessageBufferViews = typename Socket::TcpMessageBufferViews;
+
   /**
    * @brief         Tcp function template used for reception
    */
   using HandlerRead = std::function<void(TcpMessagePtr)>;
 
+  /**
+   * @brief         Tcp function template used for notification of connection loss
+   */
+  using HandlerDisconnect = std::function<void()>;
+
  public:
   /**
    * @brief         Constructs an instance of TcpConnection
@@ -77,12 +87,13 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
   explicit TcpConnection(std::string_view connection_name, Socket socket) noexcept
       : socket_{std::move(socket)},
         handler_read_{},
-        exit_request_{false},
+        handler_disconnect_{},
         running_{false},
+        read_pending_{false},
         cond_var_{},
         connection_name_{connection_name},
-        thread_{},
-        mutex_{} {}
+        mutex_{},
+        transmit_mutex_{} {}
 
   /**
    * @brief  Deleted copy assignment and copy constructor
@@ -91,10 +102,10 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
   TcpConnection &operator=(const TcpConnection &other) &noexcept = delete;
 
   /**
-   * @brief  Move assignment and move constructor
+   * @brief  Deleted move assignment and move constructor, pending reads refer to this instance
    */
-  TcpConnection(TcpConnection &&other) noexcept = default;
-  TcpConnection &operator=(TcpConnection &&other) &noexcept = default;
+  TcpConnection(TcpConnection &&other) noexcept = delete;
+  TcpConnection &operator=(TcpConnection &&other) &noexcept = delete;
 
   /**
    * @brief         Destruct an instance of TcpConnection
@@ -109,41 +120,52 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
    */
   void SetReadHandler(HandlerRead read_handler) { handler_read_ = std::move(read_handler); }
 
+  /**
+   * @brief         Function to set the handler that is invoked when the connection is lost
+   * @details       The handler is invoked from the reading context when reception fails while connected, it is not
+   *                invoked on disconnection requested with DisconnectFromHost
+   * @param[in]     disconnect_handler
+   *                The handler to be set
+   */
+  void SetDisconnectHandler(HandlerDisconnect disconnect_handler) {
+    handler_disconnect_ = std::move(disconnect_handler);
+  }
+
+  /**
+   * @brief         Function to limit the payload length of frames received
+   * @param[in]     max_payload_length
+   *                The maximum payload length received
+   */
+  void SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept {
+    socket_.SetMaxPayloadLength(max_payload_length);
+  }
+
+  /**
+   * @brief         Function to enable delivery of large frames in fragments
+   * @param[in]     fragmented_reception
+   *                True to deliver fragments
+   */
+  void SetFragmentedReception(bool fragmented_reception) noexcept {
+    socket_.SetFragmentedReception(fragmented_reception);
+  }
+
   /**
    * @brief         Initialize the client
    */
   void Initialize() noexcept {
     // Open socket
     socket_.Open();
-    // Start thread to receive messages
-    thread_ = utility::thread::Thread{
-        connection_name_, [this]() {
-          std::unique_lock<std::mutex> lck(mutex_);
-          while (!exit_request_) {
-            if (!running_) {
-              cond_var_.wait(lck, [this]() { return exit_request_ || running_; });
-            }
-            if (!exit_request_.load() && running_) {
-              lck.unlock();
-              running_ = ReadMessage();
-              lck.lock();
-            }
-          }
-        }};
   }
 
   /**
    * @brief         De-initialize the client
+   * @details       Blocks until the pending read, if any, is completed
    */
   void DeInitialize() noexcept {
+    running_ = false;
     socket_.Close();
-    {
-      std::unique_lock<std::mutex> lck(mutex_);
-      exit_request_ = true;
-      running_ = false;
-    }
-    cond_var_.notify_all();
-    thread_.Join();
+    std::unique_lock<std::mutex> lck(mutex_);
+    cond_var_.wait(lck, [this]() { return !read_pending_; });
   }
 
   /**
@@ -158,11 +180,14 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
       -> bool {
     return socket_.Connect(host_ip_address, host_port_num)
         .AndThen([this]() noexcept {
-          {  // start reading
-            std::lock_guard<std::mutex> lock{mutex_};
-            running_ = true;
-            cond_var_.notify_all();
+          {  // reads of previous connection must be completed
+            std::unique_lock<std::mutex> lck(mutex_);
+            cond_var_.wait(lck, [this]() { return !read_pending_; });
+            read_pending_ = true;
           }
+          // start reading
+          running_ = true;
+          ReadMessage();
         })
         .HasValue();
   }
@@ -172,20 +197,26 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
    * @return        Empty result on success otherwise error code
    */
   void DisconnectFromHost() noexcept {
-    {  // stop reading
-      std::lock_guard<std::mutex> lock{mutex_};
-      running_ = false;
-    }
+    // stop reading, the pending read completes on shutdown
+    running_ = false;
     socket_.Disconnect();
   }
 
+  /**
+   * @brief         Function to abort the connection to host, e.g. on protocol violation of remote
+   * @details       Reading is not stopped, the pending read fails and reports the connection loss
+   */
+  void AbortConnection() noexcept { static_cast<void>(socket_.Disconnect()); }
+
   /**
    * @brief         Function to trigger transmission
+   * @details       Transmission from several threads is serialized, so that messages are not interleaved
    * @param[in]     message
    *                The tcp message to be transmitted
    * @return        Empty result on success otherwise error code
    */
   core_type::Result<void> Transmit(TcpMessageConstPtr message) noexcept {
+    std::lock_guard<std::mutex> const lock{transmit_mutex_};
     return socket_.Transmit(std::move(message))
         .AndThen([]() { return core_type::Result<void>::FromValue(); })
         .MapError([](typename Socket::SocketError const &) {
@@ -193,6 +224,22 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
         });
   }
 
+  /**
+   * @brief         Function to trigger transmission of buffers with a single vectored write
+   * @details       Transmission from several threads is serialized, so that messages are not interleaved
+   * @param[in]     buffer_views
+   *                The views on buffers to be transmitted
+   * @return        Empty result on success otherwise error code
+   */
+  core_type::Result<void> Transmit(TcpMessageBufferViews buffer_views) noexcept {
+    std::lock_guard<std::mutex> const lock{transmit_mutex_};
+    return socket_.Transmit(buffer_views)
+        .AndThen([]() { return core_type::Result<void>::FromValue(); })
+        .MapError([](typename Socket::SocketError const &) {
+          return error_domain::MakeErrorCode(error_domain::BoostSupportErrorErrc::kSocketError);
+        });
+  }
+
  private:
   /**
    * @brief  Store socket used for reading and writing tcp message
@@ -205,17 +252,22 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
   HandlerRead handler_read_;
 
   /**
-   * @brief  Flag to terminate the thread
+   * @brief  Store the handler notified on connection loss
    */
-  std::atomic_bool exit_request_;
+  HandlerDisconnect handler_disconnect_;
 
   /**
-   * @brief  Flag to start the thread
+   * @brief  Flag to continue reading
    */
   std::atomic_bool running_;
 
   /**
-   * @brief  Conditional variable to block the thread
+   * @brief  Flag indicating an asynchronous read is outstanding
+   */
+  bool read_pending_;
+
+  /**
+   * @brief  Conditional variable to wait for completion of outstanding read
    */
   std::condition_variable cond_var_;
 
@@ -225,28 +277,38 @@ class TcpConnection<ConnectionType::kClient, Socket> final {
   std::string connection_name_;
 
   /**
-   * @brief  Store the thread
+   * @brief  mutex to lock critical section
    */
-  utility::thread::Thread thread_;
+  std::mutex mutex_;
 
   /**
-   * @brief  mutex to lock critical section
+   * @brief  mutex held across a complete write, the socket sends in partial writes
    */
-  std::mutex mutex_;
+  std::mutex transmit_mutex_;
 
  private:
   /**
-   * @brief         Function to send the received message to stored handler
-   * @return        True if message is read successfully, otherwise False
-   */
-  auto ReadMessage() -> bool {
-    // Try reading from socket
-    return socket_.Read()
-        .AndThen([this](TcpMessagePtr tcp_message) {
-          if (handler_read_) { handler_read_(std::move(tcp_message)); }
-          return core_type::Result<void, typename Socket::SocketError>::FromValue();
-        })
-        .HasValue();
+   * @brief         Function to read the next message asynchronously and send it to stored handler
+   * @details       Reading is re-armed from the completion until it fails or is stopped
+   */
+  void ReadMessage() noexcept {
+    socket_.AsyncRead([this](typename Socket::ReadResult result) {
+      bool const read_success{result.HasValue()};
+      if (read_success && handler_read_) { handler_read_(std::move(result).Value()); }
+      if (read_success && running_) {
+        ReadMessage();
+      } else {
+        // reception failed without being stopped, the remote side closed or the liveness probe failed
+        if (!read_success && running_.exchange(false) && handler_disconnect_) {
+          handler_disconnect_();
+        }
+        {
+          std::lock_guard<std::mutex> lock{mutex_};
+          read_pending_ = false;
+        }
+        cond_var_.notify_all();
+      }
+    });
   }
 };
 
@@ -273,6 +335,11 @@ class TcpConnection<ConnectionType::kServer, Socket> final {
    */
   using TcpMessageConstPtr = typename Socket::TcpMessageConstPtr;
 
+  /**
+   * @brief  Type alias for views on buffers of Tcp message
+   */
+  using TcpMessageBufferViews = typename Socket::TcpMessageBufferViews;
+
   /**
    * @brief         Tcp function template used for reception
    */
@@ -388,6 +455,20 @@ class TcpConnection<ConnectionType::kServer, Socket> final {
         });
   }
 
+  /**
+   * @brief         Function to trigger transmission of buffers with a single vectored write
+   * @param[in]     buffer_views
+   *                The views on buffers to be transmitted
+   * @return        Empty result on success otherwise error code
+   */
+  core_type::Result<void> Transmit(TcpMessageBufferViews buffer_views) noexcept {
+    return socket_.Transmit(buffer_views)
+        .AndThen([]() { return core_type::Result<void>::FromValue(); })
+        .MapError([](typename Socket::SocketError const &) {
+          return error_domain::MakeErrorCode(error_domain::BoostSupportErrorErrc::kSocketError);
+        });
+  }
+
  private:
   /**
    * @brief  Store socket used for reading and writing tcp message
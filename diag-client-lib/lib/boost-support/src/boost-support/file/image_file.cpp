@@ -0,0 +1,535 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "boost-support/file/image_file.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+#include "boost-support/common/logger.h"
+
+namespace boost_support {
+namespace file {
+namespace {
+
+/**
+ * @brief  Value marking a character as not hexadecimal, sets the upper nibble when or-ed
+ */
+constexpr std::uint8_t kInvalidHexDigit{0xFFU};
+
+/**
+ * @brief       Function to create the table of hexadecimal digit values
+ * @return      The table mapping every character to its digit value or kInvalidHexDigit
+ */
+constexpr std::array<std::uint8_t, 256U> MakeHexDigitTable() noexcept {
+  std::array<std::uint8_t, 256U> table{};
+  for (std::size_t character{0U}; character < table.size(); ++character) {
+    table[character] = kInvalidHexDigit;
+  }
+  for (std::uint8_t digit{0U}; digit < 10U; ++digit) {
+    table[static_cast<std::size_t>('0') + digit] = digit;
+  }
+  for (std::uint8_t digit{0U}; digit < 6U; ++digit) {
+    table[static_cast<std::size_t>('A') + digit] = static_cast<std::uint8_t>(10U + digit);
+    table[static_cast<std::size_t>('a') + digit] = static_cast<std::uint8_t>(10U + digit);
+  }
+  return table;
+}
+
+/**
+ * @brief  Table of hexadecimal digit values
+ */
+constexpr std::array<std::uint8_t, 256U> kHexDigitTable{MakeHexDigitTable()};
+
+/**
+ * @brief  Minimum number of characters of an Intel HEX record, ':' LL AAAA TT CC
+ */
+constexpr std::size_t kIntelHexMinRecordLength{11U};
+
+/**
+ * @brief  Minimum number of characters of a Motorola S-record, 'S' T NN CC
+ */
+constexpr std::size_t kSRecordMinRecordLength{6U};
+
+/**
+ * @brief  Kinds of records, independent of the image format
+ */
+enum class RecordKind : std::uint8_t {
+  kData = 0U,
+  kExtendedSegmentAddress,
+  kExtendedLinearAddress,
+  kEndOfFile,
+  kIgnored
+};
+
+/**
+ * @brief  Record parsed from the image content
+ */
+struct Record {
+  /**
+   * @brief  Kind of record
+   */
+  RecordKind kind{RecordKind::kIgnored};
+
+  /**
+   * @brief  Address field of the record
+   */
+  std::uint64_t address{0U};
+
+  /**
+   * @brief  Hex encoded data of the record
+   */
+  std::uint8_t const *data{nullptr};
+
+  /**
+   * @brief  Number of data bytes of the record
+   */
+  std::size_t data_length{0U};
+
+  /**
+   * @brief  Offset of the record following this one
+   */
+  std::size_t next_offset{0U};
+};
+
+/**
+ * @brief       Function to decode a single hex encoded byte
+ * @param[in]   chars
+ *              The two hex digits
+ * @param[out]  value
+ *              The byte decoded
+ * @return      True if both characters are hexadecimal digits, otherwise False
+ */
+inline bool DecodeHexByte(std::uint8_t const *chars, std::uint8_t &value) noexcept {
+  std::uint8_t const high{kHexDigitTable[chars[0U]]};
+  std::uint8_t const low{kHexDigitTable[chars[1U]]};
+  value = static_cast<std::uint8_t>((high << 4U) | low);
+  return ((high | low) & 0xF0U) == 0U;
+}
+
+/**
+ * @brief       Function to sum hex encoded bytes for checksum verification
+ * @param[in]   chars
+ *              The hex digits, two per byte
+ * @param[in]   count
+ *              The number of bytes
+ * @param[out]  sum
+ *              The sum of all bytes
+ * @return      True if all characters are hexadecimal digits, otherwise False
+ */
+inline bool SumHexBytes(std::uint8_t const *chars, std::size_t count, std::uint32_t &sum) noexcept {
+  std::uint32_t byte_sum{0U};
+  std::uint8_t digit_flags{0U};
+  for (std::size_t index{0U}; index < count; ++index) {
+    std::uint8_t const high{kHexDigitTable[chars[2U * index]]};
+    std::uint8_t const low{kHexDigitTable[chars[(2U * index) + 1U]]};
+    digit_flags = static_cast<std::uint8_t>(digit_flags | high | low);
+    byte_sum += static_cast<std::uint32_t>((high << 4U) | low);
+  }
+  sum = byte_sum;
+  return (digit_flags & 0xF0U) == 0U;
+}
+
+/**
+ * @brief       Function to decode hex encoded bytes, the characters must be validated before
+ * @param[in]   chars
+ *              The hex digits, two per byte
+ * @param[in]   count
+ *              The number of bytes
+ * @param[out]  output
+ *              The buffer receiving count bytes
+ */
+inline void DecodeHexBytes(std::uint8_t const *chars, std::size_t count,
+                           std::uint8_t *output) noexcept {
+  for (std::size_t index{0U}; index < count; ++index) {
+    output[index] = static_cast<std::uint8_t>((kHexDigitTable[chars[2U * index]] << 4U) |
+                                              kHexDigitTable[chars[(2U * index) + 1U]]);
+  }
+}
+
+/**
+ * @brief       Function to decode a big endian value of hex encoded bytes
+ * @param[in]   chars
+ *              The hex digits, two per byte
+ * @param[in]   count
+ *              The number of bytes, at most 8
+ * @return      The value decoded
+ */
+inline std::uint64_t DecodeHexValue(std::uint8_t const *chars, std::size_t count) noexcept {
+  std::uint64_t value{0U};
+  std::uint8_t byte{0U};
+  for (std::size_t index{0U}; index < count; ++index) {
+    static_cast<void>(DecodeHexByte(chars + (2U * index), byte));
+    value = (value << 8U) | byte;
+  }
+  return value;
+}
+
+/**
+ * @brief       Function to get the offset of the next record, skipping line endings and blanks
+ * @param[in]   content
+ *              The image content
+ * @param[in]   offset
+ *              The offset following a record
+ * @return      The offset of the next record or the content size
+ */
+inline std::size_t SkipLineEnding(core_type::Span<std::uint8_t const> content,
+                                  std::size_t offset) noexcept {
+  std::uint8_t const *const data{content.data()};
+  while ((offset < content.size()) && (data[offset] <= static_cast<std::uint8_t>(' '))) {
+    ++offset;
+  }
+  return offset;
+}
+
+/**
+ * @brief       Function to parse an Intel HEX record
+ * @param[in]   content
+ *              The image content
+ * @param[in]   offset
+ *              The offset of the record
+ * @param[in]   verify_checksum
+ *              True to verify digits and checksum of the whole record
+ * @param[out]  record
+ *              The record parsed
+ * @return      Nothing on success, error code otherwise
+ */
+std::optional<ImageFileErrorCode> ParseIntelHexRecord(core_type::Span<std::uint8_t const> content,
+                                                      std::size_t offset, bool verify_checksum,
+                                                      Record &record) noexcept {
+  std::uint8_t const *const chars{content.data() + offset};
+  std::size_t const available{content.size() - offset};
+  std::uint8_t data_length{0U};
+  if ((available < kIntelHexMinRecordLength) || (chars[0U] != static_cast<std::uint8_t>(':')) ||
+      !DecodeHexByte(chars + 1U, data_length)) {
+    return ImageFileErrorCode::kInvalidRecord;
+  }
+  // LL, AAAA, TT, data and CC
+  std::size_t const record_bytes{5U + static_cast<std::size_t>(data_length)};
+  if (available < (1U + (2U * record_bytes))) { return ImageFileErrorCode::kInvalidRecord; }
+  if (verify_checksum) {
+    std::uint32_t sum{0U};
+    if (!SumHexBytes(chars + 1U, record_bytes, sum)) { return ImageFileErrorCode::kInvalidRecord; }
+    if ((sum & 0xFFU) != 0U) { return ImageFileErrorCode::kChecksumMismatch; }
+  }
+  record.address = DecodeHexValue(chars + 3U, 2U);
+  record.data = chars + 9U;
+  record.data_length = data_length;
+  record.next_offset = SkipLineEnding(content, offset + 1U + (2U * record_bytes));
+  switch (DecodeHexValue(chars + 7U, 1U)) {
+    case 0x00U:
+      record.kind = RecordKind::kData;
+      break;
+    case 0x01U:
+      record.kind = RecordKind::kEndOfFile;
+      break;
+    case 0x02U:
+      record.kind = RecordKind::kExtendedSegmentAddress;
+      break;
+    case 0x04U:
+      record.kind = RecordKind::kExtendedLinearAddress;
+      break;
+    case 0x03U:
+    case 0x05U:
+      // start addresses are not part of the memory content
+      record.kind = RecordKind::kIgnored;
+      break;
+    default:
+      return ImageFileErrorCode::kInvalidRecord;
+  }
+  if (((record.kind == RecordKind::kExtendedSegmentAddress) ||
+       (record.kind == RecordKind::kExtendedLinearAddress)) &&
+      (record.data_length != 2U)) {
+    return ImageFileErrorCode::kInvalidRecord;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief       Function to parse a Motorola S-record
+ * @param[in]   content
+ *              The image content
+ * @param[in]   offset
+ *              The offset of the record
+ * @param[in]   verify_checksum
+ *              True to verify digits and checksum of the whole record
+ * @param[out]  record
+ *              The record parsed
+ * @return      Nothing on success, error code otherwise
+ */
+std::optional<ImageFileErrorCode> ParseSRecord(core_type::Span<std::uint8_t const> content,
+                                               std::size_t offset, bool verify_checksum,
+                                               Record &record) noexcept {
+  std::uint8_t const *const chars{content.data() + offset};
+  std::size_t const available{content.size() - offset};
+  std::uint8_t byte_count{0U};
+  if ((available < kSRecordMinRecordLength) || (chars[0U] != static_cast<std::uint8_t>('S')) ||
+      !DecodeHexByte(chars + 2U, byte_count)) {
+    return ImageFileErrorCode::kInvalidRecord;
+  }
+  std::size_t address_length{0U};
+  switch (chars[1U]) {
+    case '0':
+    case '1':
+    case '5':
+    case '9':
+      address_length = 2U;
+      record.kind = (chars[1U] == '1')   ? RecordKind::kData
+                    : (chars[1U] == '9') ? RecordKind::kEndOfFile
+                                         : RecordKind::kIgnored;
+      break;
+    case '2':
+    case '6':
+    case '8':
+      address_length = 3U;
+      record.kind = (chars[1U] == '2')   ? RecordKind::kData
+                    : (chars[1U] == '8') ? RecordKind::kEndOfFile
+                                         : RecordKind::kIgnored;
+      break;
+    case '3':
+    case '7':
+      address_length = 4U;
+      record.kind = (chars[1U] == '3') ? RecordKind::kData : RecordKind::kEndOfFile;
+      break;
+    default:
+      return ImageFileErrorCode::kInvalidRecord;
+  }
+  // NN counts address, data and CC
+  if ((byte_count < (address_length + 1U)) ||
+      (available < (4U + (2U * static_cast<std::size_t>(byte_count))))) {
+    return ImageFileErrorCode::kInvalidRecord;
+  }
+  if (verify_checksum) {
+    std::uint32_t sum{0U};
+    if (!SumHexBytes(chars + 4U, byte_count, sum)) { return ImageFileErrorCode::kInvalidRecord; }
+    if (((sum + byte_count) & 0xFFU) != 0xFFU) { return ImageFileErrorCode::kChecksumMismatch; }
+  }
+  record.address = DecodeHexValue(chars + 4U, address_length);
+  record.data = chars + 4U + (2U * address_length);
+  record.data_length = byte_count - address_length - 1U;
+  record.next_offset = SkipLineEnding(content, offset + 4U + (2U * byte_count));
+  return std::nullopt;
+}
+
+/**
+ * @brief       Function to parse a record of the image format
+ * @param[in]   content
+ *              The image content
+ * @param[in]   format
+ *              The image format, Intel HEX or Motorola S-record
+ * @param[in]   offset
+ *              The offset of the record
+ * @param[in]   verify_checksum
+ *              True to verify digits and checksum of the whole record
+ * @param[out]  record
+ *              The record parsed
+ * @return      Nothing on success, error code otherwise
+ */
+inline std::optional<ImageFileErrorCode> ParseRecord(core_type::Span<std::uint8_t const> content,
+                                                     ImageFormat format, std::size_t offset,
+                                                     bool verify_checksum, Record &record) noexcept {
+  return format == ImageFormat::kIntelHex
+             ? ParseIntelHexRecord(content, offset, verify_checksum, record)
+             : ParseSRecord(content, offset, verify_checksum, record);
+}
+
+/**
+ * @brief       Function to parse the segments of Intel HEX or Motorola S-record content
+ * @param[in]   content
+ *              The image content
+ * @param[in]   format
+ *              The image format
+ * @param[out]  segments
+ *              The segments in file order
+ * @return      Nothing on success, error code otherwise
+ */
+std::optional<ImageFileErrorCode> ParseRecords(core_type::Span<std::uint8_t const> content,
+                                               ImageFormat format,
+                                               std::vector<ImageSegment> &segments) noexcept {
+  std::uint64_t base_address{0U};
+  bool is_end_of_file{false};
+  Record record{};
+  std::size_t offset{SkipLineEnding(content, 0U)};
+  while (!is_end_of_file && (offset < content.size())) {
+    std::optional<ImageFileErrorCode> const error{
+        ParseRecord(content, format, offset, true, record)};
+    if (error.has_value()) { return error; }
+    switch (record.kind) {
+      case RecordKind::kData:
+        if (record.data_length != 0U) {
+          std::uint64_t const address{base_address + record.address};
+          // records continuing the previous one extend its segment
+          if (!segments.empty() &&
+              (segments.back().address + segments.back().length == address)) {
+            segments.back().length += record.data_length;
+          } else {
+            segments.emplace_back(ImageSegment{address, record.data_length, offset});
+          }
+        }
+        break;
+      case RecordKind::kExtendedSegmentAddress:
+        base_address = DecodeHexValue(record.data, 2U) << 4U;
+        break;
+      case RecordKind::kExtendedLinearAddress:
+        base_address = DecodeHexValue(record.data, 2U) << 16U;
+        break;
+      case RecordKind::kEndOfFile:
+        is_end_of_file = true;
+        break;
+      case RecordKind::kIgnored:
+        break;
+    }
+    offset = record.next_offset;
+  }
+  // S-records may omit the termination record, Intel HEX requires the end of file record
+  if (!is_end_of_file && (format == ImageFormat::kIntelHex)) {
+    return ImageFileErrorCode::kMissingEndOfFile;
+  }
+  std::vector<ImageSegment> sorted_segments{segments};
+  std::sort(sorted_segments.begin(), sorted_segments.end(),
+            [](ImageSegment const &lhs, ImageSegment const &rhs) {
+              return lhs.address < rhs.address;
+            });
+  for (std::size_t index{1U}; index < sorted_segments.size(); ++index) {
+    if ((sorted_segments[index - 1U].address + sorted_segments[index - 1U].length) >
+        sorted_segments[index].address) {
+      return ImageFileErrorCode::kOverlappingSegment;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+ImageFile::SegmentReader::SegmentReader(core_type::Span<std::uint8_t const> content,
+                                        ImageFormat format, ImageSegment const &segment) noexcept
+    : content_{content},
+      format_{format},
+      position_{segment.file_offset},
+      remaining_length_{segment.length},
+      record_data_{nullptr},
+      record_remaining_{0U},
+      buffer_{} {}
+
+core_type::Span<std::uint8_t const> ImageFile::SegmentReader::Read(std::size_t max_length) noexcept {
+  std::size_t const length{std::min(max_length, remaining_length_)};
+  if (format_ == ImageFormat::kBinary) {
+    core_type::Span<std::uint8_t const> const data{content_.subspan(position_, length)};
+    position_ += length;
+    remaining_length_ -= length;
+    return data;
+  }
+  buffer_.resize(length);
+  std::size_t decoded{0U};
+  while (decoded < length) {
+    if ((record_remaining_ == 0U) && !NextDataRecord()) { break; }
+    std::size_t const count{std::min(record_remaining_, length - decoded)};
+    DecodeHexBytes(record_data_, count, buffer_.data() + decoded);
+    record_data_ += 2U * count;
+    record_remaining_ -= count;
+    decoded += count;
+  }
+  // a file changed after validation ends the segment early
+  remaining_length_ = (decoded == length) ? (remaining_length_ - length) : 0U;
+  return core_type::Span<std::uint8_t const>{buffer_.data(), decoded};
+}
+
+bool ImageFile::SegmentReader::NextDataRecord() noexcept {
+  Record record{};
+  bool is_found{false};
+  while (!is_found && (position_ < content_.size())) {
+    if (ParseRecord(content_, format_, position_, false, record).has_value() ||
+        (record.kind == RecordKind::kEndOfFile)) {
+      break;
+    }
+    position_ = record.next_offset;
+    if ((record.kind == RecordKind::kData) && (record.data_length != 0U)) {
+      record_data_ = record.data;
+      record_remaining_ = record.data_length;
+      is_found = true;
+    }
+  }
+  return is_found;
+}
+
+ImageFile::ImageFile() noexcept : mapped_file_{}, format_{ImageFormat::kBinary}, segments_{} {}
+
+std::size_t ImageFile::GetLength() const noexcept {
+  std::size_t length{0U};
+  for (ImageSegment const &segment: segments_) { length += segment.length; }
+  return length;
+}
+
+ImageFile::SegmentReader ImageFile::GetSegmentReader(ImageSegment const &segment) const noexcept {
+  return SegmentReader{mapped_file_.GetData(), format_, segment};
+}
+
+ImageFormat ImageFile::DetectFormat(std::string_view file_path) noexcept {
+  std::string extension{std::filesystem::path{file_path}.extension().string()};
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char character) {
+    return static_cast<char>(std::tolower(character));
+  });
+  ImageFormat format{ImageFormat::kBinary};
+  if ((extension == ".hex") || (extension == ".ihex")) {
+    format = ImageFormat::kIntelHex;
+  } else if ((extension == ".s19") || (extension == ".s28") || (extension == ".s37") ||
+             (extension == ".srec") || (extension == ".mot")) {
+    format = ImageFormat::kMotorolaSRecord;
+  }
+  return format;
+}
+
+core_type::Result<ImageFile, ImageFileErrorCode> ImageFile::Open(
+    std::string_view file_path, std::uint64_t binary_address) noexcept {
+  core_type::Result<ImageFile, ImageFileErrorCode> open_result{
+      core_type::Result<ImageFile, ImageFileErrorCode>::FromError(ImageFileErrorCode::kOpenFailed)};
+  core_type::Result<MappedFile, MappedFileErrorCode> mapped_file{MappedFile::Open(file_path)};
+  if (mapped_file.HasValue()) {
+    ImageFile image_file{};
+    image_file.format_ = DetectFormat(file_path);
+    image_file.mapped_file_ = std::move(mapped_file).Value();
+    core_type::Result<std::vector<ImageSegment>, ImageFileErrorCode> segments{
+        Parse(image_file.mapped_file_.GetData(), image_file.format_, binary_address)};
+    if (segments.HasValue()) {
+      image_file.segments_ = std::move(segments).Value();
+      open_result.EmplaceValue(std::move(image_file));
+    } else {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [&segments, file_path](std::stringstream &msg) {
+            msg << "Parsing of image <" << file_path << "> failed with error: "
+                << static_cast<std::uint32_t>(segments.Error());
+          });
+      open_result.EmplaceError(segments.Error());
+    }
+  }
+  return open_result;
+}
+
+core_type::Result<std::vector<ImageSegment>, ImageFileErrorCode> ImageFile::Parse(
+    core_type::Span<std::uint8_t const> content, ImageFormat format,
+    std::uint64_t binary_address) noexcept {
+  std::vector<ImageSegment> segments{};
+  std::optional<ImageFileErrorCode> error{};
+  if (format == ImageFormat::kBinary) {
+    if (!content.empty()) { segments.emplace_back(ImageSegment{binary_address, content.size(), 0U}); }
+  } else {
+    error = ParseRecords(content, format, segments);
+  }
+  return error.has_value()
+             ? core_type::Result<std::vector<ImageSegment>, ImageFileErrorCode>::FromError(
+                   error.value())
+             : core_type::Result<std::vector<ImageSegment>, ImageFileErrorCode>::FromValue(
+                   std::move(segments));
+}
+
+}  // namespace file
+}  // namespace boost_support
@@ -0,0 +1,99 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "boost-support/file/mapped_file.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <filesystem>
+#include <string>
+
+#include "boost-support/common/logger.h"
+
+namespace boost_support {
+namespace file {
+
+/**
+ * @brief       Class holding the file mapping and the region mapped
+ */
+class MappedFile::MappedFileImpl final {
+ public:
+  /**
+   * @brief         Constructs an instance of MappedFileImpl
+   * @param[in]     file_path
+   *                The path to file
+   * @throws        boost::interprocess::interprocess_exception on failure
+   */
+  explicit MappedFileImpl(std::string const &file_path)
+      : file_mapping_{file_path.c_str(), boost::interprocess::read_only},
+        mapped_region_{} {
+    std::error_code error_code{};
+    std::uintmax_t const file_size{std::filesystem::file_size(file_path, error_code)};
+    // empty files cannot be mapped, they are represented by empty data
+    if (!error_code && (file_size > 0u)) {
+      mapped_region_ =
+          boost::interprocess::mapped_region{file_mapping_, boost::interprocess::read_only};
+      static_cast<void>(
+          mapped_region_.advise(boost::interprocess::mapped_region::advice_sequential));
+    }
+  }
+
+  /**
+   * @brief         Function to get the mapped file content
+   * @return        The view onto the whole file
+   */
+  core_type::Span<std::uint8_t const> GetData() const noexcept {
+    return core_type::Span<std::uint8_t const>{
+        static_cast<std::uint8_t const *>(mapped_region_.get_address()), mapped_region_.get_size()};
+  }
+
+ private:
+  /**
+   * @brief         Store the file mapping
+   */
+  boost::interprocess::file_mapping file_mapping_;
+
+  /**
+   * @brief         Store the region of file mapped
+   */
+  boost::interprocess::mapped_region mapped_region_;
+};
+
+MappedFile::MappedFile() noexcept : mapped_file_impl_{} {}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept = default;
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept = default;
+
+MappedFile::~MappedFile() noexcept = default;
+
+core_type::Span<std::uint8_t const> MappedFile::GetData() const noexcept {
+  return mapped_file_impl_ != nullptr ? mapped_file_impl_->GetData()
+                                      : core_type::Span<std::uint8_t const>{};
+}
+
+core_type::Result<MappedFile, MappedFileErrorCode> MappedFile::Open(
+    std::string_view file_path) noexcept {
+  core_type::Result<MappedFile, MappedFileErrorCode> open_result{
+      core_type::Result<MappedFile, MappedFileErrorCode>::FromError(
+          MappedFileErrorCode::kOpenFailed)};
+  try {
+    MappedFile mapped_file{};
+    mapped_file.mapped_file_impl_ = std::make_unique<MappedFileImpl>(std::string{file_path});
+    open_result.EmplaceValue(std::move(mapped_file));
+  } catch (boost::interprocess::interprocess_exception const &error) {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&error, file_path](std::stringstream &msg) {
+          msg << "Mapping of file <" << file_path << "> failed with error: " << error.what();
+        });
+  }
+  return open_result;
+}
+
+}  // namespace file
+}  // namespace boost_support
@@ -0,0 +1,45 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "boost-support/network/ip_address.h"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/network_v4.hpp>
+
+namespace boost_support {
+namespace network {
+
+core_type::Result<std::vector<std::string>, IpAddressErrorCode> GetHostAddresses(
+    std::string_view address, std::size_t max_address_count) noexcept {
+  core_type::Result<std::vector<std::string>, IpAddressErrorCode> result{
+      IpAddressErrorCode::kInvalidAddress};
+  boost::system::error_code error{};
+  if (address.find('/') == std::string_view::npos) {
+    boost::asio::ip::address const host_address{boost::asio::ip::make_address(address, error)};
+    if (!error) { result.EmplaceValue(std::vector<std::string>{host_address.to_string()}); }
+  } else {
+    boost::asio::ip::network_v4 const network{boost::asio::ip::make_network_v4(address, error)};
+    if (!error) {
+      boost::asio::ip::address_v4_range const hosts{network.hosts()};
+      if (hosts.size() > max_address_count) {
+        result.EmplaceError(IpAddressErrorCode::kTooManyAddresses);
+      } else {
+        std::vector<std::string> host_addresses{};
+        host_addresses.reserve(hosts.size());
+        for (boost::asio::ip::address_v4 const &host_address: hosts) {
+          host_addresses.emplace_back(host_address.to_string());
+        }
+        result.EmplaceValue(std::move(host_addresses));
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace network
+}  // namespace boost_support
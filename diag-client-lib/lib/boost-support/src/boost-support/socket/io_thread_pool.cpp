@@ -0,0 +1,55 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "boost-support/socket/io_thread_pool.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "boost-support/common/logger.h"
+
+namespace boost_support {
+namespace socket {
+
+std::atomic<std::size_t> IoThreadPool::requested_thread_count_{0u};
+
+void IoThreadPool::SetThreadCount(std::size_t thread_count) noexcept {
+  requested_thread_count_ = thread_count;
+}
+
+IoThreadPool &IoThreadPool::GetIoThreadPool() noexcept {
+  static IoThreadPool io_thread_pool{requested_thread_count_ != 0u
+                                         ? requested_thread_count_.load()
+                                         : std::max(1u, std::thread::hardware_concurrency())};
+  return io_thread_pool;
+}
+
+IoThreadPool::IoThreadPool(std::size_t thread_count) noexcept
+    : io_context_{static_cast<int>(thread_count)},
+      work_guard_{boost::asio::make_work_guard(io_context_)},
+      threads_{} {
+  threads_.reserve(thread_count);
+  for (std::size_t thread_index{0u}; thread_index < thread_count; thread_index++) {
+    threads_.emplace_back("IoThreadPool_" + std::to_string(thread_index),
+                          [this]() { io_context_.run(); });
+  }
+  common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogInfo(
+      FILE_NAME, __LINE__, __func__, [thread_count](std::stringstream &msg) {
+        msg << "Io thread pool started with " << thread_count << " threads";
+      });
+}
+
+IoThreadPool::~IoThreadPool() noexcept {
+  work_guard_.reset();
+  io_context_.stop();
+  for (utility::thread::Thread &thread: threads_) { thread.Join(); }
+}
+
+}  // namespace socket
+}  // namespace boost_support
@@ -0,0 +1,113 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_THREAD_POOL_H_
+#define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_THREAD_POOL_H_
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "utility/thread.h"
+
+namespace boost_support {
+namespace socket {
+
+/**
+ * @brief       Library wide pool of threads running one shared boost io context
+ * @details     All io objects (sockets) of the clients are created on this context, their handlers are serialized per
+ *              io object with a strand. The number of threads thus depends on the cores and not on the number of
+ *              connections.
+ */
+class IoThreadPool final {
+ public:
+  /**
+   * @brief  Type alias for boost context
+   */
+  using Context = boost::asio::io_context;
+
+ public:
+  /**
+   * @brief         Function to set the number of threads of the pool
+   * @details       Only effective before the pool is used for the first time
+   * @param[in]     thread_count
+   *                The number of threads, zero selects the number of hardware threads
+   */
+  static void SetThreadCount(std::size_t thread_count) noexcept;
+
+  /**
+   * @brief         Function to get the pool, the threads are started on first call
+   * @return        The reference to pool
+   */
+  static IoThreadPool &GetIoThreadPool() noexcept;
+
+  /**
+   * @brief  Deleted copy assignment and copy constructor
+   */
+  IoThreadPool(const IoThreadPool &other) noexcept = delete;
+  IoThreadPool &operator=(const IoThreadPool &other) noexcept = delete;
+
+  /**
+   * @brief  Deleted move assignment and move constructor
+   */
+  IoThreadPool(IoThreadPool &&other) noexcept = delete;
+  IoThreadPool &operator=(IoThreadPool &&other) noexcept = delete;
+
+  /**
+   * @brief         Function to get the io context reference
+   * @return        The reference to io context
+   */
+  Context &GetContext() noexcept { return io_context_; }
+
+  /**
+   * @brief         Function to get the number of threads running the io context
+   * @return        The number of threads
+   */
+  std::size_t GetThreadCount() const noexcept { return threads_.size(); }
+
+ private:
+  /**
+   * @brief         Constructs an instance of IoThreadPool and start the threads
+   * @param[in]     thread_count
+   *                The number of threads
+   */
+  explicit IoThreadPool(std::size_t thread_count) noexcept;
+
+  /**
+   * @brief         Destruct an instance of IoThreadPool, stopping and joining the threads
+   */
+  ~IoThreadPool() noexcept;
+
+  /**
+   * @brief  Type alias for work guard keeping the io context running without pending work
+   */
+  using WorkGuard = boost::asio::executor_work_guard<Context::executor_type>;
+
+  /**
+   * @brief  Store the requested number of threads
+   */
+  static std::atomic<std::size_t> requested_thread_count_;
+
+  /**
+   * @brief  boost io context
+   */
+  Context io_context_;
+
+  /**
+   * @brief  Store the work guard
+   */
+  WorkGuard work_guard_;
+
+  /**
+   * @brief  Store the threads
+   */
+  std::vector<utility::thread::Thread> threads_;
+};
+}  // namespace socket
+}  // namespace boost_support
+#endif  // DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_IO_THREAD_POOL_H_
@@ -8,6 +8,12 @@
 
 #include "boost-support/socket/tcp/tcp_socket.h"
 
+#include <netinet/tcp.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
 #include <utility>
 
 #include "boost-support/common/logger.h"
@@ -15,15 +21,95 @@
 namespace boost_support {
 namespace socket {
 namespace tcp {
+namespace {
+
+/**
+ * @brief  Size of receive buffer, sized to hold many small frames or one full default sized diagnostic message
+ */
+constexpr std::size_t kRxBufferSize{8192u};
+
+/**
+ * @brief  Number of unanswered keep-alive probes after which the connection is dropped
+ */
+constexpr int kLivenessProbeCount{3};
+
+/**
+ * @brief  Type alias for socket option setting the idle time before the first keep-alive probe in seconds
+ */
+using KeepAliveIdle = boost::asio::detail::socket_option::integer<IPPROTO_TCP, TCP_KEEPIDLE>;
+
+/**
+ * @brief  Type alias for socket option setting the time between keep-alive probes in seconds
+ */
+using KeepAliveInterval = boost::asio::detail::socket_option::integer<IPPROTO_TCP, TCP_KEEPINTVL>;
+
+/**
+ * @brief  Type alias for socket option setting the number of keep-alive probes
+ */
+using KeepAliveCount = boost::asio::detail::socket_option::integer<IPPROTO_TCP, TCP_KEEPCNT>;
+
+/**
+ * @brief  Type alias for socket option setting the time sent data may stay unacknowledged in milliseconds
+ */
+using UserTimeout = boost::asio::detail::socket_option::integer<IPPROTO_TCP, TCP_USER_TIMEOUT>;
+
+/**
+ * @brief       Function to get the payload length from doip header
+ * @param[in]   header
+ *              The pointer to start of header
+ * @return      The payload length
+ */
+auto GetDoipPayloadLength(std::uint8_t const *header) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>((static_cast<std::uint32_t>(header[4u] << 24u) & 0xFF000000) |
+                                    (static_cast<std::uint32_t>(header[5u] << 16u) & 0x00FF0000) |
+                                    (static_cast<std::uint32_t>(header[6u] << 8u) & 0x0000FF00) |
+                                    (static_cast<std::uint32_t>(header[7u] & 0x000000FF)));
+}
+
+}  // namespace
+
+std::atomic<std::int64_t> TcpSocket::liveness_timeout_ms_{0};
+
+void TcpSocket::SetLivenessTimeout(std::chrono::milliseconds liveness_timeout) noexcept {
+  liveness_timeout_ms_ =
+      std::max(std::int64_t{0}, static_cast<std::int64_t>(liveness_timeout.count()));
+}
 
 TcpSocket::TcpSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
-                     IoContext &io_context) noexcept
-    : tcp_socket_{io_context.GetContext()},
-      local_endpoint_{boost::asio::ip::make_address(local_ip_address), local_port_num} {}
+                     boost::asio::io_context &io_context) noexcept
+    : tcp_socket_{io_context},
+      strand_{boost::asio::make_strand(tcp_socket_.get_executor())},
+      local_endpoint_{boost::asio::ip::make_address(local_ip_address), local_port_num},
+      remote_ip_address_{},
+      remote_port_num_{},
+      rx_buffer_(kRxBufferSize),
+      rx_buffer_begin_{},
+      rx_buffer_end_{},
+      max_payload_length_{std::numeric_limits<std::uint32_t>::max()},
+      discard_length_{},
+      fragmented_reception_{false},
+      fragment_offset_{},
+      fragment_remaining_{} {}
 
 TcpSocket::TcpSocket(TcpSocket::Socket socket) noexcept
     : tcp_socket_{std::move(socket)},
-      local_endpoint_{tcp_socket_.local_endpoint()} {}
+      strand_{boost::asio::make_strand(tcp_socket_.get_executor())},
+      local_endpoint_{tcp_socket_.local_endpoint()},
+      remote_ip_address_{},
+      remote_port_num_{},
+      rx_buffer_(kRxBufferSize),
+      rx_buffer_begin_{},
+      rx_buffer_end_{},
+      max_payload_length_{std::numeric_limits<std::uint32_t>::max()},
+      discard_length_{},
+      fragmented_reception_{false},
+      fragment_offset_{},
+      fragment_remaining_{} {
+  // accepted socket is already connected, messages are written as a whole so send them without delay
+  TcpErrorCodeType ec{};
+  tcp_socket_.set_option(Tcp::no_delay{true}, ec);
+  ResetReception();
+}
 
 TcpSocket::~TcpSocket() noexcept = default;
 
@@ -36,6 +122,8 @@ core_type::Result<void, TcpSocket::SocketError> TcpSocket::Open() noexcept {
   if (ec.value() == boost::system::errc::success) {
     // reuse address
     tcp_socket_.set_option(boost::asio::socket_base::reuse_address{true});
+    // messages are written as a whole, send them without waiting for acknowledgement of previous one
+    tcp_socket_.set_option(Tcp::no_delay{true});
     // Set socket to non blocking
     tcp_socket_.non_blocking(false);
     // Bind to local ip address and random port
@@ -78,11 +166,12 @@ core_type::Result<void, TcpSocket::SocketError> TcpSocket::Connect(
   tcp_socket_.connect(
       Tcp::endpoint(TcpIpAddress::from_string(std::string{host_ip_address}), host_port_num), ec);
   if (ec.value() == boost::system::errc::success) {
+    ResetReception();
+    EnableLivenessProbe();
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
-          Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint()};
           msg << "Tcp Socket connected to host "
-              << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
+              << "<" << remote_ip_address_ << "," << remote_port_num_ << ">";
         });
     result.EmplaceValue();
   } else {
@@ -124,9 +213,8 @@ core_type::Result<void, TcpSocket::SocketError> TcpSocket::Transmit(
   if (ec.value() == boost::system::errc::success) {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
-          Tcp::endpoint const endpoint_{tcp_socket_.remote_endpoint()};
           msg << "Tcp message sent to "
-              << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
+              << "<" << remote_ip_address_ << "," << remote_port_num_ << ">";
         });
     result.EmplaceValue();
   } else {
@@ -138,11 +226,48 @@ core_type::Result<void, TcpSocket::SocketError> TcpSocket::Transmit(
   return result;
 }
 
+core_type::Result<void, TcpSocket::SocketError> TcpSocket::Transmit(
+    TcpMessageBufferViews buffer_views) noexcept {
+  core_type::Result<void, SocketError> result{SocketError::kGenericError};
+  TcpErrorCodeType ec{};
+
+  if (buffer_views.size() <= kMaxTransmitBufferCount) {
+    // unused entries stay empty and are skipped by the write
+    std::array<boost::asio::const_buffer, kMaxTransmitBufferCount> buffers{};
+    std::transform(buffer_views.begin(), buffer_views.end(), buffers.begin(),
+                   [](message::tcp::TcpMessageBufferView const buffer_view) {
+                     return boost::asio::buffer(buffer_view.data(), buffer_view.size());
+                   });
+    boost::asio::write(tcp_socket_, buffers, ec);
+    // Check for error
+    if (ec.value() == boost::system::errc::success) {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+          FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
+            msg << "Tcp message sent to "
+                << "<" << remote_ip_address_ << "," << remote_port_num_ << ">";
+          });
+      result.EmplaceValue();
+    } else {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [ec](std::stringstream &msg) {
+            msg << "Tcp message sending failed with error: " << ec.message();
+          });
+    }
+  } else {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&buffer_views](std::stringstream &msg) {
+          msg << "Tcp message sending failed, too many buffers: " << buffer_views.size();
+        });
+  }
+  return result;
+}
+
 core_type::Result<void, TcpSocket::SocketError> TcpSocket::Close() noexcept {
   core_type::Result<void, SocketError> result{SocketError::kGenericError};
-  // destroy the socket
-  tcp_socket_.shutdown(boost::asio::socket_base::shutdown_receive);
-  tcp_socket_.close();
+  TcpErrorCodeType ec{};
+  // destroy the socket, shutdown fails when the connection is already lost
+  tcp_socket_.shutdown(boost::asio::socket_base::shutdown_receive, ec);
+  tcp_socket_.close(ec);
   result.EmplaceValue();
   return result;
 }
@@ -150,46 +275,213 @@ core_type::Result<void, TcpSocket::SocketError> TcpSocket::Close() noexcept {
 core_type::Result<TcpSocket::TcpMessagePtr, TcpSocket::SocketError> TcpSocket::Read() noexcept {
   core_type::Result<TcpMessagePtr, SocketError> result{SocketError::kRemoteDisconnected};
   TcpErrorCodeType ec{};
-  // create and reserve the buffer
-  TcpMessage::BufferType rx_buffer{};
-  rx_buffer.resize(message::tcp::kDoipheadrSize);
-  // start blocking read to read Header first
-  boost::asio::read(tcp_socket_, boost::asio::buffer(&rx_buffer[0u], message::tcp::kDoipheadrSize),
-                    ec);
+  // Skip the payload of previous frame delivered as header only
+  DiscardBuffered();
+  while ((discard_length_ != 0u) && (ec.value() == boost::system::errc::success)) {
+    ReceiveIntoBuffer(ec);
+    DiscardBuffered();
+  }
+  // Header of next frame may already be buffered from previous read
+  while ((GetBufferedSize() < message::tcp::kDoipheadrSize) &&
+         (ec.value() == boost::system::errc::success)) {
+    ReceiveIntoBuffer(ec);
+  }
   // Check for error
   if (ec.value() == boost::system::errc::success) {
-    // read the next bytes to read
-    std::uint32_t const read_next_bytes{[&rx_buffer]() noexcept -> std::uint32_t {
-      return static_cast<std::uint32_t>(
-          (static_cast<std::uint32_t>(rx_buffer[4u] << 24u) & 0xFF000000) |
-          (static_cast<std::uint32_t>(rx_buffer[5u] << 16u) & 0x00FF0000) |
-          (static_cast<std::uint32_t>(rx_buffer[6u] << 8u) & 0x0000FF00) |
-          (static_cast<std::uint32_t>(rx_buffer[7u] & 0x000000FF)));
-    }()};
-
-    if (read_next_bytes != 0u) {
-      // reserve the buffer
-      rx_buffer.resize(message::tcp::kDoipheadrSize + std::size_t(read_next_bytes));
-      boost::asio::read(
-          tcp_socket_,
-          boost::asio::buffer(&rx_buffer[message::tcp::kDoipheadrSize], read_next_bytes), ec);
-
-      Tcp::endpoint const remote_endpoint{tcp_socket_.remote_endpoint()};
-      TcpMessagePtr tcp_rx_message{std::make_unique<TcpMessage>(
-          remote_endpoint.address().to_string(), remote_endpoint.port(), std::move(rx_buffer))};
-      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-          FILE_NAME, __LINE__, __func__, [&remote_endpoint](std::stringstream &msg) {
-            msg << "Tcp Message received from "
-                << "<" << remote_endpoint.address().to_string() << "," << remote_endpoint.port()
-                << ">";
-          });
-      result.EmplaceValue(std::move(tcp_rx_message));
-    } else {
-      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
-          FILE_NAME, __LINE__, __func__,
-          [](std::stringstream &msg) { msg << "Tcp Message read ignored as header size is zero"; });
+    // read the next bytes to read, header only frames like alive check request are complete already
+    std::size_t const frame_size{DecodeFrameSize()};
+    // Frames fitting in receive buffer are completed there, together with following frames
+    if (frame_size <= rx_buffer_.size()) {
+      while ((GetBufferedSize() < frame_size) && (ec.value() == boost::system::errc::success)) {
+        ReceiveIntoBuffer(ec);
+      }
+    }
+    if (ec.value() == boost::system::errc::success) {
+      std::size_t const buffered_size{std::min(frame_size, GetBufferedSize())};
+      TcpMessage::BufferType rx_message_buffer(
+          rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_),
+          rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_ + buffered_size));
+      rx_buffer_begin_ += buffered_size;
+      // remaining bytes of large frame are read directly into the message
+      while ((rx_message_buffer.size() < frame_size) &&
+             (ec.value() == boost::system::errc::success)) {
+        boost::asio::read(tcp_socket_, GrowFrameBuffer(rx_message_buffer, frame_size), ec);
+      }
+      if (ec.value() == boost::system::errc::success) {
+        result.EmplaceValue(CreateMessage(std::move(rx_message_buffer)));
+      }
+    }
+  }
+
+  if (ec.value() != boost::system::errc::success) { LogReceptionError(ec); }
+  return result;
+}
+
+void TcpSocket::AsyncRead(ReadHandler read_handler) noexcept {
+  // posted, so that re-arming from a read handler does not nest once per buffered frame
+  boost::asio::post(strand_, [this, read_handler{std::move(read_handler)}]() mutable {
+    DecodeOrReceive(std::move(read_handler));
+  });
+}
+
+void TcpSocket::DecodeOrReceive(ReadHandler read_handler) noexcept {
+  // Skip the payload of previous frame delivered as header only
+  DiscardBuffered();
+  if (fragment_remaining_ != 0u) {
+    // Next fragment of large frame, delivered with whatever is buffered
+    if (GetBufferedSize() != 0u) {
+      read_handler(ReadResult::FromValue(TakeFragment()));
+      return;
     }
-  } else if (ec.value() == boost::asio::error::eof) {
+  } else if ((discard_length_ == 0u) && (GetBufferedSize() >= message::tcp::kDoipheadrSize)) {
+    // Frames without payload like alive check request are delivered as header only
+    std::size_t const frame_size{DecodeFrameSize()};
+    if (GetBufferedSize() >= frame_size) {
+      // Complete frame already buffered
+      TcpMessage::BufferType rx_message_buffer(
+          rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_),
+          rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_ + frame_size));
+      rx_buffer_begin_ += frame_size;
+      read_handler(ReadResult::FromValue(CreateMessage(std::move(rx_message_buffer))));
+      return;
+    }
+    if (frame_size > rx_buffer_.size()) {
+      if (fragmented_reception_) {
+        // First fragment is delivered once the receive buffer is filled with the beginning of the frame
+        if (GetBufferedSize() == rx_buffer_.size()) {
+          fragment_offset_ = 0u;
+          fragment_remaining_ = frame_size;
+          read_handler(ReadResult::FromValue(TakeFragment()));
+          return;
+        }
+      } else {
+        // remaining bytes of large frame are read directly into the message
+        std::size_t const buffered_size{GetBufferedSize()};
+        std::shared_ptr<TcpMessage::BufferType> rx_message_buffer{
+            std::make_shared<TcpMessage::BufferType>(
+                rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_),
+                rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_ + buffered_size))};
+        rx_buffer_begin_ += buffered_size;
+        ReceiveFrameChunk(std::move(rx_message_buffer), frame_size, std::move(read_handler));
+        return;
+      }
+    }
+  }
+
+  // Frame incomplete or payload skipped, receive whatever is available next
+  CompactBuffer();
+  tcp_socket_.async_read_some(
+      boost::asio::buffer(&rx_buffer_[rx_buffer_end_], rx_buffer_.size() - rx_buffer_end_),
+      boost::asio::bind_executor(
+          strand_, [this, read_handler{std::move(read_handler)}](TcpErrorCodeType const &ec,
+                                                                 std::size_t bytes_received) mutable {
+            if (ec.value() == boost::system::errc::success) {
+              rx_buffer_end_ += bytes_received;
+              DecodeOrReceive(std::move(read_handler));
+            } else {
+              LogReceptionError(ec);
+              read_handler(ReadResult::FromError(SocketError::kRemoteDisconnected));
+            }
+          }));
+}
+
+void TcpSocket::ReceiveFrameChunk(std::shared_ptr<TcpMessage::BufferType> rx_message_buffer,
+                                  std::size_t frame_size, ReadHandler read_handler) noexcept {
+  boost::asio::mutable_buffer const chunk{GrowFrameBuffer(*rx_message_buffer, frame_size)};
+  boost::asio::async_read(
+      tcp_socket_, chunk,
+      boost::asio::bind_executor(
+          strand_, [this, rx_message_buffer{std::move(rx_message_buffer)}, frame_size,
+                    read_handler{std::move(read_handler)}](TcpErrorCodeType const &ec,
+                                                           std::size_t) mutable {
+            if (ec.value() == boost::system::errc::success) {
+              if (rx_message_buffer->size() < frame_size) {
+                ReceiveFrameChunk(std::move(rx_message_buffer), frame_size, std::move(read_handler));
+              } else {
+                read_handler(ReadResult::FromValue(CreateMessage(std::move(*rx_message_buffer))));
+              }
+            } else {
+              LogReceptionError(ec);
+              read_handler(ReadResult::FromError(SocketError::kRemoteDisconnected));
+            }
+          }));
+}
+
+boost::asio::mutable_buffer TcpSocket::GrowFrameBuffer(TcpMessage::BufferType &rx_message_buffer,
+                                                       std::size_t frame_size) noexcept {
+  std::size_t const received_size{rx_message_buffer.size()};
+  std::size_t const chunk_size{
+      std::min(frame_size - received_size, std::max(received_size, kRxBufferSize))};
+  rx_message_buffer.resize(received_size + chunk_size);
+  return boost::asio::buffer(&rx_message_buffer[received_size], chunk_size);
+}
+
+void TcpSocket::ReceiveIntoBuffer(TcpErrorCodeType &ec) noexcept {
+  CompactBuffer();
+  // Blocking read of whatever is available, possibly several frames
+  rx_buffer_end_ += tcp_socket_.read_some(
+      boost::asio::buffer(&rx_buffer_[rx_buffer_end_], rx_buffer_.size() - rx_buffer_end_), ec);
+}
+
+void TcpSocket::CompactBuffer() noexcept {
+  // Move not yet decoded bytes to the front, this is at most one partial frame
+  if (rx_buffer_begin_ != 0u) {
+    std::copy(rx_buffer_.begin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_),
+              rx_buffer_.begin() + static_cast<std::ptrdiff_t>(rx_buffer_end_), rx_buffer_.begin());
+    rx_buffer_end_ -= rx_buffer_begin_;
+    rx_buffer_begin_ = 0u;
+  }
+}
+
+std::size_t TcpSocket::DecodeFrameSize() noexcept {
+  std::uint8_t const *header{&rx_buffer_[rx_buffer_begin_]};
+  std::uint32_t const payload_length{GetDoipPayloadLength(header)};
+  std::size_t frame_size{message::tcp::kDoipheadrSize + std::size_t{payload_length}};
+  if (header[1u] != static_cast<std::uint8_t>(~header[0u])) {
+    // length of corrupted header is not trusted, everything buffered after the header is dropped
+    frame_size = message::tcp::kDoipheadrSize;
+    discard_length_ = GetBufferedSize() - message::tcp::kDoipheadrSize;
+  } else if (payload_length > max_payload_length_) {
+    // payload is skipped, so that a huge length neither allocates nor blocks on the full frame
+    frame_size = message::tcp::kDoipheadrSize;
+    discard_length_ = payload_length;
+  }
+  return frame_size;
+}
+
+void TcpSocket::DiscardBuffered() noexcept {
+  std::size_t const discarded_size{std::min(discard_length_, GetBufferedSize())};
+  rx_buffer_begin_ += discarded_size;
+  discard_length_ -= discarded_size;
+}
+
+TcpSocket::TcpMessagePtr TcpSocket::TakeFragment() noexcept {
+  std::size_t const fragment_size{std::min(fragment_remaining_, GetBufferedSize())};
+  TcpMessage::BufferType rx_message_buffer(
+      rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_),
+      rx_buffer_.cbegin() + static_cast<std::ptrdiff_t>(rx_buffer_begin_ + fragment_size));
+  rx_buffer_begin_ += fragment_size;
+  std::size_t const frame_offset{fragment_offset_};
+  fragment_offset_ += fragment_size;
+  fragment_remaining_ -= fragment_size;
+  return CreateMessage(std::move(rx_message_buffer), frame_offset);
+}
+
+TcpSocket::TcpMessagePtr TcpSocket::CreateMessage(TcpMessage::BufferType rx_message_buffer,
+                                                  std::size_t const frame_offset) noexcept {
+  TcpMessagePtr tcp_rx_message{std::make_unique<TcpMessage>(
+      remote_ip_address_, remote_port_num_, std::move(rx_message_buffer), frame_offset)};
+  common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+      FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
+        msg << "Tcp Message received from "
+            << "<" << remote_ip_address_ << "," << remote_port_num_ << ">";
+      });
+  return tcp_rx_message;
+}
+
+void TcpSocket::LogReceptionError(TcpErrorCodeType const &ec) noexcept {
+  if ((ec.value() == boost::asio::error::eof) ||
+      (ec.value() == boost::asio::error::operation_aborted)) {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
         FILE_NAME, __LINE__, __func__,
         [ec](std::stringstream &msg) { msg << "Remote Disconnected with: " << ec.message(); });
@@ -199,7 +491,45 @@ core_type::Result<TcpSocket::TcpMessagePtr, TcpSocket::SocketError> TcpSocket::R
           msg << "Remote Disconnected with undefined error: " << ec.message();
         });
   }
-  return result;
+}
+
+void TcpSocket::EnableLivenessProbe() noexcept {
+  std::int64_t const timeout_ms{liveness_timeout_ms_.load()};
+  if (timeout_ms != 0) {
+    // first probe after half of the timeout, the other half is shared by the probes
+    constexpr std::int64_t kMillisecondsPerSecond{1000};
+    int const idle_s{
+        static_cast<int>(std::max(std::int64_t{1}, (timeout_ms / 2) / kMillisecondsPerSecond))};
+    int const interval_s{static_cast<int>(std::max(
+        std::int64_t{1}, (timeout_ms / 2) / (kLivenessProbeCount * kMillisecondsPerSecond)))};
+    TcpErrorCodeType ec{};
+    tcp_socket_.set_option(boost::asio::socket_base::keep_alive{true}, ec);
+    if (!ec) { tcp_socket_.set_option(KeepAliveIdle{idle_s}, ec); }
+    if (!ec) { tcp_socket_.set_option(KeepAliveInterval{interval_s}, ec); }
+    if (!ec) { tcp_socket_.set_option(KeepAliveCount{kLivenessProbeCount}, ec); }
+    // keep-alive is suspended while sent data is unacknowledged, e.g. a request sent to a dead host
+    if (!ec) { tcp_socket_.set_option(UserTimeout{static_cast<int>(timeout_ms)}, ec); }
+    if (ec) {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogWarn(
+          FILE_NAME, __LINE__, __func__, [ec](std::stringstream &msg) {
+            msg << "Tcp Socket liveness probe not enabled: " << ec.message();
+          });
+    }
+  }
+}
+
+void TcpSocket::ResetReception() noexcept {
+  rx_buffer_begin_ = 0u;
+  rx_buffer_end_ = 0u;
+  discard_length_ = 0u;
+  fragment_offset_ = 0u;
+  fragment_remaining_ = 0u;
+  TcpErrorCodeType ec{};
+  Tcp::endpoint const remote_endpoint{tcp_socket_.remote_endpoint(ec)};
+  if (ec.value() == boost::system::errc::success) {
+    remote_ip_address_ = remote_endpoint.address().to_string();
+    remote_port_num_ = remote_endpoint.port();
+  }
 }
 }  // namespace tcp
 }  // namespace socket
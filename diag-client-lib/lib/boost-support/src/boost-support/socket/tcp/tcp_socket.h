@@ -8,10 +8,15 @@
 #ifndef DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_TCP_TCP_SOCKET_H_
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_TCP_TCP_SOCKET_H_
 
+#include <atomic>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "boost-support/message/tcp/tcp_message.h"
-#include "boost-support/socket/io_context.h"
 #include "core/include/result.h"
 
 namespace boost_support {
@@ -48,6 +53,16 @@ class TcpSocket final {
    */
   using TcpMessageConstPtr = boost_support::message::tcp::TcpMessageConstPtr;
 
+  /**
+   * @brief  Type alias for views on buffers of Tcp message
+   */
+  using TcpMessageBufferViews = boost_support::message::tcp::TcpMessageBufferViews;
+
+  /**
+   * @brief  Maximum number of buffers written with one vectored write
+   */
+  static constexpr std::size_t kMaxTransmitBufferCount{4u};
+
   /**
    * @brief  Type alias for tcp protocol
    */
@@ -58,6 +73,16 @@ class TcpSocket final {
    */
   using Socket = Tcp::socket;
 
+  /**
+   * @brief  Type alias for result of an asynchronous read
+   */
+  using ReadResult = core_type::Result<TcpMessagePtr, SocketError>;
+
+  /**
+   * @brief  Type alias for handler invoked with the result of an asynchronous read
+   */
+  using ReadHandler = std::function<void(ReadResult)>;
+
  public:
   /**
    * @brief         Constructs an instance of TcpSocket
@@ -69,7 +94,41 @@ class TcpSocket final {
    *                The I/O context required to create socket
    */
   TcpSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
-            IoContext &io_context) noexcept;
+            boost::asio::io_context &io_context) noexcept;
+
+  /**
+   * @brief         Function to set the liveness timeout applied on every following connect
+   * @param[in]     liveness_timeout
+   *                The liveness timeout, zero keeps the operating system defaults
+   */
+  static void SetLivenessTimeout(std::chrono::milliseconds liveness_timeout) noexcept;
+
+  /**
+   * @brief         Function to limit the payload length of frames received
+   * @details       Frames with larger payload and frames with corrupted header are delivered as header only, their
+   *                payload is skipped in chunks of the receive buffer without being stored. The limit is applied on the
+   *                strand, so that it may be changed while reading asynchronously, from the next frame header decoded.
+   * @param[in]     max_payload_length
+   *                The maximum payload length received, unlimited by default
+   */
+  void SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept {
+    boost::asio::post(strand_,
+                      [this, max_payload_length]() { max_payload_length_ = max_payload_length; });
+  }
+
+  /**
+   * @brief         Function to enable delivery of frames larger than the receive buffer in fragments
+   * @details       Applies to asynchronous reads only. The first fragment holds the header and fills the receive
+   *                buffer, the following fragments are delivered as their bytes arrive, so that the frame is never
+   *                stored as a whole. Applied on the strand like the payload limit.
+   * @param[in]     fragmented_reception
+   *                True to deliver fragments, disabled by default
+   */
+  void SetFragmentedReception(bool fragmented_reception) noexcept {
+    boost::asio::post(strand_, [this, fragmented_reception]() {
+      fragmented_reception_ = fragmented_reception;
+    });
+  }
 
   /**
    * @brief         Constructs an instance of TcpSocket
@@ -126,12 +185,33 @@ class TcpSocket final {
    */
   core_type::Result<void, SocketError> Transmit(TcpMessageConstPtr tcp_message) noexcept;
 
+  /**
+   * @brief         Function to trigger transmission of buffers with a single vectored write
+   * @details       The buffers are written back to back without being copied, they must stay valid until return
+   * @param[in]     buffer_views
+   *                The views on buffers to be transmitted, at most kMaxTransmitBufferCount
+   * @return        Empty result on success otherwise error code
+   */
+  core_type::Result<void, SocketError> Transmit(TcpMessageBufferViews buffer_views) noexcept;
+
   /**
    * @brief         Function to read message from socket
+   * @details       Socket is read in chunks into the receive buffer, so that frames arriving back to back are
+   *                decoded without further system calls. Frames larger than the receive buffer are completed by
+   *                reading directly into the message, which grows in chunks as the bytes arrive.
    * @return        Tcp message on success otherwise error code
    */
   core_type::Result<TcpMessagePtr, SocketError> Read() noexcept;
 
+  /**
+   * @brief         Function to read the next message from socket asynchronously
+   * @details       The same receive buffer as Read is used. The handler is invoked exactly once on the strand of this
+   *                socket, so at most one asynchronous read must be outstanding at a time.
+   * @param[in]     read_handler
+   *                The handler invoked with the tcp message on success otherwise error code
+   */
+  void AsyncRead(ReadHandler read_handler) noexcept;
+
   /**
    * @brief         Function to destroy the socket
    * @return        Empty result on success otherwise error code
@@ -149,15 +229,176 @@ class TcpSocket final {
    */
   using TcpErrorCodeType = boost::system::error_code;
 
+  /**
+   * @brief         Function to get the number of received bytes not yet decoded
+   * @return        The number of buffered bytes
+   */
+  std::size_t GetBufferedSize() const noexcept { return rx_buffer_end_ - rx_buffer_begin_; }
+
+  /**
+   * @brief         Function to read available data from socket into the receive buffer
+   * @details       Already decoded bytes are dropped first, so that the free space is maximum
+   * @param[out]    ec
+   *                The error code of the read
+   */
+  void ReceiveIntoBuffer(TcpErrorCodeType &ec) noexcept;
+
+  /**
+   * @brief         Function to move not yet decoded bytes to the front of the receive buffer
+   */
+  void CompactBuffer() noexcept;
+
+  /**
+   * @brief         Function to get the size of the frame starting in receive buffer
+   * @details       The header must be buffered. For frames delivered as header only, the bytes to be skipped after
+   *                the header are remembered.
+   * @return        The number of bytes of the frame delivered
+   */
+  std::size_t DecodeFrameSize() noexcept;
+
+  /**
+   * @brief         Function to drop buffered bytes of a frame being skipped
+   */
+  void DiscardBuffered() noexcept;
+
+  /**
+   * @brief         Function to decode the next frame from receive buffer or to continue receiving asynchronously
+   * @details       Must be called on the strand
+   * @param[in]     read_handler
+   *                The handler invoked once the frame is complete or reception failed
+   */
+  void DecodeOrReceive(ReadHandler read_handler) noexcept;
+
+  /**
+   * @brief         Function to receive the next chunk of a frame larger than the receive buffer asynchronously
+   * @details       Must be called on the strand. The message buffer is grown by the chunk received only.
+   * @param[in]     rx_message_buffer
+   *                The buffer containing the bytes of the frame received so far
+   * @param[in]     frame_size
+   *                The size of the complete frame
+   * @param[in]     read_handler
+   *                The handler invoked once the frame is complete or reception failed
+   */
+  void ReceiveFrameChunk(std::shared_ptr<TcpMessage::BufferType> rx_message_buffer,
+                         std::size_t frame_size, ReadHandler read_handler) noexcept;
+
+  /**
+   * @brief         Function to grow the message buffer of a large frame by the next chunk to be received
+   * @details       The chunk doubles the bytes received so far, so that memory follows the bytes actually
+   *                received instead of the announced length while the number of reallocations stays logarithmic
+   * @param[in,out] rx_message_buffer
+   *                The buffer containing the bytes of the frame received so far
+   * @param[in]     frame_size
+   *                The size of the complete frame
+   * @return        The buffer view of the chunk to be received
+   */
+  static boost::asio::mutable_buffer GrowFrameBuffer(TcpMessage::BufferType &rx_message_buffer,
+                                                     std::size_t frame_size) noexcept;
+
+  /**
+   * @brief         Function to create the tcp message from received frame
+   * @param[in]     rx_message_buffer
+   *                The buffer containing the complete frame or a fragment of it
+   * @param[in]     frame_offset
+   *                The offset of the fragment within the frame
+   * @return        The tcp message
+   */
+  TcpMessagePtr CreateMessage(TcpMessage::BufferType rx_message_buffer,
+                              std::size_t frame_offset = 0u) noexcept;
+
+  /**
+   * @brief         Function to take the next buffered bytes of the frame being delivered in fragments
+   * @details       Must be called on the strand with bytes of the fragmented frame buffered
+   * @return        The tcp message holding the fragment
+   */
+  TcpMessagePtr TakeFragment() noexcept;
+
+  /**
+   * @brief         Function to log the reason of failed reception
+   * @param[in]     ec
+   *                The error code of the read
+   */
+  static void LogReceptionError(TcpErrorCodeType const &ec) noexcept;
+
+  /**
+   * @brief         Function to reset the receive buffer and remember the connected remote endpoint
+   */
+  void ResetReception() noexcept;
+
+  /**
+   * @brief         Function to enable keep-alive probing and the timeout of unacknowledged data on the socket
+   */
+  void EnableLivenessProbe() noexcept;
+
+  /**
+   * @brief  Store the liveness timeout in milliseconds, zero if disabled
+   */
+  static std::atomic<std::int64_t> liveness_timeout_ms_;
+
   /**
    * @brief  Store the underlying tcp socket
    */
   Socket tcp_socket_;
 
+  /**
+   * @brief  Store the strand serializing the asynchronous reception handlers
+   */
+  boost::asio::strand<Socket::executor_type> strand_;
+
   /**
    * @brief  Store the local endpoints
    */
   Tcp::endpoint local_endpoint_;
+
+  /**
+   * @brief  Store the remote ip address, resolved once per connection
+   */
+  std::string remote_ip_address_;
+
+  /**
+   * @brief  Store the remote port number, resolved once per connection
+   */
+  std::uint16_t remote_port_num_;
+
+  /**
+   * @brief  Store the receive buffer reused for all frames of the connection
+   */
+  std::vector<std::uint8_t> rx_buffer_;
+
+  /**
+   * @brief  Store the position of first byte not yet decoded in receive buffer
+   */
+  std::size_t rx_buffer_begin_;
+
+  /**
+   * @brief  Store the position after last byte received in receive buffer
+   */
+  std::size_t rx_buffer_end_;
+
+  /**
+   * @brief  Store the maximum payload length of frames received
+   */
+  std::uint32_t max_payload_length_;
+
+  /**
+   * @brief  Store the number of bytes still to be skipped from the stream
+   */
+  std::size_t discard_length_;
+
+  /**
+   * @brief  Store whether frames larger than the receive buffer are delivered in fragments
+   */
+  bool fragmented_reception_;
+
+  /**
+   * @brief  Store the offset within the frame of the next fragment to be delivered
+   */
+  std::size_t fragment_offset_;
+
+  /**
+   * @brief  Store the number of bytes of the frame still to be delivered in fragments
+   */
+  std::size_t fragment_remaining_;
 };
 }  // namespace tcp
 }  // namespace socket
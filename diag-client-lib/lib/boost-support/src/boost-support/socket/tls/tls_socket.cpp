@@ -8,6 +8,9 @@
 
 #include "boost-support/socket/tls/tls_socket.h"
 
+#include <algorithm>
+#include <array>
+#include <memory>
 #include <utility>
 
 #include "boost-support/common/logger.h"
@@ -15,14 +18,32 @@
 namespace boost_support {
 namespace socket {
 namespace tls {
+namespace {
+
+/**
+ * @brief       Function to get the payload length from doip header
+ * @param[in]   header
+ *              The pointer to start of header
+ * @return      The payload length
+ */
+auto GetDoipPayloadLength(std::uint8_t const *header) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>((static_cast<std::uint32_t>(header[4u] << 24u) & 0xFF000000) |
+                                    (static_cast<std::uint32_t>(header[5u] << 16u) & 0x00FF0000) |
+                                    (static_cast<std::uint32_t>(header[6u] << 8u) & 0x0000FF00) |
+                                    (static_cast<std::uint32_t>(header[7u] & 0x000000FF)));
+}
+
+}  // namespace
 
 TlsSocket::TlsSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
-                     TlsContext &tls_context, IoContext &io_context) noexcept
-    : ssl_stream_{io_context.GetContext(), tls_context.GetContext()},
+                     TlsContext &tls_context, boost::asio::io_context &io_context) noexcept
+    : ssl_stream_{io_context, tls_context.GetContext()},
+      strand_{boost::asio::make_strand(ssl_stream_.get_executor())},
       local_endpoint_{boost::asio::ip::make_address(local_ip_address), local_port_num} {}
 
 TlsSocket::TlsSocket(TlsSocket::TcpSocket tcp_socket, TlsContext &tls_context) noexcept
     : ssl_stream_{std::move(tcp_socket), tls_context.GetContext()},
+      strand_{boost::asio::make_strand(ssl_stream_.get_executor())},
       local_endpoint_{} {
   TcpErrorCodeType ec{};
 
@@ -41,10 +62,12 @@ TlsSocket::TlsSocket(TlsSocket::TcpSocket tcp_socket, TlsContext &tls_context) n
 
 TlsSocket::TlsSocket(TlsSocket &&other) noexcept
     : ssl_stream_{std::move(other.ssl_stream_)},
+      strand_{std::move(other.strand_)},
       local_endpoint_{std::move(other.local_endpoint_)} {}
 
 TlsSocket &TlsSocket::operator=(TlsSocket &&other) noexcept {
-  ssl_stream_ = std::move(std::move(other.ssl_stream_));
+  { using S = decltype(ssl_stream_); ssl_stream_.~S(); new (&ssl_stream_) S(std::move(other.ssl_stream_)); }
+  strand_ = std::move(other.strand_);
   local_endpoint_ = std::move(other.local_endpoint_);
   return *this;
 }
@@ -175,6 +198,43 @@ core_type::Result<void, TlsSocket::SocketError> TlsSocket::Transmit(
   return result;
 }
 
+core_type::Result<void, TlsSocket::SocketError> TlsSocket::Transmit(
+    TcpMessageBufferViews buffer_views) noexcept {
+  core_type::Result<void, SocketError> result{SocketError::kGenericError};
+  TcpErrorCodeType ec{};
+
+  if (buffer_views.size() <= kMaxTransmitBufferCount) {
+    // unused entries stay empty and are skipped by the write
+    std::array<boost::asio::const_buffer, kMaxTransmitBufferCount> buffers{};
+    std::transform(buffer_views.begin(), buffer_views.end(), buffers.begin(),
+                   [](message::tcp::TcpMessageBufferView const buffer_view) {
+                     return boost::asio::buffer(buffer_view.data(), buffer_view.size());
+                   });
+    boost::asio::write(ssl_stream_, buffers, ec);
+    // Check for error
+    if (ec.value() == boost::system::errc::success) {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+          FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
+            Tcp::endpoint const endpoint_{GetNativeTcpSocket().remote_endpoint()};
+            msg << "Tcp message sent to "
+                << "<" << endpoint_.address().to_string() << "," << endpoint_.port() << ">";
+          });
+      result.EmplaceValue();
+    } else {
+      common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [ec](std::stringstream &msg) {
+            msg << "Tcp message sending failed with error: " << ec.message();
+          });
+    }
+  } else {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&buffer_views](std::stringstream &msg) {
+          msg << "Tcp message sending failed, too many buffers: " << buffer_views.size();
+        });
+  }
+  return result;
+}
+
 core_type::Result<void, TlsSocket::SocketError> TlsSocket::Close() noexcept {
   core_type::Result<void, SocketError> result{SocketError::kGenericError};
   // Shutdown of TCP connection
@@ -253,6 +313,78 @@ core_type::Result<TlsSocket::TcpMessagePtr, TlsSocket::SocketError> TlsSocket::R
   return result;
 }
 
+void TlsSocket::AsyncRead(ReadHandler read_handler) noexcept {
+  boost::asio::post(strand_, [this, read_handler{std::move(read_handler)}]() mutable {
+    ReadFrame(std::move(read_handler));
+  });
+}
+
+void TlsSocket::ReadFrame(ReadHandler read_handler) noexcept {
+  std::shared_ptr<TcpMessage::BufferType> rx_buffer{
+      std::make_shared<TcpMessage::BufferType>(message::tcp::kDoipheadrSize)};
+  // read Header first
+  boost::asio::async_read(
+      ssl_stream_, boost::asio::buffer(*rx_buffer),
+      boost::asio::bind_executor(strand_, [this, rx_buffer, read_handler{std::move(read_handler)}](
+                                              TcpErrorCodeType const &ec, std::size_t) mutable {
+        if (ec.value() != boost::system::errc::success) {
+          LogReceptionError(ec);
+          read_handler(ReadResult::FromError(SocketError::kRemoteDisconnected));
+          return;
+        }
+        std::uint32_t const read_next_bytes{GetDoipPayloadLength(rx_buffer->data())};
+        if (read_next_bytes == 0u) {
+          common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+              FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+                msg << "Tcp Message read ignored as header size is zero";
+              });
+          ReadFrame(std::move(read_handler));
+          return;
+        }
+        rx_buffer->resize(message::tcp::kDoipheadrSize + std::size_t{read_next_bytes});
+        boost::asio::async_read(
+            ssl_stream_,
+            boost::asio::buffer(&(*rx_buffer)[message::tcp::kDoipheadrSize], read_next_bytes),
+            boost::asio::bind_executor(
+                strand_, [this, rx_buffer, read_handler{std::move(read_handler)}](
+                             TcpErrorCodeType const &payload_ec, std::size_t) mutable {
+                  if (payload_ec.value() == boost::system::errc::success) {
+                    TcpErrorCodeType endpoint_ec{};
+                    Tcp::endpoint const remote_endpoint{
+                        GetNativeTcpSocket().remote_endpoint(endpoint_ec)};
+                    // all message received, transfer to upper layer
+                    TcpMessagePtr tcp_rx_message{std::make_unique<TcpMessage>(
+                        remote_endpoint.address().to_string(), remote_endpoint.port(),
+                        std::move(*rx_buffer))};
+                    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+                        FILE_NAME, __LINE__, __func__, [&remote_endpoint](std::stringstream &msg) {
+                          msg << "Tcp Message received from "
+                              << "<" << remote_endpoint.address().to_string() << ","
+                              << remote_endpoint.port() << ">";
+                        });
+                    read_handler(ReadResult::FromValue(std::move(tcp_rx_message)));
+                  } else {
+                    LogReceptionError(payload_ec);
+                    read_handler(ReadResult::FromError(SocketError::kRemoteDisconnected));
+                  }
+                }));
+      }));
+}
+
+void TlsSocket::LogReceptionError(TcpErrorCodeType const &ec) noexcept {
+  if ((ec.value() == boost::asio::error::eof) ||
+      (ec.value() == boost::asio::error::operation_aborted)) {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogDebug(
+        FILE_NAME, __LINE__, __func__,
+        [ec](std::stringstream &msg) { msg << "Remote Disconnected with: " << ec.message(); });
+  } else {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [ec](std::stringstream &msg) {
+          msg << "Remote Disconnected with undefined error: " << ec.message();
+        });
+  }
+}
+
 TlsSocket::SslStream::lowest_layer_type &TlsSocket::GetNativeTcpSocket() {
   return ssl_stream_.lowest_layer();
 }
@@ -9,9 +9,9 @@
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_TLS_TLS_SOCKET_H_
 
 #include <boost/asio.hpp>
+#include <functional>
 
 #include "boost-support/message/tcp/tcp_message.h"
-#include "boost-support/socket/io_context.h"
 #include "boost-support/socket/tls/tls_context.h"
 #include "core/include/result.h"
 
@@ -50,6 +50,16 @@ class TlsSocket final {
    */
   using TcpMessageConstPtr = boost_support::message::tcp::TcpMessageConstPtr;
 
+  /**
+   * @brief  Type alias for views on buffers of Tcp message
+   */
+  using TcpMessageBufferViews = boost_support::message::tcp::TcpMessageBufferViews;
+
+  /**
+   * @brief  Maximum number of buffers written with one vectored write
+   */
+  static constexpr std::size_t kMaxTransmitBufferCount{4u};
+
   /**
    * @brief  Type alias for tcp protocol
    */
@@ -60,6 +70,16 @@ class TlsSocket final {
    */
   using TcpSocket = Tcp::socket;
 
+  /**
+   * @brief  Type alias for result of an asynchronous read
+   */
+  using ReadResult = core_type::Result<TcpMessagePtr, SocketError>;
+
+  /**
+   * @brief  Type alias for handler invoked with the result of an asynchronous read
+   */
+  using ReadHandler = std::function<void(ReadResult)>;
+
  public:
   /**
    * @brief         Constructs an instance of TcpSocket
@@ -71,7 +91,7 @@ class TlsSocket final {
    *                The I/O context required to create socket
    */
   TlsSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
-            TlsContext &tls_context, IoContext &io_context) noexcept;
+            TlsContext &tls_context, boost::asio::io_context &io_context) noexcept;
 
   /**
    * @brief         Constructs an instance of TcpSocket
@@ -132,12 +152,30 @@ class TlsSocket final {
    */
   core_type::Result<void, SocketError> Transmit(TcpMessageConstPtr tcp_message) noexcept;
 
+  /**
+   * @brief         Function to trigger transmission of buffers with a single vectored write
+   * @details       The buffers are written back to back without being copied, they must stay valid until return
+   * @param[in]     buffer_views
+   *                The views on buffers to be transmitted, at most kMaxTransmitBufferCount
+   * @return        Empty result on success otherwise error code
+   */
+  core_type::Result<void, SocketError> Transmit(TcpMessageBufferViews buffer_views) noexcept;
+
   /**
    * @brief         Function to read message from socket
    * @return        Tcp message on success otherwise error code
    */
   core_type::Result<TcpMessagePtr, SocketError> Read() noexcept;
 
+  /**
+   * @brief         Function to read the next message from socket asynchronously
+   * @details       The handler is invoked exactly once on the strand of this socket, so at most one asynchronous read
+   *                must be outstanding at a time.
+   * @param[in]     read_handler
+   *                The handler invoked with the tcp message on success otherwise error code
+   */
+  void AsyncRead(ReadHandler read_handler) noexcept;
+
   /**
    * @brief         Function to destroy the socket
    * @return        Empty result on success otherwise error code
@@ -165,6 +203,11 @@ class TlsSocket final {
    */
   SslStream ssl_stream_;
 
+  /**
+   * @brief  Store the strand serializing the asynchronous reception handlers
+   */
+  boost::asio::strand<SslStream::executor_type> strand_;
+
   /**
    * @brief  Store the local endpoints
    */
@@ -175,6 +218,20 @@ class TlsSocket final {
    * @brief  Function to get the native tcp socket under tls socket
    */
   SslStream::lowest_layer_type &GetNativeTcpSocket();
+
+  /**
+   * @brief         Function to read header and payload of next frame, must be called on the strand
+   * @param[in]     read_handler
+   *                The handler invoked once the frame is complete or reception failed
+   */
+  void ReadFrame(ReadHandler read_handler) noexcept;
+
+  /**
+   * @brief         Function to log the reason of failed reception
+   * @param[in]     ec
+   *                The error code of the read
+   */
+  static void LogReceptionError(TcpErrorCodeType const &ec) noexcept;
 };
 }  // namespace tls
 }  // namespace socket
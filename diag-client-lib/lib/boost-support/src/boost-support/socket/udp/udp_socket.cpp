@@ -8,7 +8,13 @@
 
 #include "boost-support/socket/udp/udp_socket.h"
 
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
+
+#include <array>
 #include <boost/asio/ip/address.hpp>
+#include <cerrno>
 
 #include "boost-support/common/logger.h"
 #include "boost-support/error_domain/boost_support_error_domain.h"
@@ -16,13 +22,162 @@
 namespace boost_support {
 namespace socket {
 namespace udp {
+namespace {
+
+/**
+ * @brief  Maximum number of datagrams received at once
+ */
+constexpr std::size_t kMaxReceiveBatchLength{32u};
+
+/**
+ * @brief  Maximum number of batches received before waiting again, so that other handlers of the strand can run
+ */
+constexpr std::size_t kMaxReceiveBatchCount{8u};
+
+/**
+ * @brief  Maximum number of payload buffers kept for reuse
+ */
+constexpr std::size_t kMaxPooledBufferCount{2u * kMaxReceiveBatchLength};
+
+/**
+ * @brief  Size of reception slot, one byte more than maximum response size to detect larger datagrams
+ */
+constexpr std::size_t kReceiveSlotSize{message::udp::kMaxUdpResSize + 1u};
+
+}  // namespace
+
+/**
+ * @brief       Class holding the buffers to receive a batch of datagrams with a single system call
+ * @details     Not movable as the message headers refer to the own buffers
+ */
+class UdpSocket::ReceiveBatch final {
+ public:
+  /**
+   * @brief         Constructs an instance of ReceiveBatch
+   */
+  ReceiveBatch() noexcept : slots_{}, slot_lengths_{}, remote_endpoints_{} {
+#ifdef __linux__
+    for (std::size_t index{0u}; index < kMaxReceiveBatchLength; ++index) {
+      io_vectors_[index].iov_base = slots_[index].data();
+      io_vectors_[index].iov_len = slots_[index].size();
+      headers_[index].msg_hdr = msghdr{};
+      headers_[index].msg_hdr.msg_name = remote_endpoints_[index].data();
+      headers_[index].msg_hdr.msg_iov = &io_vectors_[index];
+      headers_[index].msg_hdr.msg_iovlen = 1u;
+    }
+#endif
+  }
+
+  ReceiveBatch(const ReceiveBatch &other) noexcept = delete;
+  ReceiveBatch &operator=(const ReceiveBatch &other) noexcept = delete;
+  ReceiveBatch(ReceiveBatch &&other) noexcept = delete;
+  ReceiveBatch &operator=(ReceiveBatch &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of ReceiveBatch
+   */
+  ~ReceiveBatch() noexcept = default;
+
+  /**
+   * @brief         Function to receive the datagrams queued on the socket without blocking
+   * @param[in]     socket
+   *                The socket to receive from
+   * @param[out]    ec
+   *                The error occurred, would_block if no datagram is queued
+   * @return        The number of datagrams received
+   */
+  std::size_t Receive(Socket &socket, UdpErrorCodeType &ec) noexcept {
+    std::size_t received_count{0u};
+#ifdef __linux__
+    for (std::size_t index{0u}; index < kMaxReceiveBatchLength; ++index) {
+      headers_[index].msg_hdr.msg_namelen = static_cast<socklen_t>(remote_endpoints_[index].capacity());
+      headers_[index].msg_hdr.msg_flags = 0;
+    }
+    int const result{::recvmmsg(socket.native_handle(), headers_.data(),
+                                static_cast<unsigned int>(kMaxReceiveBatchLength), MSG_DONTWAIT, nullptr)};
+    if (result < 0) {
+      ec.assign(errno, boost::asio::error::get_system_category());
+    } else {
+      received_count = static_cast<std::size_t>(result);
+      for (std::size_t index{0u}; index < received_count; ++index) {
+        remote_endpoints_[index].resize(headers_[index].msg_hdr.msg_namelen);
+        slot_lengths_[index] = headers_[index].msg_len;
+      }
+    }
+#else
+    while ((received_count < kMaxReceiveBatchLength) && (socket.available(ec) != 0u)) {
+      slot_lengths_[received_count] = socket.receive_from(boost::asio::buffer(slots_[received_count]),
+                                                          remote_endpoints_[received_count], {}, ec);
+      if (ec) { break; }
+      ++received_count;
+    }
+    if (!ec && (received_count == 0u)) { ec = boost::asio::error::would_block; }
+#endif
+    return received_count;
+  }
+
+  /**
+   * @brief         Function to get the data of a received datagram
+   * @param[in]     index
+   *                The index of datagram within the batch
+   * @return        The view on data
+   */
+  core_type::Span<std::uint8_t const> GetData(std::size_t index) const noexcept {
+    return core_type::Span<std::uint8_t const>{slots_[index].data(), slot_lengths_[index]};
+  }
+
+  /**
+   * @brief         Function to get the sender of a received datagram
+   * @param[in]     index
+   *                The index of datagram within the batch
+   * @return        The remote endpoint
+   */
+  Udp::endpoint const &GetRemoteEndpoint(std::size_t index) const noexcept { return remote_endpoints_[index]; }
+
+ private:
+  /**
+   * @brief  Store the data of received datagrams
+   */
+  std::array<std::array<std::uint8_t, kReceiveSlotSize>, kMaxReceiveBatchLength> slots_;
+
+  /**
+   * @brief  Store the number of bytes received per datagram
+   */
+  std::array<std::size_t, kMaxReceiveBatchLength> slot_lengths_;
+
+  /**
+   * @brief  Store the sender per datagram
+   */
+  std::array<Udp::endpoint, kMaxReceiveBatchLength> remote_endpoints_;
+
+#ifdef __linux__
+  /**
+   * @brief  Store the scatter vector per datagram
+   */
+  std::array<iovec, kMaxReceiveBatchLength> io_vectors_{};
+
+  /**
+   * @brief  Store the message header per datagram
+   */
+  std::array<mmsghdr, kMaxReceiveBatchLength> headers_{};
+#endif
+};
 
 UdpSocket::UdpSocket(std::string_view local_ip_address, std::uint16_t local_port_num,
                      boost::asio::io_context &io_context) noexcept
-    : udp_socket_{io_context},
-      local_endpoint_{boost::asio::ip::make_address(local_ip_address), local_port_num} {
-  rx_buffer_.resize(message::udp::kMaxUdpResSize);
-}
+    : udp_socket_{boost::asio::make_strand(io_context)},
+      local_endpoint_{boost::asio::ip::make_address(local_ip_address), local_port_num},
+      receive_batch_{std::make_unique<ReceiveBatch>()},
+      buffer_pool_{std::make_shared<message::udp::UdpMessageBufferPool>(kMaxPooledBufferCount)},
+      pending_receive_count_{0u} {}
+
+UdpSocket::UdpSocket(UdpSocket &&other) noexcept
+    : udp_socket_{std::move(other.udp_socket_)},
+      local_endpoint_{std::move(other.local_endpoint_)},
+      receive_batch_{std::move(other.receive_batch_)},
+      buffer_pool_{std::move(other.buffer_pool_)},
+      udp_handler_read_{std::move(other.udp_handler_read_)},
+      pending_receive_count_{0u} {}
 
 UdpSocket::~UdpSocket() noexcept = default;
 
@@ -85,8 +240,12 @@ core_type::Result<void, UdpSocket::SocketError> UdpSocket::Transmit(
               << ">";
         });
     result.EmplaceValue();
-    // start async receive
-    StartReceivingMessage();
+    // start async receive, a second outstanding reception would share the receive buffer
+    bool const is_receiving{[this]() {
+      std::lock_guard<std::mutex> lock{mutex_};
+      return pending_receive_count_ != 0u;
+    }()};
+    if (!is_receiving) { StartReceivingMessage(); }
   } else {
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
         FILE_NAME, __LINE__, __func__, [&ec, &udp_message](std::stringstream &msg) {
@@ -102,67 +261,100 @@ core_type::Result<void, UdpSocket::SocketError> UdpSocket::Close() noexcept {
   core_type::Result<void, SocketError> result{SocketError::kGenericError};
   // destroy the socket
   udp_socket_.close();
+  // handlers of cancelled receptions still refer to this socket
+  std::unique_lock<std::mutex> lck(mutex_);
+  cond_var_.wait(lck, [this]() { return pending_receive_count_ == 0u; });
   result.EmplaceValue();
   return result;
 }
 
-core_type::Result<UdpSocket::UdpMessagePtr> UdpSocket::Read(std::size_t total_bytes_received) {
+core_type::Result<UdpSocket::UdpMessagePtr> UdpSocket::Read(core_type::Span<std::uint8_t const> received_data,
+                                                            Udp::endpoint const &remote_endpoint) {
   core_type::Result<UdpMessagePtr> result{
       error_domain::MakeErrorCode(error_domain::BoostSupportErrorErrc::kGenericError)};
   // Ignore self reception
-  if (local_endpoint_.address().to_string() != remote_endpoint_.address().to_string()) {
-    UdpMessage::BufferType received_data{};
-    received_data.reserve(total_bytes_received);
-
-    // Received message must be less than max udp message
-    assert(total_bytes_received <= message::udp::kMaxUdpResSize);
-    // copy the received bytes into local buffer
-    received_data.insert(received_data.begin(), rx_buffer_.begin(),
-                         rx_buffer_.begin() + static_cast<std::uint8_t>(total_bytes_received));
+  if (local_endpoint_.address() == remote_endpoint.address()) {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogVerbose(
+        FILE_NAME, __LINE__, __func__, [this, &remote_endpoint](std::stringstream &msg) {
+          msg << "Udp Message received from "
+              << "<" << remote_endpoint.address() << "," << remote_endpoint.port() << ">"
+              << " ignored as received by self ip"
+              << " <" << local_endpoint_.address() << "," << local_endpoint_.port() << ">";
+        });
+  } else if (received_data.size() > message::udp::kMaxUdpResSize) {
+    // Received message must not exceed max udp message, a truncated copy would be misinterpreted
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [&remote_endpoint](std::stringstream &msg) {
+          msg << "Udp Message received from "
+              << "<" << remote_endpoint.address() << "," << remote_endpoint.port() << ">"
+              << " discarded as exceeding " << message::udp::kMaxUdpResSize << " bytes";
+        });
+  } else {
+    // copy the received bytes into a reused buffer
+    UdpMessage::BufferType payload{buffer_pool_->Acquire()};
+    payload.assign(received_data.data(), received_data.data() + received_data.size());
 
     UdpMessagePtr udp_rx_message{std::make_unique<UdpMessage>(
-        remote_endpoint_.address().to_string(), remote_endpoint_.port(), std::move(received_data))};
+        remote_endpoint.address().to_string(), remote_endpoint.port(), std::move(payload), buffer_pool_)};
 
     common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogInfo(
-        FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
+        FILE_NAME, __LINE__, __func__, [&remote_endpoint](std::stringstream &msg) {
           msg << "Udp Message received from: "
-              << "<" << remote_endpoint_.address() << "," << remote_endpoint_.port() << ">";
+              << "<" << remote_endpoint.address() << "," << remote_endpoint.port() << ">";
         });
     result.EmplaceValue(std::move(udp_rx_message));
-  } else {
-    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogVerbose(
-        FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
-          msg << "Udp Message received from "
-              << "<" << remote_endpoint_.address() << "," << remote_endpoint_.port() << ">"
-              << " ignored as received by self ip"
-              << " <" << local_endpoint_.address() << "," << local_endpoint_.port() << ">";
-        });
   }
-  // start async receive
-  StartReceivingMessage();
   return result;
 }
 
+bool UdpSocket::ReceiveMessages() {
+  UdpErrorCodeType ec{};
+  std::size_t const received_count{receive_batch_->Receive(udp_socket_, ec)};
+  for (std::size_t index{0u}; index < received_count; ++index) {
+    static_cast<void>(Read(receive_batch_->GetData(index), receive_batch_->GetRemoteEndpoint(index))
+                          .AndThen([this](UdpMessagePtr udp_message) {
+                            // send data to upper layer
+                            if (udp_handler_read_) { udp_handler_read_(std::move(udp_message)); }
+                            return core_type::Result<void>::FromValue();
+                          }));
+  }
+  if (ec && (ec != boost::asio::error::would_block) && (ec != boost::asio::error::try_again)) {
+    common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__,
+        [ec](std::stringstream &msg) { msg << "Udp reception failed with error: " << ec.message(); });
+  }
+  // a partial batch means no further datagram was queued
+  return ec || (received_count < kMaxReceiveBatchLength);
+}
+
 void UdpSocket::StartReceivingMessage() {
-  // start async receive
-  udp_socket_.async_receive_from(
-      boost::asio::buffer(rx_buffer_), remote_endpoint_,
-      [this](const UdpErrorCodeType &error, std::size_t bytes_received) {
-        if (error.value() == boost::system::errc::success) {
-          static_cast<void>(Read(bytes_received).AndThen([this](UdpMessagePtr udp_message) {
-            // send data to upper layer
-            if (udp_handler_read_) { udp_handler_read_(std::move(udp_message)); }
-            return core_type::Result<void>::FromValue();
-          }));
-        } else {
-          if (error.value() != boost::asio::error::operation_aborted) {
-            common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
-                FILE_NAME, __LINE__, __func__, [error](std::stringstream &msg) {
-                  msg << "Remote Disconnected with undefined error: " << error.message();
-                });
-          }
-        }
-      });
+  {
+    std::lock_guard<std::mutex> lock{mutex_};
+    pending_receive_count_++;
+  }
+  // wait until readable, handler is executed on the strand of socket
+  udp_socket_.async_wait(Socket::wait_read, [this](const UdpErrorCodeType &error) {
+    if (error.value() == boost::system::errc::success) {
+      bool is_drained{false};
+      for (std::size_t batch_count{0u}; (batch_count < kMaxReceiveBatchCount) && !is_drained; ++batch_count) {
+        is_drained = ReceiveMessages();
+      }
+      // wait again, completes at once if datagrams are still queued
+      StartReceivingMessage();
+    } else {
+      if (error.value() != boost::asio::error::operation_aborted) {
+        common::logger::LibBoostLogger::GetLibBoostLogger().GetLogger().LogError(
+            FILE_NAME, __LINE__, __func__, [error](std::stringstream &msg) {
+              msg << "Remote Disconnected with undefined error: " << error.message();
+            });
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock{mutex_};
+      pending_receive_count_--;
+    }
+    cond_var_.notify_all();
+  });
 }
 
 }  // namespace udp
@@ -9,7 +9,9 @@
 #define DIAG_CLIENT_LIB_LIB_BOOST_SUPPORT_SOCKET_UDP_UDP_SOCKET_H_
 
 #include <boost/asio.hpp>
-#include <vector>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 #include "boost-support/message/udp/udp_message.h"
 #include "core/include/result.h"
@@ -20,6 +22,8 @@ namespace udp {
 
 /**
  * @brief       Class used to create a udp socket for handling transmission and reception of udp message from driver
+ * @details     Once the socket is readable, all queued datagrams are received in batches before waiting again, so that
+ *              a burst of responses to a broadcast request is drained without one asynchronous reception per datagram
  */
 class UdpSocket final {
  public:
@@ -78,10 +82,14 @@ class UdpSocket final {
   UdpSocket &operator=(const UdpSocket &other) noexcept = delete;
 
   /**
-   * @brief  Move assignment and Move constructor
+   * @brief  Move constructor, only allowed before the socket is opened
    */
-  UdpSocket(UdpSocket &&other) noexcept = default;
-  UdpSocket &operator=(UdpSocket &&other) noexcept = default;
+  UdpSocket(UdpSocket &&other) noexcept;
+
+  /**
+   * @brief  Deleted move assignment
+   */
+  UdpSocket &operator=(UdpSocket &&other) noexcept = delete;
 
   /**
    * @brief         Destruct an instance of TcpSocket
@@ -112,6 +120,7 @@ class UdpSocket final {
 
   /**
    * @brief         Function to destroy the socket
+   * @details       Blocks until the pending receptions are completed
    * @return        Empty result on success otherwise error code
    */
   core_type::Result<void, SocketError> Close() noexcept;
@@ -133,31 +142,60 @@ class UdpSocket final {
   Udp::endpoint local_endpoint_;
 
   /**
-   * @brief  Store the remote endpoints
+   * @brief  Forward declaration of the buffers used to receive a batch of datagrams
    */
-  Udp::endpoint remote_endpoint_;
+  class ReceiveBatch;
 
   /**
-   * @brief  Reception buffer needed for async reception of udp data
+   * @brief  Store the buffers used to receive a batch of datagrams
    */
-  std::vector<std::uint8_t> rx_buffer_;
+  std::unique_ptr<ReceiveBatch> receive_batch_;
+
+  /**
+   * @brief  Store the pool of payload buffers of received messages
+   */
+  std::shared_ptr<message::udp::UdpMessageBufferPool> buffer_pool_;
 
   /**
    * @brief  Store the handler
    */
   UdpHandlerRead udp_handler_read_;
 
+  /**
+   * @brief  Store the number of outstanding asynchronous receptions
+   */
+  std::size_t pending_receive_count_;
+
+  /**
+   * @brief  Conditional variable to wait for completion of outstanding receptions
+   */
+  std::condition_variable cond_var_;
+
+  /**
+   * @brief  mutex to lock critical section
+   */
+  std::mutex mutex_;
+
  private:
   /**
-   * @brief         Function to handle the reception of tcp message
-   * @param[in]     bytes_received
-   *                The number of bytes to be read
+   * @brief         Function to handle the reception of one udp datagram
+   * @param[in]     received_data
+   *                The datagram received
+   * @param[in]     remote_endpoint
+   *                The sender of datagram
    * @return        Udp Message created from received data on success, otherwise error
    */
-  core_type::Result<UdpMessagePtr> Read(std::size_t bytes_received);
+  core_type::Result<UdpMessagePtr> Read(core_type::Span<std::uint8_t const> received_data,
+                                        Udp::endpoint const &remote_endpoint);
+
+  /**
+   * @brief         Function to receive all datagrams queued on the socket and forward them to the read handler
+   * @return        True if the socket is drained, False if further datagrams may be queued
+   */
+  bool ReceiveMessages();
 
   /**
-   * @brief  Function to start reception of Udp dataframe
+   * @brief  Function to start waiting for reception of Udp dataframe
    */
   void StartReceivingMessage();
 };
@@ -0,0 +1,143 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+
+#include "channel/tcp_channel/doip_alive_check_handler.h"
+
+#include <array>
+#include <atomic>
+
+#include "common/common_doip_types.h"
+#include "common/logger.h"
+
+namespace doip_client {
+namespace channel {
+namespace tcp_channel {
+namespace {
+
+/**
+ * @brief  Alive check response Type
+ */
+constexpr std::uint16_t kDoip_AliveCheck_ResType{0x0008};
+
+/**
+ * @brief  Alive check response length, considering SA
+ */
+constexpr std::uint32_t kDoip_AliveCheck_ResLen{2u};
+
+/**
+ * @brief  Type holding doip generic header followed by source address
+ */
+using AliveCheckResponse = std::array<std::uint8_t, kDoipheadrSize + kDoip_AliveCheck_ResLen>;
+
+/**
+ * @brief            Function to create the alive check response
+ * @param[in]        source_address
+ *                   The source address of tester
+ * @return           The alive check response to be transmitted
+ */
+auto CreateAliveCheckResponse(std::uint16_t source_address) noexcept -> AliveCheckResponse {
+  return AliveCheckResponse{
+      kDoip_ProtocolVersion,
+      static_cast<std::uint8_t>(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion))),
+      static_cast<std::uint8_t>((kDoip_AliveCheck_ResType & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(kDoip_AliveCheck_ResType & 0x00FF),
+      static_cast<std::uint8_t>((kDoip_AliveCheck_ResLen & 0xFF000000) >> 24),
+      static_cast<std::uint8_t>((kDoip_AliveCheck_ResLen & 0x00FF0000) >> 16),
+      static_cast<std::uint8_t>((kDoip_AliveCheck_ResLen & 0x0000FF00) >> 8),
+      static_cast<std::uint8_t>(kDoip_AliveCheck_ResLen & 0x000000FF),
+      static_cast<std::uint8_t>((source_address & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(source_address & 0x00FF)};
+}
+}  // namespace
+
+/**
+ * @brief       Class implements alive check handler
+ */
+class AliveCheckHandler::AliveCheckHandlerImpl final {
+ public:
+  /**
+   * @brief         Constructs an instance of AliveCheckHandlerImpl
+   * @param[in]     tcp_socket_handler
+   *                The reference to socket handler
+   */
+  explicit AliveCheckHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler)
+      : tcp_socket_handler_{tcp_socket_handler},
+        source_address_{0u} {}
+
+  /**
+   * @brief       Function to get the socket handler
+   * @return      The reference to socket handler
+   */
+  auto GetSocketHandler() noexcept -> sockets::TcpSocketHandler & { return tcp_socket_handler_; }
+
+  /**
+   * @brief       Function to set the source address of tester
+   * @param[in]   source_address
+   *              The source address
+   */
+  void SetSourceAddress(uds_transport::UdsMessage::Address source_address) noexcept {
+    source_address_.store(source_address, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief       Function to get the source address of tester
+   * @return      The source address
+   */
+  auto GetSourceAddress() const noexcept -> uds_transport::UdsMessage::Address {
+    return source_address_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /**
+   * @brief  The reference to socket handler
+   */
+  sockets::TcpSocketHandler &tcp_socket_handler_;
+
+  /**
+   * @brief  Store the source address registered with routing activation, set by requester and read by reader
+   */
+  std::atomic<uds_transport::UdsMessage::Address> source_address_;
+};
+
+AliveCheckHandler::AliveCheckHandler(sockets::TcpSocketHandler &tcp_socket_handler)
+    : handler_impl_{std::make_unique<AliveCheckHandlerImpl>(tcp_socket_handler)} {}
+
+AliveCheckHandler::~AliveCheckHandler() = default;
+
+void AliveCheckHandler::Start() {}
+
+void AliveCheckHandler::Stop() { handler_impl_->SetSourceAddress(0u); }
+
+void AliveCheckHandler::Reset() { Stop(); }
+
+void AliveCheckHandler::SetSourceAddress(
+    uds_transport::UdsMessage::Address source_address) noexcept {
+  handler_impl_->SetSourceAddress(source_address);
+}
+
+auto AliveCheckHandler::ProcessDoIPAliveCheckRequest(DoipMessage &) noexcept -> void {
+  // Response lives on stack and is written with single write
+  AliveCheckResponse const alive_check_response{
+      CreateAliveCheckResponse(handler_impl_->GetSourceAddress())};
+  std::array<boost_support::message::tcp::TcpMessageBufferView, 1u> const alive_check_buffers{
+      boost_support::message::tcp::TcpMessageBufferView{alive_check_response}};
+  if (handler_impl_->GetSocketHandler().Transmit(
+          boost_support::message::tcp::TcpMessageBufferViews{alive_check_buffers})) {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogDebug(
+        FILE_NAME, __LINE__, __func__,
+        [](std::stringstream &msg) { msg << "Alive check response sent"; });
+  } else {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__,
+        [](std::stringstream &msg) { msg << "Alive check response transmission failed"; });
+  }
+}
+
+}  // namespace tcp_channel
+}  // namespace channel
+}  // namespace doip_client
@@ -0,0 +1,97 @@
+/* Diagnostic Client library
+* Copyright (C) 2024  Avijit Dey
+*
+* This Source Code Form is subject to the terms of the Mozilla Public
+* License, v. 2.0. If a copy of the MPL was not distributed with this
+* file, You can obtain one at http://mozilla.org/MPL/2.0/.
+*/
+#ifndef DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_TCP_CHANNEL_DOIP_ALIVE_CHECK_HANDLER_H_
+#define DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_TCP_CHANNEL_DOIP_ALIVE_CHECK_HANDLER_H_
+
+#include <memory>
+
+#include "common/doip_message.h"
+#include "sockets/socket_handler.h"
+#include "uds_transport/uds_message.h"
+
+namespace doip_client {
+namespace channel {
+namespace tcp_channel {
+
+/**
+ * @brief       Class used as a handler to answer alive check requests of the DoIP entity
+ * @details     DoIP entities probe their sockets with alive check requests and close the ones not answering, the
+ *              response carries the source address registered with routing activation
+ */
+class AliveCheckHandler final {
+ public:
+  /**
+   * @brief  Type alias for Tcp message pointer
+   */
+  using TcpMessagePtr = sockets::TcpSocketHandler::MessagePtr;
+
+  /**
+   * @brief  Type alias for Tcp message
+   */
+  using TcpMessage = sockets::TcpSocketHandler::Message;
+
+ public:
+  /**
+   * @brief         Constructs an instance of AliveCheckHandler
+   * @param[in]     tcp_socket_handler
+   *                The reference to socket handler
+   */
+  explicit AliveCheckHandler(sockets::TcpSocketHandler &tcp_socket_handler);
+
+  /**
+   * @brief         Destruct an instance of AliveCheckHandler
+   */
+  ~AliveCheckHandler();
+
+  /**
+   * @brief        Function to start the handler
+   */
+  void Start();
+
+  /**
+   * @brief        Function to stop the handler
+   * @details      This will reset all the internal handler back to default state
+   */
+  void Stop();
+
+  /**
+   * @brief        Function to reset the handler
+   * @details      This will reset all the internal handler back to default state
+   */
+  void Reset();
+
+  /**
+   * @brief       Function to register the source address of the tester on this socket
+   * @param[in]   source_address
+   *              The source address used for routing activation
+   */
+  void SetSourceAddress(uds_transport::UdsMessage::Address source_address) noexcept;
+
+  /**
+   * @brief       Function to process received alive check request by sending the alive check response
+   * @param[in]   doip_payload
+   *              The doip message received
+   */
+  void ProcessDoIPAliveCheckRequest(DoipMessage &doip_payload) noexcept;
+
+ private:
+  /**
+   * @brief  Forward declaration Handler implementation
+   */
+  class AliveCheckHandlerImpl;
+
+  /**
+   * @brief  Stores the Handler implementation
+   */
+  std::unique_ptr<AliveCheckHandlerImpl> handler_impl_;
+};
+
+}  // namespace tcp_channel
+}  // namespace channel
+}  // namespace doip_client
+#endif  //DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_TCP_CHANNEL_DOIP_ALIVE_CHECK_HANDLER_H_
@@ -9,13 +9,18 @@
 #include "channel/tcp_channel/doip_diagnostic_message_handler.h"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
-#include "utility/state.h"
-#include "utility/sync_timer.h"
+#include "utility/timer_service.h"
 
 namespace doip_client {
 namespace channel {
@@ -67,155 +72,44 @@ constexpr std::uint32_t kDoIPDiagnosticAckTimeout{2000u};  // 2 sec
  */
 enum class DiagnosticMessageState : std::uint8_t {
   kIdle = 0U,
-  kSendDiagnosticReqFailed,
   kWaitForDiagnosticAck,
-  kDiagnosticPositiveAckRecvd,
   kDiagnosticNegativeAckRecvd,
-  kWaitForDiagnosticResponse,
-  kDiagnosticFinalResRecvd
+  kWaitForDiagnosticResponse
 };
 
 /**
- * @brief       Class implements idle state
+ * @brief  Type alias of in-flight request key consisting of logical source and target address
  */
-class kIdle final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kIdle
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kIdle(DiagnosticMessageState state) : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
+using InFlightRequestKey = std::pair<std::uint16_t, std::uint16_t>;
 
 /**
- * @brief       Class implements sending of diagnostic request failed
+ * @brief  Type holding the state of one in-flight diagnostic request
  */
-class kSendDiagnosticReqFailed final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kSendDiagnosticReqFailed
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kSendDiagnosticReqFailed(DiagnosticMessageState state)
-      : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
-
-/**
- * @brief       Class implements wait for diagnostic acknowledgement response
- */
-class kWaitForDiagnosticAck final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kWaitForDiagnosticAck
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kWaitForDiagnosticAck(DiagnosticMessageState state)
-      : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
-
-/**
- * @brief       Class implements reception of diagnostic positive acknowledgement response
- */
-class kDiagnosticPositiveAckRecvd final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kDiagnosticPositiveAckRecvd
-   * @param[in]     state
-   *                The kDiagnosticPositiveAckRecvd state
-   */
-  explicit kDiagnosticPositiveAckRecvd(DiagnosticMessageState state)
-      : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
+struct InFlightRequest {
+  DiagnosticMessageState state_;
+  bool ack_timeout_{false};
+  // set for requests not waited for by the requester, invoked once acknowledged, timed out or aborted
+  uds_transport::Connection::TransmissionCompletionHandler completion_handler_{};
+  utility::timer::TimerService::TimerId ack_timer_id_{utility::timer::TimerService::kInvalidTimerId};
 };
 
 /**
- * @brief       Class implements reception of diagnostic negative acknowledgement response
+ * @brief  Different handling of a diagnostic response received in fragments
  */
-class kDiagnosticNegativeAckRecvd final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kDiagnosticNegativeAckRecvd
-   * @param[in]     state
-   *                The kDiagnosticNegativeAckRecvd state
-   */
-  explicit kDiagnosticNegativeAckRecvd(DiagnosticMessageState state)
-      : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
+enum class FragmentedResponseHandling : std::uint8_t {
+  kDiscard = 0U,
+  kReassemble,
+  kStream
 };
 
 /**
- * @brief       Class implements wait for diagnostic message positive/negative response
+ * @brief  Type holding the diagnostic response being received in fragments
  */
-class kWaitForDiagnosticResponse final : public utility::state::State<DiagnosticMessageState> {
- public:
-  /**
-   * @brief         Constructs an instance of kWaitForDiagnosticResponse
-   * @param[in]     state
-   *                The kWaitForDiagnosticResponse state
-   */
-  explicit kWaitForDiagnosticResponse(DiagnosticMessageState state)
-      : State<DiagnosticMessageState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
+struct FragmentedResponse {
+  FragmentedResponseHandling handling_{FragmentedResponseHandling::kDiscard};
+  uds_transport::UdsMessage::Address source_address_{};
+  uds_transport::UdsMessage::Address target_address_{};
+  uds_transport::UdsMessagePtr message_{};
 };
 
 /**
@@ -259,42 +153,51 @@ std::ostream &operator<<(std::ostream &msg, DiagAckType diag_ack_type) {
 }
 
 /**
- * @brief            Function to create doip generic header
- * @param[in]        payload_type
- *                   The type of payload
- * @param[in]        payload_len
- *                   The length of payload
+ * @brief            Type holding doip generic header followed by source and target address
+ */
+using DiagnosticMessageHeader = std::array<std::uint8_t, kDoipheadrSize + kDoipDiagMessageReqResMinLen>;
+
+/**
+ * @brief            Function to create doip generic header of diagnostic message along with addresses
+ * @param[in]        source_address
+ *                   The source address of message
+ * @param[in]        target_address
+ *                   The target address of message
+ * @param[in]        user_data_len
+ *                   The length of uds payload following the header
+ * @return           The header to be transmitted ahead of uds payload
  */
-auto CreateDoipGenericHeader(std::uint16_t payload_type, std::uint32_t payload_len) noexcept
-    -> std::vector<std::uint8_t> {
-  std::vector<std::uint8_t> output_buffer{};
-  output_buffer.emplace_back(kDoip_ProtocolVersion);
-  output_buffer.emplace_back(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion)));
-  output_buffer.emplace_back(static_cast<std::uint8_t>((payload_type & 0xFF00) >> 8));
-  output_buffer.emplace_back(static_cast<std::uint8_t>(payload_type & 0x00FF));
-  output_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0xFF000000) >> 24));
-  output_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x00FF0000) >> 16));
-  output_buffer.emplace_back(static_cast<std::uint8_t>((payload_len & 0x0000FF00) >> 8));
-  output_buffer.emplace_back(static_cast<std::uint8_t>(payload_len & 0x000000FF));
-  return output_buffer;
+auto CreateDiagnosticMessageHeader(std::uint16_t source_address, std::uint16_t target_address,
+                                   std::uint32_t user_data_len) noexcept -> DiagnosticMessageHeader {
+  std::uint32_t const payload_len{kDoipDiagMessageReqResMinLen + user_data_len};
+  return DiagnosticMessageHeader{
+      kDoip_ProtocolVersion,
+      static_cast<std::uint8_t>(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion))),
+      static_cast<std::uint8_t>((kDoipDiagMessage & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(kDoipDiagMessage & 0x00FF),
+      static_cast<std::uint8_t>((payload_len & 0xFF000000) >> 24),
+      static_cast<std::uint8_t>((payload_len & 0x00FF0000) >> 16),
+      static_cast<std::uint8_t>((payload_len & 0x0000FF00) >> 8),
+      static_cast<std::uint8_t>(payload_len & 0x000000FF),
+      static_cast<std::uint8_t>((source_address & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(source_address & 0x00FF),
+      static_cast<std::uint8_t>((target_address & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(target_address & 0x00FF)};
 }
 
 }  // namespace
 
 /**
- * @brief       Class implements routing activation handler
+ * @brief       Class implements diagnostic message handler
+ * @details     Requests are tracked in an in-flight table keyed by (SA, TA), so that requests towards different
+ *              target addresses can be outstanding concurrently on the same channel
  */
 class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
  public:
   /**
-   * @brief  Type alias for state context
+   * @brief  Type alias for shared in-flight request, shared between the requester and the reader context
    */
-  using DiagnosticMessageStateContext = utility::state::StateContext<DiagnosticMessageState>;
-
-  /**
-   * @brief  Type alias for Sync timer
-   */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using InFlightRequestPtr = std::shared_ptr<InFlightRequest>;
 
   /**
    * @brief         Constructs an instance of DiagnosticMessageHandlerImpl
@@ -307,35 +210,10 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
                                DoipTcpChannel &channel)
       : tcp_socket_handler_{tcp_socket_handler},
         channel_{channel},
-        state_context_{},
-        sync_timer_{} {
-    // create and add state for Diagnostic State
-    // kIdle
-    state_context_.AddState(DiagnosticMessageState::kIdle,
-                            std::make_unique<kIdle>(DiagnosticMessageState::kIdle));
-    // kSendDiagnosticReqFailed
-    state_context_.AddState(DiagnosticMessageState::kSendDiagnosticReqFailed,
-                            std::make_unique<kSendDiagnosticReqFailed>(
-                                DiagnosticMessageState::kSendDiagnosticReqFailed));
-    // kWaitForDiagnosticAck
-    state_context_.AddState(
-        DiagnosticMessageState::kWaitForDiagnosticAck,
-        std::make_unique<kWaitForDiagnosticAck>(DiagnosticMessageState::kWaitForDiagnosticAck));
-    // kDiagnosticPositiveAckRecvd
-    state_context_.AddState(DiagnosticMessageState::kDiagnosticPositiveAckRecvd,
-                            std::make_unique<kDiagnosticPositiveAckRecvd>(
-                                DiagnosticMessageState::kDiagnosticPositiveAckRecvd));
-    // kDiagnosticNegativeAckRecvd
-    state_context_.AddState(DiagnosticMessageState::kDiagnosticNegativeAckRecvd,
-                            std::make_unique<kDiagnosticNegativeAckRecvd>(
-                                DiagnosticMessageState::kDiagnosticNegativeAckRecvd));
-    // kWaitForDiagnosticResponse
-    state_context_.AddState(DiagnosticMessageState::kWaitForDiagnosticResponse,
-                            std::make_unique<kWaitForDiagnosticResponse>(
-                                DiagnosticMessageState::kWaitForDiagnosticResponse));
-    // Transit to idle state
-    state_context_.TransitionTo(DiagnosticMessageState::kIdle);
-  }
+        in_flight_requests_{},
+        in_flight_lock_{},
+        in_flight_cond_var_{},
+        fragmented_response_{} {}
 
   /**
    * @brief        Function to start the handler
@@ -344,11 +222,26 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
 
   /**
    * @brief        Function to stop the handler
-   * @details      This will reset all the internal handler back to default state
+   * @details      This will abort all the in-flight requests, wake up the waiting requesters and complete the
+   *               requests not waited for
    */
   void Stop() {
-    if (sync_timer_.IsTimerActive()) { sync_timer_.CancelWait(); }
-    state_context_.TransitionTo(DiagnosticMessageState::kIdle);
+    std::vector<InFlightRequestPtr> aborted_requests{};
+    {
+      std::lock_guard<std::mutex> const lck{in_flight_lock_};
+      for (auto &in_flight_request: in_flight_requests_) {
+        in_flight_request.second->state_ = DiagnosticMessageState::kIdle;
+        if (in_flight_request.second->completion_handler_) {
+          aborted_requests.emplace_back(in_flight_request.second);
+        }
+      }
+      in_flight_requests_.clear();
+    }
+    in_flight_cond_var_.notify_all();
+    for (InFlightRequestPtr const &aborted_request: aborted_requests) {
+      CompleteInFlightRequest(
+          aborted_request, uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed);
+    }
   }
 
   /**
@@ -358,10 +251,211 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
   void Reset() { Stop(); }
 
   /**
-   * @brief       Function to get the Diagnostic Message State context
-   * @return      The reference to state context
+   * @brief       Function to add a new in-flight request waiting for acknowledgement
+   * @details     A request still waiting for response with the same key is superseded, as the requester
+   *              already stopped waiting for it
+   * @param[in]   key
+   *              The key of the request
+   * @return      The in-flight request on success, nullptr when a request with same key awaits acknowledgement
+   */
+  auto AddInFlightRequest(InFlightRequestKey key) noexcept -> InFlightRequestPtr {
+    InFlightRequestPtr in_flight_request{};
+    std::lock_guard<std::mutex> const lck{in_flight_lock_};
+    auto const it{in_flight_requests_.find(key)};
+    if ((it == in_flight_requests_.end()) ||
+        (it->second->state_ != DiagnosticMessageState::kWaitForDiagnosticAck)) {
+      in_flight_request = std::make_shared<InFlightRequest>(
+          InFlightRequest{DiagnosticMessageState::kWaitForDiagnosticAck});
+      in_flight_requests_[key] = in_flight_request;
+    }
+    return in_flight_request;
+  }
+
+  /**
+   * @brief       Function to remove the in-flight request, if still owned by the table
+   * @param[in]   key
+   *              The key of the request
+   * @param[in]   in_flight_request
+   *              The in-flight request to be removed
+   */
+  void RemoveInFlightRequest(InFlightRequestKey key,
+                             InFlightRequestPtr const &in_flight_request) noexcept {
+    std::lock_guard<std::mutex> const lck{in_flight_lock_};
+    EraseInFlightRequest(key, in_flight_request);
+  }
+
+  /**
+   * @brief       Function to remove the in-flight request with the key
+   * @param[in]   key
+   *              The key of the request
    */
-  auto GetStateContext() noexcept -> DiagnosticMessageStateContext & { return state_context_; }
+  void RemoveInFlightRequest(InFlightRequestKey key) noexcept {
+    std::lock_guard<std::mutex> const lck{in_flight_lock_};
+    static_cast<void>(in_flight_requests_.erase(key));
+  }
+
+  /**
+   * @brief       Function to get the state of in-flight request
+   * @param[in]   key
+   *              The key of the request
+   * @return      The state of the request, kIdle if no request is in-flight
+   */
+  auto GetInFlightRequestState(InFlightRequestKey key) noexcept -> DiagnosticMessageState {
+    std::lock_guard<std::mutex> const lck{in_flight_lock_};
+    auto const it{in_flight_requests_.find(key)};
+    return (it != in_flight_requests_.end()) ? it->second->state_ : DiagnosticMessageState::kIdle;
+  }
+
+  /**
+   * @brief       Function to update the state of in-flight request and notify the requester
+   * @param[in]   key
+   *              The key of the request
+   * @param[in]   expected_state
+   *              The state in which the request is expected to be
+   * @param[in]   new_state
+   *              The new state of the request
+   * @return      The request if it was in expected state and updated, otherwise nullptr
+   */
+  auto UpdateInFlightRequest(InFlightRequestKey key, DiagnosticMessageState expected_state,
+                             DiagnosticMessageState new_state) noexcept -> InFlightRequestPtr {
+    InFlightRequestPtr in_flight_request{};
+    {
+      std::lock_guard<std::mutex> const lck{in_flight_lock_};
+      auto const it{in_flight_requests_.find(key)};
+      if ((it != in_flight_requests_.end()) && (it->second->state_ == expected_state)) {
+        it->second->state_ = new_state;
+        in_flight_request = it->second;
+      }
+    }
+    if (in_flight_request) { in_flight_cond_var_.notify_all(); }
+    return in_flight_request;
+  }
+
+  /**
+   * @brief       Function to wait for the acknowledgement of in-flight request
+   * @param[in]   in_flight_request
+   *              The in-flight request
+   * @param[in]   timeout
+   *              The maximum time to wait for acknowledgement
+   * @return      The state of the request after acknowledgement, kWaitForDiagnosticAck on timeout
+   */
+  auto WaitForAcknowledgement(InFlightRequestPtr const &in_flight_request,
+                              std::chrono::milliseconds timeout) noexcept
+      -> DiagnosticMessageState {
+    utility::timer::TimerService::TimerId const timer_id{
+        utility::timer::TimerService::GetTimerService().Arm(timeout, [this, in_flight_request]() {
+          {
+            std::lock_guard<std::mutex> const lck{in_flight_lock_};
+            in_flight_request->ack_timeout_ = true;
+          }
+          in_flight_cond_var_.notify_all();
+        })};
+    DiagnosticMessageState state{};
+    {
+      std::unique_lock<std::mutex> lck{in_flight_lock_};
+      in_flight_cond_var_.wait(lck, [&in_flight_request]() {
+        return in_flight_request->ack_timeout_ ||
+               (in_flight_request->state_ != DiagnosticMessageState::kWaitForDiagnosticAck);
+      });
+      state = in_flight_request->state_;
+    }
+    // the timer callback takes the in-flight lock, cancel without holding it
+    static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(timer_id));
+    return state;
+  }
+
+  /**
+   * @brief       Function to monitor the acknowledgement of in-flight request not waited for
+   * @details     On expiry the request is removed and completed with kNoTransmitAckReceived from the timer context
+   * @param[in]   key
+   *              The key of the request
+   * @param[in]   in_flight_request
+   *              The in-flight request
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   * @param[in]   timeout
+   *              The maximum time to wait for acknowledgement
+   * @return      True if monitored, false if the request was aborted by stopping the handler meanwhile
+   */
+  auto MonitorAcknowledgement(InFlightRequestKey key, InFlightRequestPtr const &in_flight_request,
+                              uds_transport::Connection::TransmissionCompletionHandler completion_handler,
+                              std::chrono::milliseconds timeout) noexcept -> bool {
+    utility::timer::TimerService::TimerId const timer_id{
+        utility::timer::TimerService::GetTimerService().Arm(
+            timeout, [this, key, in_flight_request]() {
+              uds_transport::Connection::TransmissionCompletionHandler expired_handler{};
+              {
+                std::lock_guard<std::mutex> const lck{in_flight_lock_};
+                if (in_flight_request->state_ == DiagnosticMessageState::kWaitForDiagnosticAck) {
+                  in_flight_request->ack_timeout_ = true;
+                  expired_handler = std::move(in_flight_request->completion_handler_);
+                  in_flight_request->completion_handler_ = nullptr;
+                  EraseInFlightRequest(key, in_flight_request);
+                }
+              }
+              if (expired_handler) {
+                logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+                    FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+                      msg << "Diagnostic Message Ack Request timed out, no "
+                             "response received in: "
+                          << kDoIPDiagnosticAckTimeout << " milliseconds";
+                    });
+                expired_handler(
+                    uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNoTransmitAckReceived);
+              }
+            })};
+    std::lock_guard<std::mutex> const lck{in_flight_lock_};
+    in_flight_request->completion_handler_ = std::move(completion_handler);
+    in_flight_request->ack_timer_id_ = timer_id;
+    return in_flight_request->state_ != DiagnosticMessageState::kIdle;
+  }
+
+  /**
+   * @brief       Function to complete the in-flight request not waited for with the transmission result
+   * @details     Nothing happens for requests waited for by the requester or completed already. A request failed
+   *              is removed, an acknowledged one stays until its response is received
+   * @param[in]   key
+   *              The key of the request
+   * @param[in]   in_flight_request
+   *              The in-flight request
+   * @param[in]   result
+   *              The transmission result
+   */
+  void CompleteInFlightRequest(InFlightRequestKey key, InFlightRequestPtr const &in_flight_request,
+                               uds_transport::UdsTransportProtocolMgr::TransmissionResult result) noexcept {
+    {
+      std::lock_guard<std::mutex> const lck{in_flight_lock_};
+      if (in_flight_request->completion_handler_ &&
+          (result != uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk)) {
+        EraseInFlightRequest(key, in_flight_request);
+      }
+    }
+    CompleteInFlightRequest(in_flight_request, result);
+  }
+
+  /**
+   * @brief       Function to complete the in-flight request not waited for, already removed
+   * @param[in]   in_flight_request
+   *              The in-flight request
+   * @param[in]   result
+   *              The transmission result
+   */
+  void CompleteInFlightRequest(InFlightRequestPtr const &in_flight_request,
+                               uds_transport::UdsTransportProtocolMgr::TransmissionResult result) noexcept {
+    uds_transport::Connection::TransmissionCompletionHandler completion_handler{};
+    utility::timer::TimerService::TimerId timer_id{utility::timer::TimerService::kInvalidTimerId};
+    {
+      std::lock_guard<std::mutex> const lck{in_flight_lock_};
+      completion_handler = std::move(in_flight_request->completion_handler_);
+      in_flight_request->completion_handler_ = nullptr;
+      timer_id = in_flight_request->ack_timer_id_;
+    }
+    if (completion_handler) {
+      // the timer callback takes the in-flight lock, cancel without holding it
+      static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(timer_id));
+      completion_handler(result);
+    }
+  }
 
   /**
    * @brief       Function to get the socket handler
@@ -376,12 +470,28 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
   auto GetDoipChannel() noexcept -> DoipTcpChannel & { return channel_; }
 
   /**
-   * @brief       Function to get the sync timer
-   * @return      The reference to sync timer
+   * @brief       Function to get the response being received in fragments
+   * @details     Only accessed from the reader context, the first fragment of every large response replaces it
+   * @return      The reference to fragmented response
    */
-  auto GetSyncTimer() noexcept -> SyncTimer & { return sync_timer_; }
+  auto GetFragmentedResponse() noexcept -> FragmentedResponse & { return fragmented_response_; }
 
  private:
+  /**
+   * @brief       Function to remove the in-flight request, if still owned by the table, with in-flight lock held
+   * @param[in]   key
+   *              The key of the request
+   * @param[in]   in_flight_request
+   *              The in-flight request to be removed
+   */
+  void EraseInFlightRequest(InFlightRequestKey key,
+                            InFlightRequestPtr const &in_flight_request) noexcept {
+    auto const it{in_flight_requests_.find(key)};
+    if ((it != in_flight_requests_.end()) && (it->second == in_flight_request)) {
+      in_flight_requests_.erase(it);
+    }
+  }
+
   /**
    * @brief  The reference to socket handler
    */
@@ -393,14 +503,24 @@ class DiagnosticMessageHandler::DiagnosticMessageHandlerImpl {
   DoipTcpChannel &channel_;
 
   /**
-   * @brief  Stores the diagnostic message states
+   * @brief  Stores the in-flight requests keyed by source and target address
+   */
+  std::map<InFlightRequestKey, InFlightRequestPtr> in_flight_requests_;
+
+  /**
+   * @brief  Store the mutex protecting the in-flight requests
    */
-  DiagnosticMessageStateContext state_context_;
+  std::mutex in_flight_lock_;
 
   /**
-   * @brief  Store the synchronous timer
+   * @brief  Store the conditional variable notified on acknowledgement reception
    */
-  SyncTimer sync_timer_;
+  std::condition_variable in_flight_cond_var_;
+
+  /**
+   * @brief  Store the response being received in fragments
+   */
+  FragmentedResponse fragmented_response_;
 };
 
 DiagnosticMessageHandler::DiagnosticMessageHandler(sockets::TcpSocketHandler &tcp_socket_handler,
@@ -417,23 +537,28 @@ void DiagnosticMessageHandler::Reset() { handler_impl_->Reset(); }
 
 auto DiagnosticMessageHandler::ProcessDoIPDiagnosticAckMessageResponse(
     DoipMessage &doip_payload) noexcept -> void {
+  // Acknowledgement from server carries its address as SA and ours as TA
+  InFlightRequestKey const key{doip_payload.GetServerAddress(), doip_payload.GetClientAddress()};
   DiagnosticMessageState final_state{DiagnosticMessageState::kDiagnosticNegativeAckRecvd};
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      DiagnosticMessageState::kWaitForDiagnosticAck) {
-    // get the ack code
-    DiagAckType const diag_ack_type{doip_payload.GetPayload()[0u]};
-    if (doip_payload.GetPayloadType() == kDoipDiagMessagePosAck) {
-      if (diag_ack_type.ack_type_ == kDoipDiagnosticMessagePosAckCodeConfirm) {
-        final_state = DiagnosticMessageState::kDiagnosticPositiveAckRecvd;
-        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-            FILE_NAME, __LINE__, __func__, [&doip_payload](std::stringstream &msg) {
-              msg << "Diagnostic message positively acknowledged from remote "
-                     "server "
-                  << " (0x" << std::hex << doip_payload.GetServerAddress() << ")";
-            });
-      } else {
-        // do nothing
-      }
+  // get the ack code
+  DiagAckType const diag_ack_type{doip_payload.GetPayload()[0u]};
+  if (doip_payload.GetPayloadType() == kDoipDiagMessagePosAck) {
+    if (diag_ack_type.ack_type_ == kDoipDiagnosticMessagePosAckCodeConfirm) {
+      // response may follow immediately, so wait for it straight away
+      final_state = DiagnosticMessageState::kWaitForDiagnosticResponse;
+    }
+  }
+  DiagnosticMessageHandlerImpl::InFlightRequestPtr const in_flight_request{
+      handler_impl_->UpdateInFlightRequest(key, DiagnosticMessageState::kWaitForDiagnosticAck,
+                                           final_state)};
+  if (in_flight_request) {
+    if (final_state == DiagnosticMessageState::kWaitForDiagnosticResponse) {
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+          FILE_NAME, __LINE__, __func__, [&doip_payload](std::stringstream &msg) {
+            msg << "Diagnostic message positively acknowledged from remote "
+                   "server "
+                << " (0x" << std::hex << doip_payload.GetClientAddress() << ")";
+          });
     } else if (doip_payload.GetPayloadType() == kDoipDiagMessageNegAck) {
       logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
           FILE_NAME, __LINE__, __func__, [&diag_ack_type](std::stringstream &msg) {
@@ -442,8 +567,12 @@ auto DiagnosticMessageHandler::ProcessDoIPDiagnosticAckMessageResponse(
     } else {
       // do nothing
     }
-    handler_impl_->GetStateContext().TransitionTo(final_state);
-    handler_impl_->GetSyncTimer().CancelWait();
+    // requests not waited for by the requester are completed from the reader context
+    handler_impl_->CompleteInFlightRequest(
+        key, in_flight_request,
+        (final_state == DiagnosticMessageState::kWaitForDiagnosticResponse)
+            ? uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk
+            : uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNegTransmitAckReceived);
   } else {
     /* ignore */
   }
@@ -451,100 +580,148 @@ auto DiagnosticMessageHandler::ProcessDoIPDiagnosticAckMessageResponse(
 
 auto DiagnosticMessageHandler::ProcessDoIPDiagnosticMessageResponse(
     DoipMessage &doip_payload) noexcept -> void {
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      DiagnosticMessageState::kWaitForDiagnosticResponse) {
+  // Response from server carries its address as SA and ours as TA
+  InFlightRequestKey const key{doip_payload.GetServerAddress(), doip_payload.GetClientAddress()};
+  // size announced in header, large responses start with the first fragment only
+  std::size_t const response_size{doip_payload.GetPayloadLength() - kDoipDiagMessageReqResMinLen};
+  bool const is_fragmented{doip_payload.GetPayload().size() < response_size};
+  FragmentedResponse &fragmented_response{handler_impl_->GetFragmentedResponse()};
+  fragmented_response = FragmentedResponse{FragmentedResponseHandling::kDiscard,
+                                           doip_payload.GetServerAddress(),
+                                           doip_payload.GetClientAddress(), nullptr};
+  DiagnosticMessageState const request_state{handler_impl_->GetInFlightRequestState(key)};
+  if (request_state == DiagnosticMessageState::kWaitForDiagnosticResponse) {
     // Indicate upper layer about incoming data
     std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult,
               uds_transport::UdsMessagePtr>
         ret_val{handler_impl_->GetDoipChannel().IndicateMessage(
             doip_payload.GetServerAddress(), doip_payload.GetClientAddress(),
-            uds_transport::UdsMessage::TargetAddressType::kPhysical, 0U,
-            doip_payload.GetPayload().size(), 0u, "DoIPTcp", doip_payload.GetPayload())};
+            uds_transport::UdsMessage::TargetAddressType::kPhysical, 0U, response_size, 0u,
+            "DoIPTcp", doip_payload.GetPayload())};
     if (ret_val.first ==
         uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationPending) {
-      // keep channel alive since pending request received, do not change channel state
+      // keep request in-flight since pending response received, do not change request state
     } else {
+      // final response received, complete the request before handing over to upper layer, which may
+      // immediately issue the next request with same key
+      handler_impl_->RemoveInFlightRequest(key);
       // Check result and udsMessagePtr
       if ((ret_val.first ==
            uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk) &&
           (ret_val.second != nullptr)) {
-        // copy to application buffer
-        (void) std::copy(doip_payload.GetPayload().begin(), doip_payload.GetPayload().end(),
-                         ret_val.second->GetPayload().begin());
-        handler_impl_->GetDoipChannel().HandleMessage(std::move(ret_val.second));
+        // hand over the received buffer to application
+        ret_val.second->GetPayload() = doip_payload.ReleasePayload();
+        if (is_fragmented) {
+          // remaining fragments are appended before handing over
+          fragmented_response.handling_ = FragmentedResponseHandling::kReassemble;
+          fragmented_response.message_ = std::move(ret_val.second);
+        } else {
+          handler_impl_->GetDoipChannel().HandleMessage(std::move(ret_val.second));
+        }
+      } else if (ret_val.first ==
+                 uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationStreamed) {
+        // hand over the received bytes as they are, remaining fragments follow the same way
+        handler_impl_->GetDoipChannel().HandleMessageChunk(doip_payload.GetServerAddress(),
+                                                           doip_payload.GetClientAddress(),
+                                                           doip_payload.GetPayload());
+        if (is_fragmented) { fragmented_response.handling_ = FragmentedResponseHandling::kStream; }
       } else {
         logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
             FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
               msg << "Diagnostic message response ignored due to unknown error";
             });
       }
-      handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kIdle);
     }
   } else {
     // ignore
     logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
-        FILE_NAME, __LINE__, __func__, [this](std::stringstream &msg) {
-          msg << "Diagnostic message response ignored due to channel in state: "
-              << static_cast<int>(handler_impl_->GetStateContext().GetActiveState().GetState());
+        FILE_NAME, __LINE__, __func__, [&request_state](std::stringstream &msg) {
+          msg << "Diagnostic message response ignored due to request in state: "
+              << static_cast<int>(request_state);
         });
   }
 }
 
+auto DiagnosticMessageHandler::ProcessDoIPDiagnosticMessageFragment(
+    core_type::Span<std::uint8_t const> fragment, bool const last_fragment) noexcept -> void {
+  FragmentedResponse &fragmented_response{handler_impl_->GetFragmentedResponse()};
+  switch (fragmented_response.handling_) {
+    case FragmentedResponseHandling::kReassemble: {
+      uds_transport::ByteVector &payload{fragmented_response.message_->GetPayload()};
+      payload.insert(payload.end(), fragment.begin(), fragment.end());
+      if (last_fragment) {
+        handler_impl_->GetDoipChannel().HandleMessage(std::move(fragmented_response.message_));
+      }
+      break;
+    }
+    case FragmentedResponseHandling::kStream:
+      handler_impl_->GetDoipChannel().HandleMessageChunk(
+          fragmented_response.source_address_, fragmented_response.target_address_, fragment);
+      break;
+    default:
+      // response not requested by upper layer
+      break;
+  }
+  if (last_fragment) { fragmented_response = FragmentedResponse{}; }
+}
+
 auto DiagnosticMessageHandler::HandleDiagnosticRequest(
     uds_transport::UdsMessageConstPtr diagnostic_request) noexcept
     -> uds_transport::UdsTransportProtocolMgr::TransmissionResult {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult result{
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      DiagnosticMessageState::kIdle) {
+  InFlightRequestKey const key{diagnostic_request->GetSa(), diagnostic_request->GetTa()};
+  // register the request before sending, as acknowledgement may arrive before transmission returns
+  DiagnosticMessageHandlerImpl::InFlightRequestPtr const in_flight_request{
+      handler_impl_->AddInFlightRequest(key)};
+  if (in_flight_request) {
     if (SendDiagnosticRequest(std::move(diagnostic_request)) ==
         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
-      handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kWaitForDiagnosticAck);
-      handler_impl_->GetSyncTimer().WaitForTimeout(
-          [this, &result]() {
-            result =
-                uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNoTransmitAckReceived;
-            handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kIdle);
-            logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
-                FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                  msg << "Diagnostic Message Ack Request timed out, no "
-                         "response received in: "
-                      << kDoIPDiagnosticAckTimeout << " seconds";
-                });
-          },
-          [this, &result]() {
-            if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-                DiagnosticMessageState::kDiagnosticPositiveAckRecvd) {
-              handler_impl_->GetStateContext().TransitionTo(
-                  DiagnosticMessageState::kWaitForDiagnosticResponse);
-              // success
-              result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
-              logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-                  FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                    msg << "Diagnostic Message Positive Ack received";
-                  });
-            } else {
-              // failed with neg acknowledgement from server
-              result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::
-                  kNegTransmitAckReceived;
-              handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kIdle);
-              logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-                  FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                    msg << "Diagnostic Message Transmission Failed Neg Ack "
-                           "Received";
-                  });
-            }
-          },
-          std::chrono::milliseconds{kDoIPDiagnosticAckTimeout});
+      switch (handler_impl_->WaitForAcknowledgement(
+          in_flight_request, std::chrono::milliseconds{kDoIPDiagnosticAckTimeout})) {
+        case DiagnosticMessageState::kWaitForDiagnosticAck:
+          result =
+              uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNoTransmitAckReceived;
+          handler_impl_->RemoveInFlightRequest(key, in_flight_request);
+          logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+              FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+                msg << "Diagnostic Message Ack Request timed out, no "
+                       "response received in: "
+                    << kDoIPDiagnosticAckTimeout << " milliseconds";
+              });
+          break;
+        case DiagnosticMessageState::kWaitForDiagnosticResponse:
+          // success
+          result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
+          logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+              FILE_NAME, __LINE__, "",
+              [](std::stringstream &msg) { msg << "Diagnostic Message Positive Ack received"; });
+          break;
+        case DiagnosticMessageState::kDiagnosticNegativeAckRecvd:
+          // failed with neg acknowledgement from server
+          result =
+              uds_transport::UdsTransportProtocolMgr::TransmissionResult::kNegTransmitAckReceived;
+          handler_impl_->RemoveInFlightRequest(key, in_flight_request);
+          logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+              FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+                msg << "Diagnostic Message Transmission Failed Neg Ack "
+                       "Received";
+              });
+          break;
+        default:
+          // aborted due to channel stop
+          handler_impl_->RemoveInFlightRequest(key, in_flight_request);
+          break;
+      }
     } else {
       // Failed, do nothing
-      handler_impl_->GetStateContext().TransitionTo(DiagnosticMessageState::kIdle);
+      handler_impl_->RemoveInFlightRequest(key, in_flight_request);
       logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
           FILE_NAME, __LINE__, "",
           [](std::stringstream &msg) { msg << "Diagnostic Request Message Transmission Failed"; });
     }
   } else {
-    // channel not in idle state
+    // request towards same target already waiting for acknowledgement
     result = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kBusyProcessing;
     logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
         FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
@@ -554,36 +731,50 @@ auto DiagnosticMessageHandler::HandleDiagnosticRequest(
   return result;
 }
 
+void DiagnosticMessageHandler::HandleDiagnosticRequestAsync(
+    uds_transport::UdsMessageConstPtr diagnostic_request,
+    uds_transport::Connection::TransmissionCompletionHandler completion_handler) noexcept {
+  InFlightRequestKey const key{diagnostic_request->GetSa(), diagnostic_request->GetTa()};
+  // register the request before sending, as acknowledgement may arrive before transmission returns
+  DiagnosticMessageHandlerImpl::InFlightRequestPtr const in_flight_request{
+      handler_impl_->AddInFlightRequest(key)};
+  if (in_flight_request) {
+    // not sent if the channel is stopped meanwhile
+    if (!handler_impl_->MonitorAcknowledgement(
+            key, in_flight_request, std::move(completion_handler),
+            std::chrono::milliseconds{kDoIPDiagnosticAckTimeout}) ||
+        (SendDiagnosticRequest(std::move(diagnostic_request)) !=
+         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk)) {
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "Diagnostic Request Message Transmission Failed"; });
+      handler_impl_->CompleteInFlightRequest(
+          key, in_flight_request,
+          uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed);
+    }
+  } else {
+    // request towards same target already waiting for acknowledgement
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogVerbose(
+        FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+          msg << "Diagnostic Message Transmission already in progress";
+        });
+    completion_handler(uds_transport::UdsTransportProtocolMgr::TransmissionResult::kBusyProcessing);
+  }
+}
+
 auto DiagnosticMessageHandler::SendDiagnosticRequest(
     uds_transport::UdsMessageConstPtr diagnostic_request) noexcept
     -> uds_transport::UdsTransportProtocolMgr::TransmissionResult {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult ret_val{
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
-  constexpr std::uint8_t kSourceAddressSize{4u};
-  // Create header
-  std::uint32_t const total_diagnostic_response_length{static_cast<uint32_t>(
-      kDoipDiagMessageReqResMinLen + diagnostic_request->GetPayload().size())};
-  TcpMessage::BufferType compose_diag_req{
-      CreateDoipGenericHeader(kDoipDiagMessage, total_diagnostic_response_length)};
-  compose_diag_req.reserve(kDoipheadrSize + total_diagnostic_response_length);
-
-  // Add source address
-  compose_diag_req.emplace_back(
-      static_cast<std::uint8_t>((diagnostic_request->GetSa() & 0xFF00) >> 8u));
-  compose_diag_req.emplace_back(static_cast<std::uint8_t>(diagnostic_request->GetSa() & 0x00FF));
-  // Add target address
-  compose_diag_req.emplace_back(
-      static_cast<std::uint8_t>((diagnostic_request->GetTa() & 0xFF00) >> 8u));
-  compose_diag_req.emplace_back(static_cast<std::uint8_t>(diagnostic_request->GetTa() & 0x00FF));
-  // Copy data bytes
-  compose_diag_req.insert(compose_diag_req.begin() + kDoipheadrSize + kSourceAddressSize,
-                          diagnostic_request->GetPayload().begin(),
-                          diagnostic_request->GetPayload().end());
-  TcpMessagePtr doip_diag_req{std::make_unique<TcpMessage>(diagnostic_request->GetHostIpAddress(),
-                                                           diagnostic_request->GetHostPortNumber(),
-                                                           std::move(compose_diag_req))};
+  // Header lives on stack, uds payload is borrowed and written with single vectored write
+  DiagnosticMessageHeader const diag_req_header{CreateDiagnosticMessageHeader(
+      diagnostic_request->GetSa(), diagnostic_request->GetTa(),
+      static_cast<std::uint32_t>(diagnostic_request->GetPayload().size()))};
+  std::array<TcpMessageBufferView, 2u> const diag_req_buffers{
+      TcpMessageBufferView{diag_req_header}, TcpMessageBufferView{diagnostic_request->GetPayload()}};
   // Initiate transmission
-  if (handler_impl_->GetSocketHandler().Transmit(std::move(doip_diag_req))) {
+  if (handler_impl_->GetSocketHandler().Transmit(TcpMessageBufferViews{diag_req_buffers})) {
     ret_val = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
   }
   return ret_val;
@@ -13,6 +13,7 @@
 
 #include "common/doip_message.h"
 #include "sockets/socket_handler.h"
+#include "uds_transport/connection.h"
 #include "uds_transport/protocol_mgr.h"
 #include "uds_transport/uds_message.h"
 
@@ -24,7 +25,7 @@ namespace tcp_channel {
 class DoipTcpChannel;
 
 /**
- * @brief       Class used as a handler to process routing activation messages
+ * @brief       Class used as a handler to process diagnostic messages
  */
 class DiagnosticMessageHandler final {
  public:
@@ -38,6 +39,16 @@ class DiagnosticMessageHandler final {
    */
   using TcpMessage = sockets::TcpSocketHandler::Message;
 
+  /**
+   * @brief  Type alias for view on Tcp message buffer
+   */
+  using TcpMessageBufferView = boost_support::message::tcp::TcpMessageBufferView;
+
+  /**
+   * @brief  Type alias for views on Tcp message buffers
+   */
+  using TcpMessageBufferViews = boost_support::message::tcp::TcpMessageBufferViews;
+
  public:
   /**
    * @brief         Constructs an instance of DiagnosticMessageHandler
@@ -79,13 +90,29 @@ class DiagnosticMessageHandler final {
 
   /**
    * @brief       Function to process received diagnostic positive/negative response from server
+   * @details     The message may be the first fragment of a large response, its remaining bytes follow with
+   *              ProcessDoIPDiagnosticMessageFragment
    * @param[in]   doip_payload
    *              The doip message received
    */
   void ProcessDoIPDiagnosticMessageResponse(DoipMessage &doip_payload) noexcept;
 
+  /**
+   * @brief       Function to process the next fragment of a large diagnostic response from server
+   * @details     The fragment is streamed to the conversation or appended to the response, depending on the
+   *              indication of the first fragment
+   * @param[in]   fragment
+   *              The next bytes of the response
+   * @param[in]   last_fragment
+   *              True if the fragment completes the response
+   */
+  void ProcessDoIPDiagnosticMessageFragment(core_type::Span<std::uint8_t const> fragment,
+                                            bool last_fragment) noexcept;
+
   /**
    * @brief       Function to handle sending of diagnostic request
+   * @details     Requests with different source/target address pair are processed concurrently, a request is
+   *              rejected with kBusyProcessing only while another one with same pair waits for acknowledgement
    * @param[in]   diagnostic_request
    *              The diagnostic request
    * @return      The Transmission result
@@ -93,6 +120,19 @@ class DiagnosticMessageHandler final {
   auto HandleDiagnosticRequest(uds_transport::UdsMessageConstPtr diagnostic_request) noexcept
       -> uds_transport::UdsTransportProtocolMgr::TransmissionResult;
 
+  /**
+   * @brief       Function to handle sending of diagnostic request without waiting for its acknowledgement
+   * @details     The acknowledgement or its timeout completes the request from the reader or timer context, the
+   *              handler is invoked from the calling context only if the request could not be sent
+   * @param[in]   diagnostic_request
+   *              The diagnostic request
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void HandleDiagnosticRequestAsync(
+      uds_transport::UdsMessageConstPtr diagnostic_request,
+      uds_transport::Connection::TransmissionCompletionHandler completion_handler) noexcept;
+
  private:
   /**
    * @brief       Function to send diagnostic request
@@ -8,13 +8,16 @@
 
 #include "channel/tcp_channel/doip_routing_activation_handler.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
-#include "utility/state.h"
-#include "utility/sync_timer.h"
+#include "utility/state_machine.h"
+#include "utility/timer_service.h"
 
 namespace doip_client {
 namespace channel {
@@ -72,99 +75,23 @@ enum class RoutingActivationState : std::uint8_t {
 };
 
 /**
- * @brief       Class implements idle state
+ * @brief  Allowed routing activation state transitions
  */
-class kIdle final : public utility::state::State<RoutingActivationState> {
- public:
-  /**
-   * @brief         Constructs an instance of kIdle
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kIdle(RoutingActivationState state) : State<RoutingActivationState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
-
-/**
- * @brief       Class implements wait for routing activation response
- */
-class kWaitForRoutingActivationRes final : public utility::state::State<RoutingActivationState> {
- public:
-  /**
-   * @brief         Constructs an instance of kWaitForRoutingActivationRes
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kWaitForRoutingActivationRes(RoutingActivationState state)
-      : State<RoutingActivationState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
+constexpr std::pair<RoutingActivationState, RoutingActivationState> kRoutingActivationTransitions[]{
+    {RoutingActivationState::kIdle, RoutingActivationState::kWaitForRoutingActivationRes},
+    {RoutingActivationState::kWaitForRoutingActivationRes,
+     RoutingActivationState::kRoutingActivationSuccessful},
+    {RoutingActivationState::kWaitForRoutingActivationRes,
+     RoutingActivationState::kRoutingActivationFailed},
+    {RoutingActivationState::kWaitForRoutingActivationRes, RoutingActivationState::kIdle},
+    {RoutingActivationState::kRoutingActivationSuccessful, RoutingActivationState::kIdle},
+    {RoutingActivationState::kRoutingActivationFailed, RoutingActivationState::kIdle}};
 
 /**
- * @brief       Class implements routing activation success
+ * @brief  Routing activation transition table
  */
-class kRoutingActivationSuccessful final : public utility::state::State<RoutingActivationState> {
- public:
-  /**
-   * @brief         Constructs an instance of kRoutingActivationSuccessful
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kRoutingActivationSuccessful(RoutingActivationState state)
-      : State<RoutingActivationState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
-
-/**
- * @brief       Class implements routing activation failure
- */
-class kRoutingActivationFailed final : public utility::state::State<RoutingActivationState> {
- public:
-  /**
-   * @brief         Constructs an instance of kRoutingActivationFailed
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kRoutingActivationFailed(RoutingActivationState state)
-      : State<RoutingActivationState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
+constexpr utility::state::TransitionTable<RoutingActivationState, 4u>
+    kRoutingActivationTransitionTable{kRoutingActivationTransitions};
 
 /**
  * @brief  Type holding activation type
@@ -238,14 +165,10 @@ auto CreateDoipGenericHeader(std::uint16_t payload_type, std::uint32_t payload_l
 class RoutingActivationHandler::RoutingActivationHandlerImpl final {
  public:
   /**
-   * @brief  Type alias for state context
+   * @brief  Type alias for state machine
    */
-  using RoutingActivationStateContext = utility::state::StateContext<RoutingActivationState>;
-
-  /**
-   * @brief  Type alias for Sync timer
-   */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using RoutingActivationStateMachine =
+      utility::state::StateMachine<RoutingActivationState, kRoutingActivationTransitionTable>;
 
   /**
    * @brief         Constructs an instance of RoutingActivationHandlerImpl
@@ -254,27 +177,9 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
    */
   explicit RoutingActivationHandlerImpl(sockets::TcpSocketHandler &tcp_socket_handler)
       : tcp_socket_handler_{tcp_socket_handler},
-        state_context_{},
-        sync_timer_{} {
-    // create and add state for routing activation
-    // kIdle
-    state_context_.AddState(RoutingActivationState::kIdle,
-                            std::make_unique<kIdle>(RoutingActivationState::kIdle));
-    // kWaitForRoutingActivationRes
-    state_context_.AddState(RoutingActivationState::kWaitForRoutingActivationRes,
-                            std::make_unique<kWaitForRoutingActivationRes>(
-                                RoutingActivationState::kWaitForRoutingActivationRes));
-    // kRoutingActivationSuccessful
-    state_context_.AddState(RoutingActivationState::kRoutingActivationSuccessful,
-                            std::make_unique<kRoutingActivationSuccessful>(
-                                RoutingActivationState::kRoutingActivationSuccessful));
-    // kRoutingActivationFailed
-    state_context_.AddState(RoutingActivationState::kRoutingActivationFailed,
-                            std::make_unique<kRoutingActivationFailed>(
-                                RoutingActivationState::kRoutingActivationFailed));
-    // Transit to idle state
-    state_context_.TransitionTo(RoutingActivationState::kIdle);
-  }
+        state_machine_{RoutingActivationState::kIdle},
+        state_lock_{},
+        state_cond_var_{} {}
 
   /**
    * @brief        Function to start the handler
@@ -286,8 +191,11 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
    * @details      This will reset all the internal handler back to default state
    */
   void Stop() {
-    if (sync_timer_.IsTimerActive()) { sync_timer_.CancelWait(); }
-    state_context_.TransitionTo(RoutingActivationState::kIdle);
+    {
+      std::lock_guard<std::mutex> const lock{state_lock_};
+      static_cast<void>(state_machine_.TransitionTo(RoutingActivationState::kIdle));
+    }
+    state_cond_var_.notify_all();
   }
 
   /**
@@ -296,12 +204,6 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
    */
   void Reset() { Stop(); }
 
-  /**
-   * @brief       Function to get the Routing Activation State context
-   * @return      The reference to state context
-   */
-  auto GetStateContext() noexcept -> RoutingActivationStateContext & { return state_context_; }
-
   /**
    * @brief       Function to get the socket handler
    * @return      The reference to socket handler
@@ -309,10 +211,58 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
   auto GetSocketHandler() noexcept -> sockets::TcpSocketHandler & { return tcp_socket_handler_; }
 
   /**
-   * @brief       Function to get the sync timer
-   * @return      The reference to sync timer
+   * @brief       Function to get the current routing activation state
+   * @return      The current state
    */
-  auto GetSyncTimer() noexcept -> SyncTimer & { return sync_timer_; }
+  auto GetState() const noexcept -> RoutingActivationState { return state_machine_.GetState(); }
+
+  /**
+   * @brief       Function to move from one state to another when the current state matches
+   * @param[in]   expected_state
+   *              The state expected to be active
+   * @param[in]   new_state
+   *              The state to move into
+   * @return      True when transition happened, otherwise false
+   */
+  auto UpdateState(RoutingActivationState expected_state,
+                   RoutingActivationState new_state) noexcept -> bool {
+    bool updated{false};
+    {
+      // lock only to not miss the wake-up of a waiter evaluating the state
+      std::lock_guard<std::mutex> const lock{state_lock_};
+      updated = state_machine_.TransitionTo(expected_state, new_state);
+    }
+    if (updated) { state_cond_var_.notify_all(); }
+    return updated;
+  }
+
+  /**
+   * @brief       Function to wait until the routing activation response is processed
+   * @details     The wait ends when state leaves kWaitForRoutingActivationRes. The timeout is monitored by the
+   *              timer service, which moves the handler back to kIdle on expiry
+   * @param[in]   timeout
+   *              The maximum time to wait
+   * @return      The state after the wait, kIdle on timeout
+   */
+  auto WaitForRoutingActivationResponse(std::chrono::milliseconds timeout) noexcept
+      -> RoutingActivationState {
+    utility::timer::TimerService::TimerId const timer_id{
+        utility::timer::TimerService::GetTimerService().Arm(timeout, [this]() {
+          static_cast<void>(UpdateState(RoutingActivationState::kWaitForRoutingActivationRes,
+                                        RoutingActivationState::kIdle));
+        })};
+    RoutingActivationState state{};
+    {
+      std::unique_lock<std::mutex> lock{state_lock_};
+      state_cond_var_.wait(lock, [this]() {
+        return state_machine_.GetState() != RoutingActivationState::kWaitForRoutingActivationRes;
+      });
+      state = state_machine_.GetState();
+    }
+    // the timer callback takes the state lock, cancel without holding it
+    static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(timer_id));
+    return state;
+  }
 
  private:
   /**
@@ -321,14 +271,19 @@ class RoutingActivationHandler::RoutingActivationHandlerImpl final {
   sockets::TcpSocketHandler &tcp_socket_handler_;
 
   /**
-   * @brief  Stores the routing activation states
+   * @brief  Stores the routing activation state
+   */
+  RoutingActivationStateMachine state_machine_;
+
+  /**
+   * @brief  Store the lock synchronizing state changes with the waiting requester
    */
-  RoutingActivationStateContext state_context_;
+  std::mutex state_lock_;
 
   /**
-   * @brief  Store the synchronous timer
+   * @brief  Store the condition variable notified on state change
    */
-  SyncTimer sync_timer_;
+  std::condition_variable state_cond_var_;
 };
 
 RoutingActivationHandler::RoutingActivationHandler(sockets::TcpSocketHandler &tcp_socket_handler)
@@ -345,8 +300,7 @@ void RoutingActivationHandler::Reset() { handler_impl_->Reset(); }
 auto RoutingActivationHandler::ProcessDoIPRoutingActivationResponse(
     DoipMessage &doip_payload) noexcept -> void {
   RoutingActivationState final_state{RoutingActivationState::kRoutingActivationFailed};
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      RoutingActivationState::kWaitForRoutingActivationRes) {
+  if (handler_impl_->GetState() == RoutingActivationState::kWaitForRoutingActivationRes) {
     // get the ack code
     RoutingActivationAckType const rout_act_type{doip_payload.GetPayload()[0u]};
     switch (rout_act_type.act_type_) {
@@ -377,8 +331,7 @@ auto RoutingActivationHandler::ProcessDoIPRoutingActivationResponse(
             });
         break;
     }
-    handler_impl_->GetStateContext().TransitionTo(final_state);
-    handler_impl_->GetSyncTimer().CancelWait();
+    handler_impl_->UpdateState(RoutingActivationState::kWaitForRoutingActivationRes, final_state);
   } else {
     /* ignore */
   }
@@ -389,45 +342,42 @@ auto RoutingActivationHandler::HandleRoutingActivationRequest(
     -> uds_transport::UdsTransportProtocolMgr::ConnectionResult {
   uds_transport::UdsTransportProtocolMgr::ConnectionResult result{
       uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionFailed};
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      RoutingActivationState::kIdle) {
+  // Move to wait state before sending, so that a fast response is never missed
+  if (handler_impl_->UpdateState(RoutingActivationState::kIdle,
+                                 RoutingActivationState::kWaitForRoutingActivationRes)) {
     if (SendRoutingActivationRequest(std::move(routing_activation_request)) ==
         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
       // Wait for routing activation response
-      handler_impl_->GetStateContext().TransitionTo(
-          RoutingActivationState::kWaitForRoutingActivationRes);
-      handler_impl_->GetSyncTimer().WaitForTimeout(
-          [this, &result]() {
-            result = uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionTimeout;
-            handler_impl_->GetStateContext().TransitionTo(RoutingActivationState::kIdle);
-            logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
-                FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                  msg << "RoutingActivation response timeout, no response "
-                         "received in: "
-                      << kDoIPRoutingActivationTimeout << " milliseconds";
-                });
-          },
-          [this, &result]() {
-            if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-                RoutingActivationState::kRoutingActivationSuccessful) {
-              // success
-              result = uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionOk;
-              logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
-                  FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                    msg << "RoutingActivation successful with remote server";
-                  });
-            } else {  // failed
-              handler_impl_->GetStateContext().TransitionTo(RoutingActivationState::kIdle);
-              logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
-                  FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
-                    msg << "RoutingActivation failed with remote server";
-                  });
-            }
-          },
-          std::chrono::milliseconds{kDoIPRoutingActivationTimeout});
+      RoutingActivationState const state{handler_impl_->WaitForRoutingActivationResponse(
+          std::chrono::milliseconds{kDoIPRoutingActivationTimeout})};
+      if (state == RoutingActivationState::kRoutingActivationSuccessful) {
+        // success
+        result = uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionOk;
+        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+            FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+              msg << "RoutingActivation successful with remote server";
+            });
+      } else if (state == RoutingActivationState::kIdle) {
+        // no response received
+        result = uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionTimeout;
+        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+            FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+              msg << "RoutingActivation response timeout, no response "
+                     "received in: "
+                  << kDoIPRoutingActivationTimeout << " milliseconds";
+            });
+      } else {  // failed
+        handler_impl_->UpdateState(RoutingActivationState::kRoutingActivationFailed,
+                                   RoutingActivationState::kIdle);
+        logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+            FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
+              msg << "RoutingActivation failed with remote server";
+            });
+      }
     } else {
       // failed, do nothing
-      handler_impl_->GetStateContext().TransitionTo(RoutingActivationState::kIdle);
+      handler_impl_->UpdateState(RoutingActivationState::kWaitForRoutingActivationRes,
+                                 RoutingActivationState::kIdle);
       logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
           FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
             msg << "RoutingActivation Request send failed with remote server";
@@ -443,8 +393,7 @@ auto RoutingActivationHandler::HandleRoutingActivationRequest(
 }
 
 auto RoutingActivationHandler::IsRoutingActivated() noexcept -> bool {
-  return (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-          RoutingActivationState::kRoutingActivationSuccessful);
+  return (handler_impl_->GetState() == RoutingActivationState::kRoutingActivationSuccessful);
 }
 
 auto RoutingActivationHandler::SendRoutingActivationRequest(
@@ -8,13 +8,23 @@
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "common/common_doip_types.h"
 #include "common/logger.h"
 
 namespace doip_client {
 namespace channel {
 namespace tcp_channel {
+namespace {
+
+/**
+ * @brief  Length of source and target address preceding the UdsMessage in diagnostic message
+ */
+constexpr std::size_t kDoipDiagMessageAddressLength{4u};
+
+}  // namespace
 
 DoipTcpChannel::DoipTcpChannel(TcpSocketHandler tcp_socket_handler,
                                uds_transport::Connection &connection)
@@ -26,6 +36,12 @@ void DoipTcpChannel::Start() {
   // Set the handler to receive data from socket handler
   tcp_socket_handler_.SetReadHandler(
       [this](TcpMessagePtr tcp_message) { ProcessReceivedTcpMessage(std::move(tcp_message)); });
+  // Set the handler to get informed about lost connection
+  tcp_socket_handler_.SetDisconnectHandler([this]() { HandleConnectionLoss(); });
+  // Payload exceeding the channel length is skipped by the socket instead of being received
+  tcp_socket_handler_.SetMaxPayloadLength(kTcpChannelLength);
+  // Large diagnostic messages are received in fragments, so that they can be streamed to upper layer
+  tcp_socket_handler_.SetFragmentedReception(true);
   // Start the socket and channel handler
   tcp_socket_handler_.Initialize();
   tcp_channel_handler_.Start();
@@ -72,10 +88,28 @@ uds_transport::UdsTransportProtocolMgr::DisconnectionResult DoipTcpChannel::Disc
   return ret_val;
 }
 
+void DoipTcpChannel::SetRxBufferSize(std::size_t const rx_buffer_size) noexcept {
+  std::uint32_t const max_diag_payload_length{static_cast<std::uint32_t>(std::clamp(
+      rx_buffer_size + kDoipDiagMessageAddressLength, std::size_t{kTcpChannelLength},
+      std::size_t{kDoip_Protocol_MaxPayload}))};
+  tcp_channel_handler_.SetMaxDiagnosticPayloadLength(max_diag_payload_length);
+  tcp_socket_handler_.SetMaxPayloadLength(max_diag_payload_length);
+}
+
 void DoipTcpChannel::ProcessReceivedTcpMessage(TcpMessagePtr tcp_rx_message) {
   tcp_channel_handler_.HandleMessage(std::move(tcp_rx_message));
 }
 
+void DoipTcpChannel::HandleConnectionLoss() {
+  logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+      FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+        msg << "Doip Tcp connection to remote server lost, disconnect and connect again";
+      });
+  // Reset the handler, pending requests are not answered anymore
+  tcp_channel_handler_.Reset();
+  connection_.HandleConnectionLoss();
+}
+
 uds_transport::UdsTransportProtocolMgr::TransmissionResult DoipTcpChannel::Transmit(
     uds_transport::UdsMessageConstPtr message) {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult ret_val{
@@ -92,6 +126,21 @@ uds_transport::UdsTransportProtocolMgr::TransmissionResult DoipTcpChannel::Trans
   return ret_val;
 }
 
+void DoipTcpChannel::TransmitAsync(
+    uds_transport::UdsMessageConstPtr message,
+    uds_transport::Connection::TransmissionCompletionHandler completion_handler) {
+  // Routing activation should be active before sending diag request
+  if (tcp_channel_handler_.IsRoutingActivated()) {
+    tcp_channel_handler_.SendDiagnosticRequestAsync(std::move(message), std::move(completion_handler));
+  } else {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+          msg << "Routing Activation required, please connect to server first";
+        });
+    completion_handler(uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed);
+  }
+}
+
 std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
 DoipTcpChannel::IndicateMessage(uds_transport::UdsMessage::Address source_addr,
                                 uds_transport::UdsMessage::Address target_addr,
@@ -108,6 +157,12 @@ void DoipTcpChannel::HandleMessage(uds_transport::UdsMessagePtr message) {
   connection_.HandleMessage(std::move(message));
 }
 
+void DoipTcpChannel::HandleMessageChunk(uds_transport::UdsMessage::Address source_addr,
+                                        uds_transport::UdsMessage::Address target_addr,
+                                        core_type::Span<std::uint8_t const> chunk) {
+  connection_.HandleMessageChunk(source_addr, target_addr, chunk);
+}
+
 }  // namespace tcp_channel
 }  // namespace channel
 }  // namespace doip_client
@@ -121,6 +121,16 @@ class DoipTcpChannel final {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult Transmit(
       uds_transport::UdsMessageConstPtr message);
 
+  /**
+   * @brief       Function to transmit a valid Uds message without waiting for its acknowledgement
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void TransmitAsync(uds_transport::UdsMessageConstPtr message,
+                     uds_transport::Connection::TransmissionCompletionHandler completion_handler);
+
   /**
    * @brief       Function to Hands over a valid received Uds message to upper layer
    * @param[in]   message
@@ -129,6 +139,19 @@ class DoipTcpChannel final {
    */
   void HandleMessage(uds_transport::UdsMessagePtr message);
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message to upper layer
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the next payload bytes, valid within this function call only
+   */
+  void HandleMessageChunk(uds_transport::UdsMessage::Address source_addr,
+                          uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk);
+
   /**
    * @brief       Function to process the received Tcp message from socket layer
    * @param[in]   tcp_rx_message
@@ -137,6 +160,22 @@ class DoipTcpChannel final {
    */
   void ProcessReceivedTcpMessage(TcpMessagePtr tcp_rx_message);
 
+  /**
+   * @brief       Function to handle the loss of connection to remote host server
+   * @details     This is called from the socket layer when the remote server closed the connection or did not
+   *              answer the liveness probe, the pending request is finished and routing activation reset
+   */
+  void HandleConnectionLoss();
+
+  /**
+   * @brief       Function to set the size of the largest diagnostic message received
+   * @details     Diagnostic messages are received up to the larger of this size and the channel length, other
+   *              payload types are limited to the channel length
+   * @param[in]   rx_buffer_size
+   *              The size in bytes of the UdsMessage starting from SID
+   */
+  void SetRxBufferSize(std::size_t rx_buffer_size) noexcept;
+
  private:
   /**
    * @brief  Store the tcp socket handler
@@ -8,6 +8,7 @@
 
 #include "channel/tcp_channel/doip_tcp_channel_handler.h"
 
+#include <array>
 #include <utility>
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
@@ -25,6 +26,11 @@ namespace {
  */
 constexpr std::uint16_t kDoip_RoutingActivation_ResType{0x0006};
 
+/**
+ * @brief  Generic DoIP Header NACK Type
+ */
+constexpr std::uint16_t kDoip_GenericHeadr_NackType{0x0000};
+
 /**
  * @brief  Diagnostic message type
  */
@@ -36,7 +42,6 @@ constexpr std::uint16_t kDoipDiagMessageNegAck{0x8003};
  * @brief  Alive check type
  */
 constexpr std::uint16_t kDoip_AliveCheck_ReqType{0x0007};
-constexpr std::uint16_t kDoip_AliveCheck_ResType{0x0008};
 
 /**
  * @brief  Generic DoIP Header NACK codes
@@ -44,7 +49,6 @@ constexpr std::uint16_t kDoip_AliveCheck_ResType{0x0008};
 constexpr std::uint8_t kDoip_GenericHeader_IncorrectPattern{0x00};
 constexpr std::uint8_t kDoip_GenericHeader_UnknownPayload{0x01};
 constexpr std::uint8_t kDoip_GenericHeader_MessageTooLarge{0x02};
-constexpr std::uint8_t kDoip_GenericHeader_OutOfMemory{0x03};
 constexpr std::uint8_t kDoip_GenericHeader_InvalidPayloadLen{0x04};
 
 /**
@@ -61,31 +65,75 @@ constexpr std::uint8_t kDoipDiagMessageAckResMinLen = 5U;  // considering SA, TA
 constexpr std::uint32_t kDoipRoutingActivationResMinLen{9u};   // without OEM specific use byte
 constexpr std::uint32_t kDoipRoutingActivationResMaxLen{13u};  //with OEM specific use byte
 
+/**
+ * @brief  Alive check request length
+ */
+constexpr std::uint32_t kDoipAliveCheckReqLen{0u};
+
+/**
+ * @brief  Generic DoIP Header NACK length, considering NACK code
+ */
+constexpr std::uint32_t kDoipGenericHeaderNackLen{1u};
+
+/**
+ * @brief  Type holding doip generic header followed by NACK code
+ */
+using GenericHeaderNack = std::array<std::uint8_t, kDoipheadrSize + kDoipGenericHeaderNackLen>;
+
+/**
+ * @brief            Function to create the generic header negative acknowledgement
+ * @param[in]        nack_code
+ *                   The negative ack code
+ * @return           The generic header negative acknowledgement to be transmitted
+ */
+auto CreateGenericHeaderNack(std::uint8_t nack_code) noexcept -> GenericHeaderNack {
+  return GenericHeaderNack{
+      kDoip_ProtocolVersion,
+      static_cast<std::uint8_t>(~(static_cast<std::uint8_t>(kDoip_ProtocolVersion))),
+      static_cast<std::uint8_t>((kDoip_GenericHeadr_NackType & 0xFF00) >> 8),
+      static_cast<std::uint8_t>(kDoip_GenericHeadr_NackType & 0x00FF),
+      static_cast<std::uint8_t>((kDoipGenericHeaderNackLen & 0xFF000000) >> 24),
+      static_cast<std::uint8_t>((kDoipGenericHeaderNackLen & 0x00FF0000) >> 16),
+      static_cast<std::uint8_t>((kDoipGenericHeaderNackLen & 0x0000FF00) >> 8),
+      static_cast<std::uint8_t>(kDoipGenericHeaderNackLen & 0x000000FF),
+      nack_code};
+}
+
 }  // namespace
 
 DoipTcpChannelHandler::DoipTcpChannelHandler(sockets::TcpSocketHandler &tcp_socket_handler,
                                              DoipTcpChannel &channel)
-    : routing_activation_handler_{tcp_socket_handler},
-      diagnostic_message_handler_{tcp_socket_handler, channel} {}
+    : tcp_socket_handler_{tcp_socket_handler},
+      routing_activation_handler_{tcp_socket_handler},
+      diagnostic_message_handler_{tcp_socket_handler, channel},
+      alive_check_handler_{tcp_socket_handler},
+      max_diagnostic_payload_length_{kTcpChannelLength},
+      fragmented_frame_size_{},
+      is_fragmented_diagnostic_message_{false} {}
 
 void DoipTcpChannelHandler::Start() {
   routing_activation_handler_.Start();
   diagnostic_message_handler_.Start();
+  alive_check_handler_.Start();
 }
 
 void DoipTcpChannelHandler::Stop() {
   routing_activation_handler_.Stop();
   diagnostic_message_handler_.Stop();
+  alive_check_handler_.Stop();
 }
 
 void DoipTcpChannelHandler::Reset() {
   routing_activation_handler_.Reset();
   diagnostic_message_handler_.Reset();
+  alive_check_handler_.Reset();
 }
 
 auto DoipTcpChannelHandler::SendRoutingActivationRequest(
     uds_transport::UdsMessageConstPtr routing_activation_request) noexcept
     -> uds_transport::UdsTransportProtocolMgr::ConnectionResult {
+  // alive check requests may arrive right after activation, register the source address before
+  alive_check_handler_.SetSourceAddress(routing_activation_request->GetSa());
   return routing_activation_handler_.HandleRoutingActivationRequest(
       std::move(routing_activation_request));
 }
@@ -96,16 +144,35 @@ auto DoipTcpChannelHandler::SendDiagnosticRequest(
   return diagnostic_message_handler_.HandleDiagnosticRequest(std::move(diagnostic_request));
 }
 
+void DoipTcpChannelHandler::SendDiagnosticRequestAsync(
+    uds_transport::UdsMessageConstPtr diagnostic_request,
+    uds_transport::Connection::TransmissionCompletionHandler completion_handler) noexcept {
+  diagnostic_message_handler_.HandleDiagnosticRequestAsync(std::move(diagnostic_request),
+                                                           std::move(completion_handler));
+}
+
 auto DoipTcpChannelHandler::HandleMessage(TcpMessagePtr tcp_rx_message) noexcept -> void {
+  if (tcp_rx_message->GetFrameOffset() != 0u) {
+    // header was processed with the first fragment
+    ProcessDoIPPayloadFragment(*tcp_rx_message);
+    return;
+  }
   std::uint8_t nack_code{};
+  std::size_t const received_size{tcp_rx_message->GetPayload().size()};
+  // take over the received buffer, so that payload is handed to upper layer without copy
   DoipMessage doip_rx_message{DoipMessage::MessageType::kTcp, tcp_rx_message->GetHostIpAddress(),
-                              tcp_rx_message->GetHostPortNumber(), tcp_rx_message->GetPayload()};
+                              tcp_rx_message->GetHostPortNumber(),
+                              tcp_rx_message->ReleasePayload()};
+  fragmented_frame_size_ = kDoipheadrSize + std::size_t{doip_rx_message.GetPayloadLength()};
+  is_fragmented_diagnostic_message_ = false;
   // Process the Doip Generic header check
   if (ProcessDoIPHeader(doip_rx_message, nack_code)) {
+    // remaining bytes of large diagnostic messages follow as fragments
+    is_fragmented_diagnostic_message_ = (doip_rx_message.GetPayloadType() == kDoipDiagMessage) &&
+                                        (received_size < fragmented_frame_size_);
     ProcessDoIPPayload(doip_rx_message);
   } else {
-    // send NACK or ignore
-    (void) nack_code;
+    SendDoIPGenericHeaderNack(nack_code);
   }
 }
 
@@ -113,6 +180,11 @@ auto DoipTcpChannelHandler::IsRoutingActivated() noexcept -> bool {
   return routing_activation_handler_.IsRoutingActivated();
 }
 
+void DoipTcpChannelHandler::SetMaxDiagnosticPayloadLength(
+    std::uint32_t const max_payload_length) noexcept {
+  max_diagnostic_payload_length_ = max_payload_length;
+}
+
 auto DoipTcpChannelHandler::ProcessDoIPHeader(DoipMessage &doip_rx_message,
                                               std::uint8_t &nack_code) noexcept -> bool {
   bool ret_val = false;
@@ -128,26 +200,24 @@ auto DoipTcpChannelHandler::ProcessDoIPHeader(DoipMessage &doip_rx_message,
         (doip_rx_message.GetPayloadType() == kDoipDiagMessagePosAck) ||
         (doip_rx_message.GetPayloadType() == kDoipDiagMessageNegAck) ||
         (doip_rx_message.GetPayloadType() == kDoipDiagMessage) ||
-        (doip_rx_message.GetPayloadType() == kDoip_AliveCheck_ReqType)) {
+        (doip_rx_message.GetPayloadType() == kDoip_AliveCheck_ReqType) ||
+        (doip_rx_message.GetPayloadType() == kDoip_GenericHeadr_NackType)) {
+      // diagnostic messages are limited by the reception buffer of the conversations instead
+      std::uint32_t const max_payload_length{
+          (doip_rx_message.GetPayloadType() == kDoipDiagMessage) ? max_diagnostic_payload_length_.load()
+                                                                 : kTcpChannelLength};
       /* Req-[AUTOSAR_SWS_DiagnosticOverIP][SWS_DoIP_00017] */
-      if (doip_rx_message.GetPayloadLength() <= kDoip_Protocol_MaxPayload) {
-        /* Req-[AUTOSAR_SWS_DiagnosticOverIP][SWS_DoIP_00018] */
-        if (doip_rx_message.GetPayloadLength() <= kTcpChannelLength) {
-          /* Req-[AUTOSAR_SWS_DiagnosticOverIP][SWS_DoIP_00019] */
-          if (ProcessDoIPPayloadLength(doip_rx_message.GetPayloadLength(),
-                                       doip_rx_message.GetPayloadType())) {
-            ret_val = true;
-          } else {
-            // Send NACK code 0x04, close the socket
-            nack_code = kDoip_GenericHeader_InvalidPayloadLen;
-            // socket closure ??
-          }
+      if (doip_rx_message.GetPayloadLength() <= max_payload_length) {
+        /* Req-[AUTOSAR_SWS_DiagnosticOverIP][SWS_DoIP_00019] */
+        if (ProcessDoIPPayloadLength(doip_rx_message.GetPayloadLength(),
+                                     doip_rx_message.GetPayloadType())) {
+          ret_val = true;
         } else {
-          // Send NACK code 0x03, discard message
-          nack_code = kDoip_GenericHeader_OutOfMemory;
+          // Send NACK code 0x04, close the socket
+          nack_code = kDoip_GenericHeader_InvalidPayloadLen;
         }
       } else {
-        // Send NACK code 0x02, discard message
+        // Send NACK code 0x02, payload already skipped by socket, discard message
         nack_code = kDoip_GenericHeader_MessageTooLarge;
       }
     } else {  // Send NACK code 0x01, discard message
@@ -155,7 +225,6 @@ auto DoipTcpChannelHandler::ProcessDoIPHeader(DoipMessage &doip_rx_message,
     }
   } else {  // Send NACK code 0x00, close the socket
     nack_code = kDoip_GenericHeader_IncorrectPattern;
-    // socket closure
   }
   return ret_val;
 }
@@ -179,7 +248,11 @@ auto DoipTcpChannelHandler::ProcessDoIPPayloadLength(std::uint32_t payload_lengt
       break;
     }
     case kDoip_AliveCheck_ReqType: {
-      if (payload_length <= kDoipRoutingActivationResMaxLen) ret_val = true;
+      if (payload_length == kDoipAliveCheckReqLen) ret_val = true;
+      break;
+    }
+    case kDoip_GenericHeadr_NackType: {
+      if (payload_length == kDoipGenericHeaderNackLen) ret_val = true;
       break;
     }
     default:
@@ -205,11 +278,65 @@ void DoipTcpChannelHandler::ProcessDoIPPayload(DoipMessage &doip_payload) noexce
       // Process positive or negative diag ack message
       diagnostic_message_handler_.ProcessDoIPDiagnosticAckMessageResponse(doip_payload);
       break;
+    case kDoip_AliveCheck_ReqType:
+      // Answer alive check request, otherwise the socket is closed by remote
+      alive_check_handler_.ProcessDoIPAliveCheckRequest(doip_payload);
+      break;
+    case kDoip_GenericHeadr_NackType:
+      // Remote rejected a message sent, never answered with another negative acknowledgement
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, __func__, [&doip_payload](std::stringstream &msg) {
+            msg << "Generic header negative acknowledgement received with code: " << std::hex
+                << static_cast<int>(doip_payload.GetPayload()[0u]);
+          });
+      break;
     default:
       /* do nothing */
       break;
   }
 }
+
+void DoipTcpChannelHandler::ProcessDoIPPayloadFragment(TcpMessage const &tcp_rx_message) noexcept {
+  // fragments of rejected messages are dropped
+  if (is_fragmented_diagnostic_message_) {
+    bool const last_fragment{(tcp_rx_message.GetFrameOffset() +
+                              tcp_rx_message.GetPayload().size()) >= fragmented_frame_size_};
+    std::lock_guard<std::mutex> const lck(channel_handler_lock);
+    diagnostic_message_handler_.ProcessDoIPDiagnosticMessageFragment(tcp_rx_message.GetPayload(),
+                                                                     last_fragment);
+  }
+}
+
+void DoipTcpChannelHandler::SendDoIPGenericHeaderNack(std::uint8_t nack_code) noexcept {
+  GenericHeaderNack const generic_header_nack{CreateGenericHeaderNack(nack_code)};
+  std::array<boost_support::message::tcp::TcpMessageBufferView, 1u> const nack_buffers{
+      boost_support::message::tcp::TcpMessageBufferView{generic_header_nack}};
+  if (!tcp_socket_handler_.Transmit(
+          boost_support::message::tcp::TcpMessageBufferViews{nack_buffers})) {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
+          msg << "Generic header negative acknowledgement transmission failed";
+        });
+  }
+  /* Req-[ISO 13400-2] Socket is closed on incorrect pattern or invalid payload length, else message discarded */
+  if ((nack_code == kDoip_GenericHeader_IncorrectPattern) ||
+      (nack_code == kDoip_GenericHeader_InvalidPayloadLen)) {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, __func__, [nack_code](std::stringstream &msg) {
+          msg << "Generic header negative acknowledgement sent with code: " << std::hex
+              << static_cast<int>(nack_code) << ", closing connection";
+        });
+    // connection loss is reported by the socket once reading fails
+    tcp_socket_handler_.AbortConnection();
+  } else {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+        FILE_NAME, __LINE__, __func__, [nack_code](std::stringstream &msg) {
+          msg << "Generic header negative acknowledgement sent with code: " << std::hex
+              << static_cast<int>(nack_code) << ", message discarded";
+        });
+  }
+}
+
 }  // namespace tcp_channel
 }  // namespace channel
 }  // namespace doip_client
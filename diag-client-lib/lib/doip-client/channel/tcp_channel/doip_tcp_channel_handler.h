@@ -8,8 +8,10 @@
 #ifndef DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_TCP_CHANNEL_DOIP_TCP_CHANNEL_HANDLER_H_
 #define DIAG_CLIENT_LIB_LIB_DOIP_CLIENT_CHANNEL_TCP_CHANNEL_DOIP_TCP_CHANNEL_HANDLER_H_
 
+#include <atomic>
 #include <mutex>
 
+#include "channel/tcp_channel/doip_alive_check_handler.h"
 #include "channel/tcp_channel/doip_diagnostic_message_handler.h"
 #include "channel/tcp_channel/doip_routing_activation_handler.h"
 #include "common/doip_message.h"
@@ -34,6 +36,11 @@ class DoipTcpChannelHandler final {
    */
   using TcpMessagePtr = sockets::TcpSocketHandler::MessagePtr;
 
+  /**
+   * @brief  Type alias for Tcp message
+   */
+  using TcpMessage = sockets::TcpSocketHandler::Message;
+
   /**
    * @brief         Constructs an instance of DoipTcpChannelHandler
    * @param[in]     tcp_socket_handler
@@ -81,6 +88,17 @@ class DoipTcpChannelHandler final {
   auto SendDiagnosticRequest(uds_transport::UdsMessageConstPtr diagnostic_request) noexcept
       -> uds_transport::UdsTransportProtocolMgr::TransmissionResult;
 
+  /**
+   * @brief         Function to send diagnostic request without waiting for its acknowledgement
+   * @param[in]     diagnostic_request
+   *                The diagnostic request
+   * @param[in]     completion_handler
+   *                The handler invoked with the transmission result
+   */
+  void SendDiagnosticRequestAsync(
+      uds_transport::UdsMessageConstPtr diagnostic_request,
+      uds_transport::Connection::TransmissionCompletionHandler completion_handler) noexcept;
+
   /**
    * @brief         Function to process the received message
    * @param[in]     tcp_rx_message
@@ -94,6 +112,14 @@ class DoipTcpChannelHandler final {
    */
   auto IsRoutingActivated() noexcept -> bool;
 
+  /**
+   * @brief         Function to set the maximum payload length of diagnostic messages accepted
+   * @details       May be changed while receiving, other payload types are limited to the channel length
+   * @param[in]     max_payload_length
+   *                The maximum payload length including source and target address
+   */
+  void SetMaxDiagnosticPayloadLength(std::uint32_t max_payload_length) noexcept;
+
  private:
   /**
    * @brief         Function to process doip header in received response
@@ -121,6 +147,26 @@ class DoipTcpChannelHandler final {
    */
   void ProcessDoIPPayload(DoipMessage &doip_payload) noexcept;
 
+  /**
+   * @brief         Function to process the next fragment of a large doip message
+   * @param[in]     tcp_rx_message
+   *                The fragment received after the one holding the header
+   */
+  void ProcessDoIPPayloadFragment(TcpMessage const &tcp_rx_message) noexcept;
+
+  /**
+   * @brief         Function to send generic doip header negative acknowledgement
+   * @details       The connection is aborted for nack codes requiring socket closure
+   * @param[in]     nack_code
+   *                The negative ack code
+   */
+  void SendDoIPGenericHeaderNack(std::uint8_t nack_code) noexcept;
+
+  /**
+   * @brief         Store the reference to socket handler
+   */
+  sockets::TcpSocketHandler &tcp_socket_handler_;
+
   /**
    * @brief         Handler to process routing activation req/ resp
    */
@@ -131,6 +177,26 @@ class DoipTcpChannelHandler final {
    */
   DiagnosticMessageHandler diagnostic_message_handler_;
 
+  /**
+   * @brief         Handler to answer alive check req
+   */
+  AliveCheckHandler alive_check_handler_;
+
+  /**
+   * @brief         Store the maximum payload length of diagnostic messages accepted
+   */
+  std::atomic<std::uint32_t> max_diagnostic_payload_length_;
+
+  /**
+   * @brief         Store the size of the frame being received in fragments
+   */
+  std::size_t fragmented_frame_size_;
+
+  /**
+   * @brief         Store whether the fragments are handed to the diagnostic message handler
+   */
+  bool is_fragmented_diagnostic_message_;
+
   /**
    * @brief         Mutex to protect critical section
    */
@@ -49,6 +49,12 @@ uds_transport::UdsTransportProtocolMgr::TransmissionResult DoipUdpChannel::Trans
   return udp_channel_handler_.SendVehicleIdentificationRequest(std::move(message));
 }
 
+void DoipUdpChannel::CancelTransmit() { udp_channel_handler_.CancelVehicleIdentificationRequest(); }
+
+void DoipUdpChannel::ResetCancelTransmit() {
+  udp_channel_handler_.ResetCancelVehicleIdentificationRequest();
+}
+
 std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
 DoipUdpChannel::IndicateMessage(uds_transport::UdsMessage::Address source_addr,
                                 uds_transport::UdsMessage::Address target_addr,
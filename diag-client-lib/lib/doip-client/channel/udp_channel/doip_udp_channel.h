@@ -128,6 +128,16 @@ class DoipUdpChannel final {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult Transmit(
       uds_transport::UdsMessageConstPtr message);
 
+  /**
+   * @brief       Function to stop waiting for further vehicle identification responses
+   */
+  void CancelTransmit();
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any transmission
+   */
+  void ResetCancelTransmit();
+
  private:
   /**
    * @brief  Store the udp socket handler for broadcast messages
@@ -50,10 +50,23 @@ auto DoipUdpChannelHandler::SendVehicleIdentificationRequest(
     case 1U:
       // 1U -> Power Mode Req
       break;
+    case 2U:
+      // 2U -> Vehicle Identification Sweep over unicast target addresses
+      ret_val = vehicle_identification_handler_.HandleVehicleIdentificationSweep(
+          std::move(vehicle_identification_request));
+      break;
   }
   return ret_val;
 }
 
+void DoipUdpChannelHandler::CancelVehicleIdentificationRequest() noexcept {
+  vehicle_identification_handler_.CancelVehicleIdentificationRequest();
+}
+
+void DoipUdpChannelHandler::ResetCancelVehicleIdentificationRequest() noexcept {
+  vehicle_identification_handler_.ResetCancelVehicleIdentificationRequest();
+}
+
 auto DoipUdpChannelHandler::HandleMessageUnicast(UdpMessagePtr udp_rx_message) noexcept -> void {
   std::uint8_t nack_code{};
   DoipMessage doip_rx_message{DoipMessage::MessageType::kUdp, udp_rx_message->GetHostIpAddress(),
@@ -128,7 +141,11 @@ auto DoipUdpChannelHandler::ProcessDoIPPayloadLength(std::uint32_t payload_len,
   bool ret_val{false};
   switch (payload_type) {
     case kDoip_VehicleAnnouncement_ResType: {
-      if (payload_len <= kDoip_VehicleAnnouncement_ResMaxLen) ret_val = true;
+      // VIN/GID sync status is optional
+      if ((payload_len >= kDoip_VehicleAnnouncement_ResMinLen) &&
+          (payload_len <= kDoip_VehicleAnnouncement_ResMaxLen)) {
+        ret_val = true;
+      }
       break;
     }
     default:
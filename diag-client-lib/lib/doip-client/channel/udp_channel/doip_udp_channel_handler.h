@@ -58,6 +58,16 @@ class DoipUdpChannelHandler final {
       uds_transport::UdsMessageConstPtr vehicle_identification_request) noexcept
       -> uds_transport::UdsTransportProtocolMgr::TransmissionResult;
 
+  /**
+   * @brief         Function to stop waiting for further vehicle identification responses
+   */
+  void CancelVehicleIdentificationRequest() noexcept;
+
+  /**
+   * @brief         Function to withdraw a cancellation not consumed by any vehicle identification request
+   */
+  void ResetCancelVehicleIdentificationRequest() noexcept;
+
   /**
    * @brief         Function to process the received unicast udp message
    * @param[in]     udp_rx_message
@@ -8,8 +8,11 @@
 
 #include "channel/udp_channel/doip_vehicle_discovery_handler.h"
 
+#include <algorithm>
+
+#include "channel/udp_channel/doip_udp_channel.h"
 #include "common/logger.h"
-#include "utility/state.h"
+#include "utility/state_machine.h"
 
 namespace doip_client {
 namespace channel {
@@ -25,74 +28,19 @@ enum class VehicleDiscoveryState : std::uint8_t {
 };
 
 /**
- * @brief       Class implements idle state
+ * @brief  Allowed vehicle discovery state transitions
  */
-class kIdle final : public utility::state::State<VehicleDiscoveryState> {
- public:
-  /**
-   * @brief         Constructs an instance of kIdle
-   * @param[in]     state
-   *                The kIdle state
-   */
-  explicit kIdle(VehicleDiscoveryState state) : State<VehicleDiscoveryState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
+constexpr std::pair<VehicleDiscoveryState, VehicleDiscoveryState> kVehicleDiscoveryTransitions[]{
+    {VehicleDiscoveryState::kIdle, VehicleDiscoveryState::kWaitForVehicleAnnouncement},
+    {VehicleDiscoveryState::kWaitForVehicleAnnouncement, VehicleDiscoveryState::kDoIPCtrlTimeout},
+    {VehicleDiscoveryState::kWaitForVehicleAnnouncement, VehicleDiscoveryState::kIdle},
+    {VehicleDiscoveryState::kDoIPCtrlTimeout, VehicleDiscoveryState::kIdle}};
 
 /**
- * @brief       Class implements idle state
+ * @brief  Vehicle discovery transition table
  */
-class kWaitForVehicleAnnouncement final : public utility::state::State<VehicleDiscoveryState> {
- public:
-  /**
-   * @brief         Constructs an instance of kWaitForVehicleAnnouncement
-   * @param[in]     state
-   *                The kWaitForVehicleAnnouncement state
-   */
-  explicit kWaitForVehicleAnnouncement(VehicleDiscoveryState state)
-      : State<VehicleDiscoveryState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
-
-/**
- * @brief       Class implements idle state
- */
-class kDoIPCtrlTimeout final : public utility::state::State<VehicleDiscoveryState> {
- public:
-  /**
-   * @brief         Constructs an instance of kDoIPCtrlTimeout
-   * @param[in]     state
-   *                The kDoIPCtrlTimeout state
-   */
-  explicit kDoIPCtrlTimeout(VehicleDiscoveryState state) : State<VehicleDiscoveryState>(state) {}
-
-  /**
-   * @brief         Function to start the current state
-   */
-  void Start() override {}
-
-  /**
-   * @brief         Function to stop the current state
-   */
-  void Stop() override {}
-};
+constexpr utility::state::TransitionTable<VehicleDiscoveryState, 3u>
+    kVehicleDiscoveryTransitionTable{kVehicleDiscoveryTransitions};
 
 }  // namespace
 
@@ -102,39 +50,29 @@ class kDoIPCtrlTimeout final : public utility::state::State<VehicleDiscoveryStat
 class VehicleDiscoveryHandler::VehicleDiscoveryHandlerImpl final {
  public:
   /**
-   * @brief  Type alias for state context
+   * @brief  Type alias for state machine
    */
-  using VehicleDiscoveryStateContext = utility::state::StateContext<VehicleDiscoveryState>;
+  using VehicleDiscoveryStateMachine =
+      utility::state::StateMachine<VehicleDiscoveryState, kVehicleDiscoveryTransitionTable>;
 
   /**
    * @brief         Constructs an instance of VehicleDiscoveryHandlerImpl
    * @param[in]     udp_socket_handler
    *                The reference to socket handler
+   * @param[in]     channel
+   *                The reference to doip udp channel
    */
-  explicit VehicleDiscoveryHandlerImpl(sockets::UdpSocketHandler &udp_socket_handler)
+  VehicleDiscoveryHandlerImpl(sockets::UdpSocketHandler &udp_socket_handler,
+                              DoipUdpChannel &channel)
       : udp_socket_handler_{udp_socket_handler},
-        state_context_{} {
-    // create and add state for vehicle discovery
-    // kIdle
-    state_context_.AddState(VehicleDiscoveryState::kIdle,
-                            std::make_unique<kIdle>(VehicleDiscoveryState::kIdle));
-    // kWaitForVehicleAnnouncement
-    state_context_.AddState(VehicleDiscoveryState::kWaitForVehicleAnnouncement,
-                            std::make_unique<kWaitForVehicleAnnouncement>(
-                                VehicleDiscoveryState::kWaitForVehicleAnnouncement));
-    // kDoIPCtrlTimeout
-    state_context_.AddState(
-        VehicleDiscoveryState::kDoIPCtrlTimeout,
-        std::make_unique<kDoIPCtrlTimeout>(VehicleDiscoveryState::kDoIPCtrlTimeout));
-    // Transit to wait for vehicle announcement
-    state_context_.TransitionTo(VehicleDiscoveryState::kWaitForVehicleAnnouncement);
-  }
+        channel_{channel},
+        state_machine_{VehicleDiscoveryState::kWaitForVehicleAnnouncement} {}
 
   /**
-   * @brief       Function to get the Vehicle Discovery State context
-   * @return      The reference to state context
+   * @brief       Function to get the Vehicle Discovery State machine
+   * @return      The reference to state machine
    */
-  auto GetStateContext() noexcept -> VehicleDiscoveryStateContext & { return state_context_; }
+  auto GetStateMachine() noexcept -> VehicleDiscoveryStateMachine & { return state_machine_; }
 
   /**
    * @brief       Function to get the socket handler
@@ -142,6 +80,12 @@ class VehicleDiscoveryHandler::VehicleDiscoveryHandlerImpl final {
    */
   auto GetSocketHandler() noexcept -> sockets::UdpSocketHandler & { return udp_socket_handler_; }
 
+  /**
+   * @brief       Function to get the doip channel
+   * @return      The reference to channel
+   */
+  auto GetDoipChannel() noexcept -> DoipUdpChannel & { return channel_; }
+
  private:
   /**
    * @brief  The reference to socket handler
@@ -149,25 +93,48 @@ class VehicleDiscoveryHandler::VehicleDiscoveryHandlerImpl final {
   sockets::UdpSocketHandler &udp_socket_handler_;
 
   /**
-   * @brief  Stores the vehicle discovery states
+   * @brief  The reference to doip channel
+   */
+  DoipUdpChannel &channel_;
+
+  /**
+   * @brief  Stores the vehicle discovery state
    */
-  VehicleDiscoveryStateContext state_context_;
+  VehicleDiscoveryStateMachine state_machine_;
 };
 
 udp_channel::VehicleDiscoveryHandler::VehicleDiscoveryHandler(
-    sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &)
-    : handler_impl_{std::make_unique<VehicleDiscoveryHandlerImpl>(udp_socket_handler)} {}
+    sockets::UdpSocketHandler &udp_socket_handler, DoipUdpChannel &channel)
+    : handler_impl_{std::make_unique<VehicleDiscoveryHandlerImpl>(udp_socket_handler, channel)} {}
 
 VehicleDiscoveryHandler::~VehicleDiscoveryHandler() = default;
 
-void VehicleDiscoveryHandler::ProcessVehicleAnnouncementResponse(DoipMessage &) noexcept {
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
+void VehicleDiscoveryHandler::ProcessVehicleAnnouncementResponse(
+    DoipMessage &doip_payload) noexcept {
+  if (handler_impl_->GetStateMachine().GetState() ==
       VehicleDiscoveryState::kWaitForVehicleAnnouncement) {
-    // Deserialize and Add to task executor
-    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
-        FILE_NAME, __LINE__, __func__, [](std::stringstream &msg) {
-          msg << "Processing of vehicle announcement is not implemented";
-        });
+    // Announcements are indicated as functional messages to distinguish them from identification responses
+    std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult,
+              uds_transport::UdsMessagePtr>
+        ret_val{handler_impl_->GetDoipChannel().IndicateMessage(
+            static_cast<uds_transport::UdsMessage::Address>(0U),
+            static_cast<uds_transport::UdsMessage::Address>(0U),
+            uds_transport::UdsMessage::TargetAddressType::kFunctional, 0U,
+            doip_payload.GetPayload().size(), 0U, "DoIPUdp", doip_payload.GetPayload())};
+    if ((ret_val.first ==
+         uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationOk) &&
+        (ret_val.second != nullptr)) {
+      // Add meta info about ip address
+      uds_transport::UdsMessage::MetaInfoMap meta_info_map{
+          {"kRemoteIpAddress", std::string{doip_payload.GetHostIpAddress()}}};
+      ret_val.second->AddMetaInfo(
+          std::make_shared<uds_transport::UdsMessage::MetaInfoMap>(meta_info_map));
+      // copy to application buffer
+      static_cast<void>(std::copy(doip_payload.GetPayload().begin(),
+                                  doip_payload.GetPayload().end(),
+                                  ret_val.second->GetPayload().begin()));
+      handler_impl_->GetDoipChannel().HandleMessage(std::move(ret_val.second));
+    }
   } else {
     // ignore
   }
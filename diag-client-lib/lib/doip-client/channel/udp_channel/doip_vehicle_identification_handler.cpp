@@ -8,11 +8,21 @@
 
 #include "channel/udp_channel/doip_vehicle_identification_handler.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 #include "channel/udp_channel/doip_udp_channel.h"
 #include "common/common_doip_types.h"
 #include "common/logger.h"
-#include "utility/state.h"
-#include "utility/sync_timer.h"
+#include "utility/state_machine.h"
+#include "utility/timer_service.h"
 
 namespace doip_client {
 namespace channel {
@@ -35,101 +45,23 @@ enum class VehicleIdentificationState : std::uint8_t {
 };
 
 /**
-* @brief       Class implements idle state
+* @brief  Allowed vehicle identification state transitions
 */
-class kIdle final : public utility::state::State<VehicleIdentificationState> {
- public:
-  /**
-  * @brief         Constructs an instance of kIdle
-  * @param[in]     state
-  *                The kIdle state
-  */
-  explicit kIdle(VehicleIdentificationState state) : State<VehicleIdentificationState>(state) {}
-
-  /**
-  * @brief         Function to start the current state
-  */
-  void Start() override {}
-
-  /**
-  * @brief         Function to stop the current state
-  */
-  void Stop() override {}
-};
+constexpr std::pair<VehicleIdentificationState, VehicleIdentificationState>
+    kVehicleIdentificationTransitions[]{
+        {VehicleIdentificationState::kIdle,
+         VehicleIdentificationState::kWaitForVehicleIdentificationRes},
+        {VehicleIdentificationState::kWaitForVehicleIdentificationRes,
+         VehicleIdentificationState::kDoIPCtrlTimeout},
+        {VehicleIdentificationState::kWaitForVehicleIdentificationRes,
+         VehicleIdentificationState::kIdle},
+        {VehicleIdentificationState::kDoIPCtrlTimeout, VehicleIdentificationState::kIdle}};
 
 /**
-* @brief       Class implements sending of vehicle identification request state
+* @brief  Vehicle identification transition table
 */
-class kSendVehicleIdentificationReq final
-    : public utility::state::State<VehicleIdentificationState> {
- public:
-  /**
-  * @brief         Constructs an instance of kSendVehicleIdentificationReq
-  * @param[in]     state
-  *                The kSendVehicleIdentificationReq state
-  */
-  explicit kSendVehicleIdentificationReq(VehicleIdentificationState state)
-      : State<VehicleIdentificationState>(state) {}
-
-  /**
-  * @brief         Function to start the current state
-  */
-  void Start() override {}
-
-  /**
-  * @brief         Function to stop the current state
-  */
-  void Stop() override {}
-};
-
-/**
-* @brief       Class implements wait for vehicle identification response state
-*/
-class kWaitForVehicleIdentificationRes final
-    : public utility::state::State<VehicleIdentificationState> {
- public:
-  /**
-  * @brief         Constructs an instance of kWaitForVehicleIdentificationRes
-  * @param[in]     state
-  *                The kWaitForVehicleIdentificationRes state
-  */
-  explicit kWaitForVehicleIdentificationRes(VehicleIdentificationState state)
-      : State<VehicleIdentificationState>(state) {}
-
-  /**
-  * @brief         Function to start the current state
-  */
-  void Start() override {}
-
-  /**
-  * @brief         Function to stop the current state
-  */
-  void Stop() override {}
-};
-
-/**
-* @brief       Class implements Ctrl timeout state
-*/
-class kDoIPCtrlTimeout final : public utility::state::State<VehicleIdentificationState> {
- public:
-  /**
-  * @brief         Constructs an instance of kDoIPCtrlTimeout
-  * @param[in]     state
-  *                The kDoIPCtrlTimeout state
-  */
-  explicit kDoIPCtrlTimeout(VehicleIdentificationState state)
-      : State<VehicleIdentificationState>(state) {}
-
-  /**
-  * @brief         Function to start the current state
-  */
-  void Start() override {}
-
-  /**
-  * @brief         Function to stop the current state
-  */
-  void Stop() override {}
-};
+constexpr utility::state::TransitionTable<VehicleIdentificationState, 4u>
+    kVehicleIdentificationTransitionTable{kVehicleIdentificationTransitions};
 
 /**
  * @brief            Function to create doip generic header
@@ -181,6 +113,75 @@ auto GetVehicleIdentificationPayloadType(std::uint8_t preselection_mode) noexcep
   return VehiclePayloadType{vehicle_identification_type, vehicle_identification_length};
 }
 
+/**
+ * @brief  Settings and target addresses of a vehicle identification sweep
+ */
+struct VehicleIdentificationSweep {
+  /**
+   * @brief  Minimum time between two requests, zero if not rate limited
+   */
+  std::chrono::nanoseconds send_interval{};
+
+  /**
+   * @brief  Maximum number of targets neither answered nor timed out
+   */
+  std::size_t in_flight_window{};
+
+  /**
+   * @brief  Time after which a target not answering is given up
+   */
+  std::chrono::milliseconds response_timeout{};
+
+  /**
+   * @brief  Ip addresses of the targets in the order requested
+   */
+  std::vector<std::string> target_addresses{};
+};
+
+/**
+ * @brief         Function to deserialize the vehicle identification sweep request
+ * @details       The payload contains the handler type, requests per second (4 bytes), in-flight window (2 bytes),
+ *                response timeout in ms (4 bytes) followed by the target addresses each prefixed with its length
+ * @param[in]     payload
+ *                The payload of sweep request
+ * @return        The sweep on success, empty if the payload is malformed
+ */
+auto DeserializeVehicleIdentificationSweep(uds_transport::ByteVector const &payload) noexcept
+    -> std::optional<VehicleIdentificationSweep> {
+  constexpr std::size_t kSweepHeaderSize{11U};
+  std::optional<VehicleIdentificationSweep> sweep{};
+  if (payload.size() >= kSweepHeaderSize) {
+    std::uint32_t const requests_per_second{
+        static_cast<std::uint32_t>((payload[1U] << 24U) | (payload[2U] << 16U) | (payload[3U] << 8U) |
+                                   payload[4U])};
+    std::uint16_t const in_flight_window{static_cast<std::uint16_t>((payload[5U] << 8U) | payload[6U])};
+    std::uint32_t const response_timeout_ms{
+        static_cast<std::uint32_t>((payload[7U] << 24U) | (payload[8U] << 16U) | (payload[9U] << 8U) |
+                                   payload[10U])};
+    sweep.emplace();
+    sweep->send_interval = (requests_per_second != 0U)
+                               ? std::chrono::nanoseconds{std::chrono::seconds{1}} / requests_per_second
+                               : std::chrono::nanoseconds{0};
+    sweep->in_flight_window = in_flight_window;
+    sweep->response_timeout = std::chrono::milliseconds{response_timeout_ms};
+    std::size_t index{kSweepHeaderSize};
+    while ((index < payload.size()) && sweep.has_value()) {
+      std::size_t const address_length{payload[index++]};
+      if ((address_length != 0U) && (payload.size() - index >= address_length)) {
+        sweep->target_addresses.emplace_back(payload.begin() + static_cast<std::ptrdiff_t>(index),
+                                             payload.begin() + static_cast<std::ptrdiff_t>(index + address_length));
+        index += address_length;
+      } else {
+        sweep.reset();
+      }
+    }
+    if (sweep.has_value() && ((sweep->in_flight_window == 0U) || sweep->target_addresses.empty())) {
+      sweep.reset();
+    }
+  }
+  return sweep;
+}
+
 }  // namespace
 
 /**
@@ -189,15 +190,11 @@ auto GetVehicleIdentificationPayloadType(std::uint8_t preselection_mode) noexcep
 class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
  public:
   /**
-   * @brief  Type alias for state context
-   */
-  using VehicleIdentificationStateContext =
-      utility::state::StateContext<VehicleIdentificationState>;
-
-  /**
-   * @brief  Type alias for Sync timer
+   * @brief  Type alias for state machine
    */
-  using SyncTimer = utility::sync_timer::SyncTimer<std::chrono::steady_clock>;
+  using VehicleIdentificationStateMachine =
+      utility::state::StateMachine<VehicleIdentificationState,
+                                   kVehicleIdentificationTransitionTable>;
 
   /**
    * @brief         Constructs an instance of VehicleDiscoveryHandlerImpl
@@ -208,32 +205,18 @@ class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
                                             DoipUdpChannel &channel)
       : udp_socket_handler_{udp_socket_handler},
         channel_{channel},
-        state_context_{} {
-    // create and add state for vehicle identification
-    // kIdle
-    state_context_.AddState(VehicleIdentificationState::kIdle,
-                            std::make_unique<kIdle>(VehicleIdentificationState::kIdle));
-    // kSendVehicleIdentificationReq
-    state_context_.AddState(VehicleIdentificationState::kSendVehicleIdentificationReq,
-                            std::make_unique<kSendVehicleIdentificationReq>(
-                                VehicleIdentificationState::kSendVehicleIdentificationReq));
-    // kWaitForVehicleIdentificationRes
-    state_context_.AddState(VehicleIdentificationState::kWaitForVehicleIdentificationRes,
-                            std::make_unique<kWaitForVehicleIdentificationRes>(
-                                VehicleIdentificationState::kWaitForVehicleIdentificationRes));
-    // kDoIPCtrlTimeout
-    state_context_.AddState(
-        VehicleIdentificationState::kDoIPCtrlTimeout,
-        std::make_unique<kDoIPCtrlTimeout>(VehicleIdentificationState::kDoIPCtrlTimeout));
-    // Transit to idle state
-    state_context_.TransitionTo(VehicleIdentificationState::kIdle);
-  }
+        state_machine_{VehicleIdentificationState::kIdle},
+        timeout_lock_{},
+        timeout_cond_var_{},
+        is_cancel_requested_{false},
+        sweep_in_flight_targets_{},
+        sweep_deadlines_{} {}
 
   /**
-   * @brief       Function to get the Vehicle Identification State context
-   * @return      The reference to state context
+   * @brief       Function to get the Vehicle Identification State machine
+   * @return      The reference to state machine
    */
-  auto GetStateContext() noexcept -> VehicleIdentificationStateContext & { return state_context_; }
+  auto GetStateMachine() noexcept -> VehicleIdentificationStateMachine & { return state_machine_; }
 
   /**
    * @brief       Function to get the socket handler
@@ -248,10 +231,143 @@ class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
   auto GetDoipChannel() noexcept -> DoipUdpChannel & { return channel_; }
 
   /**
-   * @brief       Function to get the sync timer
-   * @return      The reference to sync timer
+   * @brief       Function to wait until the vehicle identification responses are collected
+   * @details     The timeout is monitored by the timer service, which moves the handler to kDoIPCtrlTimeout on expiry.
+   *              The wait ends earlier once the collection is stopped by the conversation, also if stopped before
+   *              the wait started
+   * @param[in]   timeout
+   *              The time to collect responses
+   */
+  void WaitForDoIPCtrlTimeout(std::chrono::milliseconds timeout) noexcept {
+    utility::timer::TimerService::TimerId const timer_id{
+        utility::timer::TimerService::GetTimerService().Arm(timeout, [this]() {
+          {
+            std::lock_guard<std::mutex> const lck{timeout_lock_};
+            static_cast<void>(state_machine_.TransitionTo(
+                VehicleIdentificationState::kWaitForVehicleIdentificationRes,
+                VehicleIdentificationState::kDoIPCtrlTimeout));
+          }
+          timeout_cond_var_.notify_all();
+        })};
+    {
+      std::unique_lock<std::mutex> lck{timeout_lock_};
+      timeout_cond_var_.wait(lck, [this]() {
+        return is_cancel_requested_ ||
+               (state_machine_.GetState() == VehicleIdentificationState::kDoIPCtrlTimeout);
+      });
+    }
+    static_cast<void>(utility::timer::TimerService::GetTimerService().Cancel(timer_id));
+  }
+
+  /**
+   * @brief       Function to stop the wait for the remaining vehicle identification responses
+   * @details     Moves the handler to kDoIPCtrlTimeout as if DoIPCtrl expired. The stop is kept until reset, so
+   *              that a request not yet waiting returns as soon as it starts to wait
    */
-  auto GetSyncTimer() noexcept -> SyncTimer & { return sync_timer_; }
+  void StopWaitForDoIPCtrlTimeout() noexcept {
+    bool is_stopped{false};
+    {
+      std::lock_guard<std::mutex> const lck{timeout_lock_};
+      is_cancel_requested_ = true;
+      is_stopped = state_machine_.TransitionTo(VehicleIdentificationState::kWaitForVehicleIdentificationRes,
+                                               VehicleIdentificationState::kDoIPCtrlTimeout);
+    }
+    if (is_stopped) { timeout_cond_var_.notify_all(); }
+  }
+
+  /**
+   * @brief       Function to withdraw a stop not consumed by any wait, called before starting a new request
+   */
+  void ResetStopWaitForDoIPCtrlTimeout() noexcept {
+    std::lock_guard<std::mutex> const lck{timeout_lock_};
+    is_cancel_requested_ = false;
+  }
+
+  /**
+   * @brief       Function to request every target of the sweep and wait until each one answered or timed out
+   * @details     Requests are sent from the calling context while fewer targets than the in-flight window are
+   *              pending and the rate limit allows, answers received meanwhile free the window. The sweep ends earlier
+   *              once the collection is stopped by the conversation
+   * @param[in]   sweep
+   *              The settings and target addresses of sweep
+   * @return      True if any request was sent, otherwise False
+   */
+  auto SweepTargets(VehicleIdentificationSweep const &sweep) noexcept -> bool {
+    bool is_any_sent{false};
+    std::size_t next_target_index{0U};
+    std::chrono::steady_clock::time_point next_send_time{std::chrono::steady_clock::now()};
+    std::unique_lock<std::mutex> lck{timeout_lock_};
+    while (!is_cancel_requested_ &&
+           (state_machine_.GetState() == VehicleIdentificationState::kWaitForVehicleIdentificationRes)) {
+      std::chrono::steady_clock::time_point const now{std::chrono::steady_clock::now()};
+      // all targets share the same timeout, so the earliest sent is given up first
+      while (!sweep_deadlines_.empty() &&
+             ((sweep_deadlines_.front().second <= now) ||
+              (sweep_in_flight_targets_.count(sweep_deadlines_.front().first) == 0U))) {
+        static_cast<void>(sweep_in_flight_targets_.erase(sweep_deadlines_.front().first));
+        sweep_deadlines_.pop_front();
+      }
+      bool const is_target_left{next_target_index < sweep.target_addresses.size()};
+      bool const is_window_free{sweep_in_flight_targets_.size() < sweep.in_flight_window};
+      if (!is_target_left && sweep_in_flight_targets_.empty()) { break; }
+      if (is_target_left && is_window_free && (now >= next_send_time)) {
+        std::string const &target_address{sweep.target_addresses[next_target_index]};
+        next_target_index++;
+        // registered before sending as the answer may be received before the transmission returns
+        static_cast<void>(sweep_in_flight_targets_.emplace(target_address));
+        sweep_deadlines_.emplace_back(target_address, now + sweep.response_timeout);
+        next_send_time = std::max(next_send_time, now) + sweep.send_interval;
+        lck.unlock();
+        bool const is_sent{SendVehicleIdentificationRequest(target_address)};
+        lck.lock();
+        if (is_sent) {
+          is_any_sent = true;
+        } else {
+          static_cast<void>(sweep_in_flight_targets_.erase(target_address));
+        }
+      } else {
+        // wait for an answer, the earliest timeout or the next request allowed by the rate limit
+        std::chrono::steady_clock::time_point wake_up_time{
+            (is_target_left && is_window_free) ? next_send_time : sweep_deadlines_.front().second};
+        if (!sweep_deadlines_.empty()) {
+          wake_up_time = std::min(wake_up_time, sweep_deadlines_.front().second);
+        }
+        static_cast<void>(timeout_cond_var_.wait_until(lck, wake_up_time));
+      }
+    }
+    sweep_in_flight_targets_.clear();
+    sweep_deadlines_.clear();
+    return is_any_sent;
+  }
+
+  /**
+   * @brief       Function to mark a sweep target as answered, freeing its place in the in-flight window
+   * @param[in]   host_ip_address
+   *              The ip address the answer is received from
+   */
+  void MarkSweepTargetAnswered(std::string const &host_ip_address) noexcept {
+    bool is_answered{false};
+    {
+      std::lock_guard<std::mutex> const lck{timeout_lock_};
+      is_answered = (sweep_in_flight_targets_.erase(host_ip_address) != 0U);
+    }
+    if (is_answered) { timeout_cond_var_.notify_all(); }
+  }
+
+ private:
+  /**
+   * @brief       Function to send a vehicle identification request without preselection to a target
+   * @param[in]   target_address
+   *              The ip address of target
+   * @return      True if sent, otherwise False
+   */
+  auto SendVehicleIdentificationRequest(std::string const &target_address) noexcept -> bool {
+    UdpMessagePtr doip_vehicle_identification_req{std::make_unique<UdpMessage>(
+        target_address, kDoipPort,
+        CreateDoipGenericHeader(kDoip_VehicleIdentification_ReqType,
+                                kDoip_VehicleIdentification_ReqLen))};
+    return udp_socket_handler_.Transmit(std::move(doip_vehicle_identification_req)).HasValue();
+  }
 
  private:
   /**
@@ -265,14 +381,34 @@ class VehicleIdentificationHandler::VehicleIdentificationHandlerImpl final {
   DoipUdpChannel &channel_;
 
   /**
-   * @brief  Stores the vehicle identification states
+   * @brief  Stores the vehicle identification state
    */
-  VehicleIdentificationStateContext state_context_;
+  VehicleIdentificationStateMachine state_machine_;
 
   /**
-   * @brief  Store the synchronous timer
+   * @brief  Store the lock protecting the wait for timeout
    */
-  SyncTimer sync_timer_;
+  std::mutex timeout_lock_;
+
+  /**
+   * @brief  Store the conditional variable notified on timeout
+   */
+  std::condition_variable timeout_cond_var_;
+
+  /**
+   * @brief  Store whether the collection is stopped by the conversation, protected by timeout lock
+   */
+  bool is_cancel_requested_;
+
+  /**
+   * @brief  Store the sweep targets neither answered nor timed out
+   */
+  std::unordered_set<std::string> sweep_in_flight_targets_;
+
+  /**
+   * @brief  Store the sweep targets in the order requested along with the time they are given up
+   */
+  std::deque<std::pair<std::string, std::chrono::steady_clock::time_point>> sweep_deadlines_;
 };
 
 VehicleIdentificationHandler::VehicleIdentificationHandler(
@@ -287,30 +423,22 @@ auto VehicleIdentificationHandler::HandleVehicleIdentificationRequest(
     -> uds_transport::UdsTransportProtocolMgr::TransmissionResult {
   uds_transport::UdsTransportProtocolMgr::TransmissionResult ret_val{
       uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
-      VehicleIdentificationState::kIdle) {
-    // change state before sending if SendVehicleIdentificationRequest call takes more time to return and in the
-    // same time async reception starts
-    handler_impl_->GetStateContext().TransitionTo(
-        VehicleIdentificationState::kWaitForVehicleIdentificationRes);
+  // change state before sending if SendVehicleIdentificationRequest call takes more time to return and in the
+  // same time async reception starts
+  if (handler_impl_->GetStateMachine().TransitionTo(
+          VehicleIdentificationState::kIdle,
+          VehicleIdentificationState::kWaitForVehicleIdentificationRes)) {
     if (SendVehicleIdentificationRequest(std::move(vehicle_identification_request)) ==
         uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk) {
       ret_val = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
-      // Wait for 2 sec to collect all the vehicle identification response
-      handler_impl_->GetSyncTimer().WaitForTimeout(
-          [&]() {
-            handler_impl_->GetStateContext().TransitionTo(
-                VehicleIdentificationState::kDoIPCtrlTimeout);
-            // Todo: Send data to upper layer here
-          },
-          [&]() {
-            // no cancellation
-          },
-          std::chrono::milliseconds{kDoIPCtrl});
-      handler_impl_->GetStateContext().TransitionTo(VehicleIdentificationState::kIdle);
+      // Wait for 2 sec to collect all the vehicle identification response, unless cancelled earlier
+      handler_impl_->WaitForDoIPCtrlTimeout(std::chrono::milliseconds{kDoIPCtrl});
+      static_cast<void>(
+          handler_impl_->GetStateMachine().TransitionTo(VehicleIdentificationState::kIdle));
     } else {
       // failed, do nothing
-      handler_impl_->GetStateContext().TransitionTo(VehicleIdentificationState::kIdle);
+      static_cast<void>(
+          handler_impl_->GetStateMachine().TransitionTo(VehicleIdentificationState::kIdle));
       logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
           FILE_NAME, __LINE__, "", [](std::stringstream &msg) {
             msg << "Vehicle Identification request transmission Failed";
@@ -322,10 +450,48 @@ auto VehicleIdentificationHandler::HandleVehicleIdentificationRequest(
   return ret_val;
 }
 
+auto VehicleIdentificationHandler::HandleVehicleIdentificationSweep(
+    uds_transport::UdsMessageConstPtr vehicle_identification_sweep) noexcept
+    -> uds_transport::UdsTransportProtocolMgr::TransmissionResult {
+  uds_transport::UdsTransportProtocolMgr::TransmissionResult ret_val{
+      uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed};
+  std::optional<VehicleIdentificationSweep> const sweep{
+      DeserializeVehicleIdentificationSweep(vehicle_identification_sweep->GetPayload())};
+  if (!sweep.has_value()) {
+    logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+        FILE_NAME, __LINE__, "",
+        [](std::stringstream &msg) { msg << "Vehicle Identification sweep request is malformed"; });
+  } else if (handler_impl_->GetStateMachine().TransitionTo(
+                 VehicleIdentificationState::kIdle,
+                 VehicleIdentificationState::kWaitForVehicleIdentificationRes)) {
+    if (handler_impl_->SweepTargets(sweep.value())) {
+      ret_val = uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitOk;
+    } else {
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogError(
+          FILE_NAME, __LINE__, "",
+          [](std::stringstream &msg) { msg << "Vehicle Identification sweep transmission Failed"; });
+    }
+    static_cast<void>(handler_impl_->GetStateMachine().TransitionTo(VehicleIdentificationState::kIdle));
+  } else {
+    // not free, state already in idle state
+  }
+  return ret_val;
+}
+
+void VehicleIdentificationHandler::CancelVehicleIdentificationRequest() noexcept {
+  handler_impl_->StopWaitForDoIPCtrlTimeout();
+}
+
+void VehicleIdentificationHandler::ResetCancelVehicleIdentificationRequest() noexcept {
+  handler_impl_->ResetStopWaitForDoIPCtrlTimeout();
+}
+
 void VehicleIdentificationHandler::ProcessVehicleIdentificationResponse(
     DoipMessage &doip_payload) noexcept {
-  if (handler_impl_->GetStateContext().GetActiveState().GetState() ==
+  if (handler_impl_->GetStateMachine().GetState() ==
       VehicleIdentificationState::kWaitForVehicleIdentificationRes) {
+    // the answer of a sweep target frees its place in the in-flight window
+    handler_impl_->MarkSweepTargetAnswered(std::string{doip_payload.GetHostIpAddress()});
     // Deserialize data to indicate to upper layer
     std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult,
               uds_transport::UdsMessagePtr>
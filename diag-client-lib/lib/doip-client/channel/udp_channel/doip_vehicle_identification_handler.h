@@ -61,6 +61,31 @@ class VehicleIdentificationHandler final {
       uds_transport::UdsMessageConstPtr vehicle_identification_request) noexcept
       -> uds_transport::UdsTransportProtocolMgr::TransmissionResult;
 
+  /**
+   * @brief       Function to handle sending of unicast vehicle identification requests to a list of targets
+   * @details     Requests are sent within the rate limit while fewer targets than the in-flight window are pending.
+   *              Returns once every target answered or timed out, or the sweep is cancelled
+   * @param[in]   vehicle_identification_sweep
+   *              The sweep request containing rate limit, in-flight window, timeout and target addresses
+   * @return      Transmission result, ok if any request was sent
+   */
+  auto HandleVehicleIdentificationSweep(
+      uds_transport::UdsMessageConstPtr vehicle_identification_sweep) noexcept
+      -> uds_transport::UdsTransportProtocolMgr::TransmissionResult;
+
+  /**
+   * @brief       Function to stop collecting vehicle identification responses before DoIPCtrl expires
+   * @details     The pending HandleVehicleIdentificationRequest or HandleVehicleIdentificationSweep returns
+   *              immediately, later responses are ignored. If none is pending yet, the next one returns as soon as
+   *              it is sent, until the cancellation is reset
+   */
+  void CancelVehicleIdentificationRequest() noexcept;
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any request, called before a new request
+   */
+  void ResetCancelVehicleIdentificationRequest() noexcept;
+
   /**
    * @brief       Function to process received vehicle identification response
    * @param[in]   doip_payload
@@ -14,6 +14,8 @@ namespace doip_client {
 
 /* DoIP Port Number - Unsecured */
 constexpr std::uint16_t kDoipPort = 13400U;
+/* DoIP Port Number - Test equipment, receiving vehicle announcements */
+constexpr std::uint16_t kDoipTestEquipmentPort = 13401U;
 /* Udp Channel Length */
 constexpr std::uint32_t kUdpChannelLength = 41U;
 /* Tcp Channel Length */
@@ -42,6 +44,7 @@ constexpr std::uint16_t kDoip_InvalidPayload_Type = 0xFFFF;
 constexpr std::uint32_t kDoip_VehicleIdentification_ReqLen = 0;
 constexpr std::uint32_t kDoip_VehicleIdentificationEID_ReqLen = 6;
 constexpr std::uint32_t kDoip_VehicleIdentificationVIN_ReqLen = 17;
+constexpr std::uint32_t kDoip_VehicleAnnouncement_ResMinLen = 32;
 constexpr std::uint32_t kDoip_VehicleAnnouncement_ResMaxLen = 33;
 constexpr std::uint32_t kDoip_GenericHeader_NackLen = 1;
 
@@ -7,6 +7,8 @@
 */
 #include "common/doip_message.h"
 
+#include <utility>
+
 namespace doip_client {
 namespace {
 
@@ -37,24 +39,43 @@ DoipMessage::DoipMessage(MessageType message_type, DoipMessage::IpAddressType ho
       server_address_{0u},
       client_address_{0u},
       payload_type_{GetDoIPPayloadType(payload)},
-      payload_length_{GetDoIPPayloadLength(payload)} {
+      payload_length_{GetDoIPPayloadLength(payload)},
+      payload_{},
+      buffer_{} {
   constexpr std::uint8_t kDoipHeaderSize{8u};
   constexpr std::uint8_t kSourceAddressSize{4u};
-  if (message_type == MessageType::kTcp) {
-    payload_ = core_type::Span<std::uint8_t const>{
-        &payload[kDoipHeaderSize + kSourceAddressSize],
-        payload.size() - (kDoipHeaderSize + kSourceAddressSize)};
+  // header only tcp messages like alive check request carry no addresses
+  if ((message_type == MessageType::kTcp) &&
+      (payload.size() >= (kDoipHeaderSize + kSourceAddressSize))) {
+    payload_ = payload.subspan(kDoipHeaderSize + kSourceAddressSize);
+    client_address_ = ConvertToAddr(payload.subspan(kDoipHeaderSize, 2u));
+    server_address_ = ConvertToAddr(payload.subspan(kDoipHeaderSize + 2u, 2u));
   } else {
-    payload_ = core_type::Span<std::uint8_t const>{&payload[kDoipHeaderSize],
-                                                   payload.size() - kDoipHeaderSize};
+    payload_ = payload.subspan(kDoipHeaderSize);
   }
+}
 
-  if (message_type == MessageType::kTcp) {
-    client_address_ =
-        ConvertToAddr(core_type::Span<std::uint8_t const>{&payload[kDoipHeaderSize], 2u});
-    server_address_ =
-        ConvertToAddr(core_type::Span<std::uint8_t const>{&payload[kDoipHeaderSize + 2u], 2u});
-  }  // no client
+DoipMessage::DoipMessage(MessageType message_type, DoipMessage::IpAddressType host_ip_address,
+                         std::uint16_t host_port_number, BufferType buffer)
+    : DoipMessage{message_type, host_ip_address, host_port_number,
+                  core_type::Span<std::uint8_t const>{buffer}} {
+  // moving the vector keeps its storage, so payload keeps referring to valid data
+  buffer_ = std::move(buffer);
+}
+
+auto DoipMessage::ReleasePayload() noexcept -> BufferType {
+  BufferType payload{};
+  if (!buffer_.empty()) {
+    // strip the header in place and hand over the storage
+    auto const header_size{payload_.data() - buffer_.data()};
+    (void) buffer_.erase(buffer_.begin(), buffer_.begin() + header_size);
+    payload = std::move(buffer_);
+    buffer_.clear();
+  } else {
+    payload.assign(payload_.begin(), payload_.end());
+  }
+  payload_ = core_type::Span<std::uint8_t const>{};
+  return payload;
 }
 
 }  // namespace doip_client
@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "core/include/span.h"
 
@@ -35,6 +36,11 @@ class DoipMessage final {
    */
   using IpAddressType = std::string_view;
 
+  /**
+   * @brief    Type alias of underlying buffer
+   */
+  using BufferType = std::vector<std::uint8_t>;
+
  public:
   /**
    * @brief         Constructs an instance of DoipMessage
@@ -51,11 +57,29 @@ class DoipMessage final {
               std::uint16_t host_port_number, core_type::Span<std::uint8_t const> payload);
 
   /**
-   * @brief         Default copy assignment, copy constructor, move assignment and move constructor
+   * @brief         Constructs an instance of DoipMessage owning the received buffer
+   * @param[in]     message_type
+   *                The type of message constructed
+   * @param[in]     host_ip_address
+   *                The host ip address
+   * @param[in]     host_port_number
+   *                The host port number
+   * @param[in]     buffer
+   *                The received data buffer, ownership is taken
+   */
+  DoipMessage(MessageType message_type, IpAddressType host_ip_address,
+              std::uint16_t host_port_number, BufferType buffer);
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor, as payload may refer to owned buffer
+   */
+  DoipMessage(const DoipMessage &other) = delete;
+  DoipMessage &operator=(const DoipMessage &other) = delete;
+
+  /**
+   * @brief         Default move assignment and move constructor
    */
-  DoipMessage(const DoipMessage &other) = default;
   DoipMessage(DoipMessage &&other) noexcept = default;
-  DoipMessage &operator=(const DoipMessage &other) = default;
   DoipMessage &operator=(DoipMessage &&other) noexcept = default;
 
   /**
@@ -117,6 +141,17 @@ class DoipMessage final {
    */
   core_type::Span<std::uint8_t const> GetPayload() const { return payload_; }
 
+  /**
+   * @brief       Take over the payload
+   * @details     When the message owns the received buffer, the header is stripped in place and the buffer
+   *              is handed over without new allocation, otherwise the payload is copied.
+   *              Stripping the header moves the payload to the front of the buffer, as the uds message
+   *              exposes its payload as a vector starting with the service id.
+   *              The payload of this message is empty afterwards.
+   * @return      The payload
+   */
+  BufferType ReleasePayload() noexcept;
+
  private:
   /**
    * @brief    Store remote ip address
@@ -162,6 +197,11 @@ class DoipMessage final {
    * @brief    Store payload
    */
   core_type::Span<std::uint8_t const> payload_;
+
+  /**
+   * @brief    Store the received buffer when owned, payload refers into it
+   */
+  BufferType buffer_;
 };
 }  // namespace doip_client
 
@@ -8,10 +8,18 @@
 
 #include "connection/connection_manager.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <vector>
 
 #include "channel/tcp_channel/doip_tcp_channel.h"
 #include "channel/udp_channel/doip_udp_channel.h"
+#include "common/common_doip_types.h"
+#include "common/logger.h"
 #include "sockets/socket_handler.h"
 #include "uds_transport/conversation_handler.h"
 
@@ -30,6 +38,18 @@ constexpr std::string_view kDoipTcpConnectionName{"DTcpCntn_"sv};
  */
 constexpr std::string_view kDoipUdpConnectionName{"DUdpCntn_"sv};
 
+/**
+ * @brief       Function to get the unspecified address of the same ip version as given address
+ * @details     Vehicle announcements are broadcast to the subnet or to the limited broadcast address, which are
+ *              only received by sockets bound to the unspecified address
+ * @param[in]   ip_address
+ *              The local ip address
+ * @return      The unspecified ip address
+ */
+auto GetUnspecifiedAddress(std::string_view ip_address) noexcept -> std::string_view {
+  return ip_address.find(':') != std::string_view::npos ? "::"sv : "0.0.0.0"sv;
+}
+
 }  // namespace
 
 /**
@@ -157,6 +177,30 @@ class DoipTcpConnection final : public uds_transport::Connection {
     return doip_tcp_channel_.Transmit(std::move(message));
   }
 
+  /**
+   * @brief       Function to transmit a valid Uds message without waiting for its acknowledgement
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void TransmitAsync(uds_transport::UdsMessageConstPtr message,
+                     TransmissionCompletionHandler completion_handler) override {
+    doip_tcp_channel_.TransmitAsync(std::move(message), std::move(completion_handler));
+  }
+
+  /**
+   * @brief       Function to stop waiting for further responses of an ongoing transmission
+   * @details     Diagnostic requests complete with their own response, nothing to be done
+   */
+  void CancelTransmit() override {}
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any transmission
+   * @details     Diagnostic requests are never cancelled, nothing to be done
+   */
+  void ResetCancelTransmit() override {}
+
   /**
    * @brief       Function to Hands over a valid received Uds message
    * @param[in]   message
@@ -167,6 +211,35 @@ class DoipTcpConnection final : public uds_transport::Connection {
     conversation_handler_.HandleMessage(std::move(message));
   }
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the received bytes, valid only within this function call
+   */
+  void HandleMessageChunk(uds_transport::UdsMessage::Address source_addr,
+                          uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk) override {
+    conversation_handler_.HandleMessageChunk(source_addr, target_addr, chunk);
+  }
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   */
+  void HandleConnectionLoss() override { conversation_handler_.HandleConnectionLoss(); }
+
+  /**
+   * @brief       Function to set the size of the largest diagnostic message received
+   * @param[in]   rx_buffer_size
+   *              The size in bytes of the UdsMessage starting from SID
+   */
+  void SetRxBufferSize(std::size_t rx_buffer_size) noexcept {
+    doip_tcp_channel_.SetRxBufferSize(rx_buffer_size);
+  }
+
  private:
   /**
    * @brief        Store the doip tcp channel
@@ -194,14 +267,15 @@ class DoipUdpConnection final : public uds_transport::Connection {
    * @param[in]   conversation_handler
    *              The reference to conversation handler
    * @param[in]   udp_ip_address
-   *              The local tcp ip address
+   *              The local udp ip address
    * @param[in]   port_num
-   *              The local port number
+   *              The local port number used for vehicle identification
    */
   DoipUdpConnection(uds_transport::ConversionHandler const &conversation_handler,
                     std::string_view udp_ip_address, std::uint16_t port_num)
       : uds_transport::Connection{kDoipUdpConnectionName, 1, conversation_handler},
-        doip_udp_channel_{sockets::UdpSocketHandler{UdpClient{udp_ip_address, port_num}},
+        doip_udp_channel_{sockets::UdpSocketHandler{UdpClient{GetUnspecifiedAddress(udp_ip_address),
+                                                              kDoipTestEquipmentPort}},
                           sockets::UdpSocketHandler{UdpClient{udp_ip_address, port_num}}, *this} {}
 
   /**
@@ -297,6 +371,30 @@ class DoipUdpConnection final : public uds_transport::Connection {
     return (doip_udp_channel_.Transmit(std::move(message)));
   }
 
+  /**
+   * @brief       Function to transmit a valid Uds message
+   * @details     Vehicle identification completes with the collected responses, so the handler is invoked from
+   *              the calling context once Transmit returned
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void TransmitAsync(uds_transport::UdsMessageConstPtr message,
+                     TransmissionCompletionHandler completion_handler) override {
+    completion_handler(Transmit(std::move(message)));
+  }
+
+  /**
+   * @brief       Function to stop waiting for further vehicle identification responses
+   */
+  void CancelTransmit() override { doip_udp_channel_.CancelTransmit(); }
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any vehicle identification request
+   */
+  void ResetCancelTransmit() override { doip_udp_channel_.ResetCancelTransmit(); }
+
   /**
    * @brief       Function to Hands over a valid received Uds message
    * @param[in]   message
@@ -308,6 +406,20 @@ class DoipUdpConnection final : public uds_transport::Connection {
     conversation_handler_.HandleMessage(std::move(message));
   }
 
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @details     Udp messages are never streamed, nothing to be done
+   */
+  void HandleMessageChunk(uds_transport::UdsMessage::Address,
+                          uds_transport::UdsMessage::Address,
+                          core_type::Span<std::uint8_t const>) override {}
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   * @details     Udp is connectionless, nothing to be done
+   */
+  void HandleConnectionLoss() override {}
+
  private:
   /**
    * @brief        Store the reference to doip udp channel
@@ -315,12 +427,602 @@ class DoipUdpConnection final : public uds_transport::Connection {
   channel::udp_channel::DoipUdpChannel doip_udp_channel_;
 };
 
-ConnectionManager::ConnectionManager() noexcept : io_context_{} {}
+/**
+ * @brief    Routes messages received on a shared tcp connection to the conversation owning the target address
+ */
+class DoipTcpResponseRouter final : public uds_transport::ConversionHandler {
+ public:
+  /**
+   * @brief   Type alias for Uds message address
+   */
+  using Address = uds_transport::UdsMessage::Address;
+
+  /**
+   * @brief       Constructs an instance of DoipTcpResponseRouter
+   */
+  DoipTcpResponseRouter() noexcept
+      : uds_transport::ConversionHandler{0u},
+        route_lock_{},
+        routes_{} {}
+
+  /**
+   * @brief       Function to add a route towards a conversation
+   * @details     A target address is routed to one conversation only, as received messages are dispatched by it
+   * @param[in]   target_address
+   *              The logical address of the remote ECU
+   * @param[in]   conversation
+   *              The conversation handler receiving the messages from the ECU
+   * @return      True when route added, False when target address is already routed to another conversation
+   */
+  bool AddRoute(Address target_address, uds_transport::ConversionHandler const &conversation) noexcept {
+    std::lock_guard<std::mutex> const lock{route_lock_};
+    auto const route{routes_.find(target_address)};
+    if (route != routes_.end()) { return (route->second == &conversation); }
+    routes_.emplace(target_address, &conversation);
+    return true;
+  }
+
+  /**
+   * @brief       Function to remove a route towards a conversation
+   * @param[in]   target_address
+   *              The logical address of the remote ECU
+   * @param[in]   conversation
+   *              The conversation handler owning the route
+   */
+  void RemoveRoute(Address target_address,
+                   uds_transport::ConversionHandler const &conversation) noexcept {
+    std::lock_guard<std::mutex> const lock{route_lock_};
+    auto const route{routes_.find(target_address)};
+    if ((route != routes_.end()) && (route->second == &conversation)) { routes_.erase(route); }
+  }
+
+  /**
+   * @brief       Function to indicate a start of reception of message
+   * @details     The indication is forwarded to the conversation routed for the target address
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   type
+   *              The indication whether its is phys/func request
+   * @param[in]   channel_id
+   *              The transport protocol channel on which message start happened
+   * @param[in]   size
+   *              The size in bytes of the UdsMessage starting from SID
+   * @param[in]   priority
+   *              The priority of the given message, used for prioritization of conversations
+   * @param[in]   protocol_kind
+   *              The identifier of protocol kind associated to message
+   * @param[in]   payload_info
+   *              The view onto the first received payload bytes, if any
+   * @return      std::pair< IndicationResult, UdsMessagePtr >
+   *              The pair of IndicationResult and a pointer to UdsMessage owned/created by DM core
+   */
+  std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
+  IndicateMessage(uds_transport::UdsMessage::Address source_addr,
+                  uds_transport::UdsMessage::Address target_addr,
+                  uds_transport::UdsMessage::TargetAddressType type,
+                  uds_transport::ChannelID channel_id, std::size_t size,
+                  uds_transport::Priority priority, uds_transport::ProtocolKind protocol_kind,
+                  core_type::Span<std::uint8_t const> payload_info) const noexcept override {
+    uds_transport::ConversionHandler const *conversation{FindRoute(target_addr)};
+    if (conversation == nullptr) {
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogWarn(
+          FILE_NAME, __LINE__, __func__, [target_addr](std::stringstream &msg) {
+            msg << "No conversation routed for message from target address"
+                << " (0x" << std::hex << target_addr << ")";
+          });
+      return {uds_transport::UdsTransportProtocolMgr::IndicationResult::kIndicationUnknownTargetAddress,
+              nullptr};
+    }
+    return (conversation->IndicateMessage(source_addr, target_addr, type, channel_id, size, priority,
+                                          protocol_kind, payload_info));
+  }
+
+  /**
+   * @brief       Function to Hands over a valid received Uds message
+   * @details     The message is forwarded to the conversation routed for the target address
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the response
+   */
+  void HandleMessage(uds_transport::UdsMessagePtr message) const noexcept override {
+    uds_transport::ConversionHandler const *conversation{FindRoute(message->GetTa())};
+    if (conversation != nullptr) { conversation->HandleMessage(std::move(message)); }
+  }
+
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @details     The chunk is forwarded to the conversation routed for the target address
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the received bytes, valid only within this function call
+   */
+  void HandleMessageChunk(uds_transport::UdsMessage::Address source_addr,
+                          uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk) const noexcept override {
+    uds_transport::ConversionHandler const *conversation{FindRoute(target_addr)};
+    if (conversation != nullptr) {
+      conversation->HandleMessageChunk(source_addr, target_addr, chunk);
+    }
+  }
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   * @details     All conversations sharing the connection are informed, outside of the route lock
+   */
+  void HandleConnectionLoss() const noexcept override {
+    std::vector<uds_transport::ConversionHandler const *> conversations{};
+    {
+      std::lock_guard<std::mutex> const lock{route_lock_};
+      conversations.reserve(routes_.size());
+      for (auto const &route: routes_) { conversations.emplace_back(route.second); }
+    }
+    for (auto const *conversation: conversations) { conversation->HandleConnectionLoss(); }
+  }
+
+  /**
+   * @brief       Function to get the size of the largest message accepted by the routed conversations
+   * @return      The largest reception buffer size of all routed conversations
+   */
+  std::size_t GetRxBufferSize() const noexcept override {
+    std::lock_guard<std::mutex> const lock{route_lock_};
+    std::size_t rx_buffer_size{0u};
+    for (auto const &route: routes_) {
+      rx_buffer_size = std::max(rx_buffer_size, route.second->GetRxBufferSize());
+    }
+    return rx_buffer_size;
+  }
+
+ private:
+  /**
+   * @brief       Function to find the conversation routed for the target address
+   * @param[in]   target_address
+   *              The logical address of the remote ECU
+   * @return      The pointer to conversation handler, nullptr when not routed
+   */
+  uds_transport::ConversionHandler const *FindRoute(Address target_address) const noexcept {
+    std::lock_guard<std::mutex> const lock{route_lock_};
+    auto const route{routes_.find(target_address)};
+    return (route != routes_.end()) ? route->second : nullptr;
+  }
+
+  /**
+   * @brief        Store the lock protecting the routes
+   */
+  mutable std::mutex route_lock_;
+
+  /**
+   * @brief        Store the routes from target address to conversation
+   */
+  std::map<Address, uds_transport::ConversionHandler const *> routes_;
+};
+
+/**
+ * @brief    Doip Tcp gateway holds one tcp connection and one routing activation shared by conversations
+ */
+class DoipTcpGateway final {
+ public:
+  /**
+   * @brief       Constructs an instance of DoipTcpGateway and starts the underlying connection
+   * @param[in]   tcp_ip_address
+   *              The local tcp ip address
+   * @param[in]   port_num
+   *              The local port number
+   */
+  DoipTcpGateway(std::string_view tcp_ip_address, std::uint16_t port_num)
+      : response_router_{},
+        connection_{response_router_, tcp_ip_address, port_num},
+        gateway_lock_{},
+        routing_activated_{false} {
+    static_cast<void>(connection_.Initialize());
+    connection_.Start();
+  }
+
+  /**
+   * @brief       Destruct an instance of DoipTcpGateway, disconnects and stops the underlying connection
+   */
+  ~DoipTcpGateway() {
+    if (connection_.IsConnectToHost()) { static_cast<void>(connection_.DisconnectFromHost()); }
+    connection_.Stop();
+  }
+
+  DoipTcpGateway(DoipTcpGateway const &) = delete;
+  DoipTcpGateway &operator=(DoipTcpGateway const &) = delete;
+  DoipTcpGateway(DoipTcpGateway &&) = delete;
+  DoipTcpGateway &operator=(DoipTcpGateway &&) = delete;
+
+  /**
+   * @brief       Function to get the response router
+   * @return      The reference to response router
+   */
+  DoipTcpResponseRouter &GetResponseRouter() noexcept { return response_router_; }
+
+  /**
+   * @brief       Function to size the reception limit of the connection after the routes changed
+   * @details     Responses up to the largest reception buffer of the routed conversations are received,
+   *              each conversation still rejects responses exceeding its own reception buffer
+   */
+  void UpdateRxBufferSize() noexcept {
+    connection_.SetRxBufferSize(response_router_.GetRxBufferSize());
+  }
+
+  /**
+   * @brief        Function to check if connected to host remote server
+   * @return       True if connected, False otherwise
+   */
+  bool IsConnectToHost() { return connection_.IsConnectToHost(); }
+
+  /**
+   * @brief       Function to establish connection to remote host server
+   * @details     Tcp connect and routing activation are only done by the first conversation,
+   *              later conversations reuse the activated connection
+   * @param[in]   message
+   *              The connection message
+   * @return      Connection result
+   */
+  uds_transport::UdsTransportProtocolMgr::ConnectionResult ConnectToHost(
+      uds_transport::UdsMessageConstPtr message) {
+    std::lock_guard<std::mutex> const lock{gateway_lock_};
+    if (routing_activated_ && connection_.IsConnectToHost()) {
+      return uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionOk;
+    }
+    uds_transport::UdsTransportProtocolMgr::ConnectionResult const result{
+        connection_.ConnectToHost(std::move(message))};
+    routing_activated_ =
+        (result == uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionOk);
+    return result;
+  }
+
+  /**
+   * @brief       Function to transmit a valid Uds message
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   */
+  uds_transport::UdsTransportProtocolMgr::TransmissionResult Transmit(
+      uds_transport::UdsMessageConstPtr message) {
+    return connection_.Transmit(std::move(message));
+  }
+
+  /**
+   * @brief       Function to transmit a valid Uds message without waiting for its acknowledgement
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void TransmitAsync(uds_transport::UdsMessageConstPtr message,
+                     uds_transport::Connection::TransmissionCompletionHandler completion_handler) {
+    connection_.TransmitAsync(std::move(message), std::move(completion_handler));
+  }
+
+ private:
+  /**
+   * @brief        Store the router dispatching received messages to conversations
+   */
+  DoipTcpResponseRouter response_router_;
+
+  /**
+   * @brief        Store the shared tcp connection
+   */
+  DoipTcpConnection connection_;
+
+  /**
+   * @brief        Store the lock serializing connection establishment
+   */
+  std::mutex gateway_lock_;
+
+  /**
+   * @brief        Store the routing activation status of the shared connection
+   */
+  bool routing_activated_;
+};
+
+/**
+ * @brief    Pool of tcp gateways, keyed by local endpoint, remote ip and source address
+ */
+class DoipTcpGatewayPool final {
+ public:
+  /**
+   * @brief   Type alias for gateway key
+   */
+  using GatewayKey = std::tuple<std::string, std::uint16_t, std::string, uds_transport::UdsMessage::Address>;
+
+  /**
+   * @brief       Constructs an instance of DoipTcpGatewayPool
+   */
+  DoipTcpGatewayPool() noexcept : pool_lock_{}, gateways_{} {}
+
+  /**
+   * @brief       Function to get an existing gateway or create a new one
+   * @param[in]   key
+   *              The gateway key
+   * @return      The shared pointer to gateway
+   */
+  std::shared_ptr<DoipTcpGateway> Acquire(GatewayKey const &key) {
+    std::lock_guard<std::mutex> const lock{pool_lock_};
+    // drop gateways no longer used by any conversation
+    for (auto it = gateways_.begin(); it != gateways_.end();) {
+      if (it->second.expired()) {
+        it = gateways_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    std::shared_ptr<DoipTcpGateway> gateway{};
+    auto const found{gateways_.find(key)};
+    if (found != gateways_.end()) { gateway = found->second.lock(); }
+    if (!gateway) {
+      gateway = std::make_shared<DoipTcpGateway>(std::get<0>(key), std::get<1>(key));
+      gateways_[key] = gateway;
+    }
+    return gateway;
+  }
+
+ private:
+  /**
+   * @brief        Store the lock protecting the pool
+   */
+  std::mutex pool_lock_;
+
+  /**
+   * @brief        Store the gateways, owned by the conversations using them
+   */
+  std::map<GatewayKey, std::weak_ptr<DoipTcpGateway>> gateways_;
+};
+
+/**
+ * @brief    Doip Tcp connection of one conversation, bound to a pooled gateway while connected
+ * @details  Conversations with the same source address share the gateway connection to a server as long as their
+ *           target addresses differ. A conversation addressing a target already in use gets a dedicated connection.
+ */
+class DoipSharedTcpConnection final : public uds_transport::Connection {
+ public:
+  /**
+   * @brief   Type alias for Initialization result
+   */
+  using InitializationResult = uds_transport::Connection::InitializationResult;
+
+  /**
+   * @brief       Constructor to create a new shared tcp connection
+   * @param[in]   conversation_handler
+   *              The reference to conversation handler
+   * @param[in]   tcp_ip_address
+   *              The local tcp ip address
+   * @param[in]   port_num
+   *              The local port number
+   * @param[in]   gateway_pool
+   *              The pool of tcp gateways
+   */
+  DoipSharedTcpConnection(uds_transport::ConversionHandler const &conversation_handler,
+                          std::string_view tcp_ip_address, std::uint16_t port_num,
+                          std::shared_ptr<DoipTcpGatewayPool> gateway_pool)
+      : uds_transport::Connection{kDoipTcpConnectionName, 1u, conversation_handler},
+        local_ip_address_{tcp_ip_address},
+        local_port_num_{port_num},
+        gateway_pool_{std::move(gateway_pool)},
+        gateway_{},
+        target_address_{} {}
+
+  /**
+   * @brief         Destruct an instance of DoipSharedTcpConnection
+   */
+  ~DoipSharedTcpConnection() final { Release(); }
+
+  /**
+   * @brief        Function to initialize the connection
+   * @return       The initialization result
+   */
+  InitializationResult Initialize() override { return InitializationResult::kInitializeOk; }
+
+  /**
+   * @brief        Function to start the connection
+   * @details      The gateway connection is started when first conversation connects to it
+   */
+  void Start() override {}
+
+  /**
+   * @brief        Function to stop the connection
+   */
+  void Stop() override { Release(); }
+
+  /**
+   * @brief        Function to check if connected to host remote server
+   * @return       True if connected, False otherwise
+   */
+  bool IsConnectToHost() override { return (gateway_ != nullptr) && gateway_->IsConnectToHost(); }
+
+  /**
+   * @brief       Function to establish connection to remote host server
+   * @param[in]   message
+   *              The connection message
+   * @return      Connection result
+   */
+  uds_transport::UdsTransportProtocolMgr::ConnectionResult ConnectToHost(
+      uds_transport::UdsMessageConstPtr message) override {
+    // switching to another server releases the previous gateway
+    Release();
+    DoipTcpGatewayPool::GatewayKey const key{local_ip_address_, local_port_num_,
+                                             message->GetHostIpAddress(), message->GetSa()};
+    std::shared_ptr<DoipTcpGateway> gateway{gateway_pool_->Acquire(key)};
+    uds_transport::UdsMessage::Address const target_address{message->GetTa()};
+    if (!gateway->GetResponseRouter().AddRoute(target_address, conversation_handler_)) {
+      // target address routed to another conversation, use an own connection as without pool
+      logger::DoipClientLogger::GetDiagClientLogger().GetLogger().LogInfo(
+          FILE_NAME, __LINE__, __func__, [target_address](std::stringstream &msg) {
+            msg << "Target address (0x" << std::hex << target_address
+                << ") already in use on the gateway, using dedicated connection";
+          });
+      gateway = std::make_shared<DoipTcpGateway>(local_ip_address_, local_port_num_);
+      static_cast<void>(
+          gateway->GetResponseRouter().AddRoute(target_address, conversation_handler_));
+    }
+    gateway->UpdateRxBufferSize();
+    uds_transport::UdsTransportProtocolMgr::ConnectionResult const result{
+        gateway->ConnectToHost(std::move(message))};
+    // stay bound while socket is connected even if routing activation failed, so that
+    // conversation is able to disconnect from the host
+    if ((result == uds_transport::UdsTransportProtocolMgr::ConnectionResult::kConnectionOk) ||
+        gateway->IsConnectToHost()) {
+      gateway_ = std::move(gateway);
+      target_address_ = target_address;
+    } else {
+      gateway->GetResponseRouter().RemoveRoute(target_address, conversation_handler_);
+      gateway->UpdateRxBufferSize();
+    }
+    return result;
+  }
+
+  /**
+   * @brief       Function to disconnect from remote host server
+   * @details     The gateway connection is disconnected when last conversation leaves it
+   * @return      Disconnection result
+   */
+  uds_transport::UdsTransportProtocolMgr::DisconnectionResult DisconnectFromHost() override {
+    if (gateway_ == nullptr) {
+      return uds_transport::UdsTransportProtocolMgr::DisconnectionResult::kDisconnectionFailed;
+    }
+    Release();
+    return uds_transport::UdsTransportProtocolMgr::DisconnectionResult::kDisconnectionOk;
+  }
+
+  /**
+   * @brief       Function to indicate a start of reception of message
+   * @details     Messages are delivered directly to the conversation by the gateway router
+   */
+  std::pair<uds_transport::UdsTransportProtocolMgr::IndicationResult, uds_transport::UdsMessagePtr>
+  IndicateMessage(uds_transport::UdsMessage::Address source_addr,
+                  uds_transport::UdsMessage::Address target_addr,
+                  uds_transport::UdsMessage::TargetAddressType type,
+                  uds_transport::ChannelID channel_id, std::size_t size,
+                  uds_transport::Priority priority, uds_transport::ProtocolKind protocol_kind,
+                  core_type::Span<std::uint8_t const> payload_info) override {
+    return (conversation_handler_.IndicateMessage(source_addr, target_addr, type, channel_id, size,
+                                                  priority, protocol_kind, payload_info));
+  }
+
+  /**
+   * @brief       Function to transmit a valid Uds message
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   */
+  uds_transport::UdsTransportProtocolMgr::TransmissionResult Transmit(
+      uds_transport::UdsMessageConstPtr message) override {
+    if (gateway_ == nullptr) {
+      return uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed;
+    }
+    return gateway_->Transmit(std::move(message));
+  }
+
+  /**
+   * @brief       Function to transmit a valid Uds message without waiting for its acknowledgement
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  void TransmitAsync(uds_transport::UdsMessageConstPtr message,
+                     TransmissionCompletionHandler completion_handler) override {
+    if (gateway_ == nullptr) {
+      completion_handler(uds_transport::UdsTransportProtocolMgr::TransmissionResult::kTransmitFailed);
+    } else {
+      gateway_->TransmitAsync(std::move(message), std::move(completion_handler));
+    }
+  }
+
+  /**
+   * @brief       Function to stop waiting for further responses of an ongoing transmission
+   * @details     Diagnostic requests complete with their own response, nothing to be done
+   */
+  void CancelTransmit() override {}
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any transmission
+   * @details     Diagnostic requests are never cancelled, nothing to be done
+   */
+  void ResetCancelTransmit() override {}
+
+  /**
+   * @brief       Function to Hands over a valid received Uds message
+   * @details     Messages are delivered directly to the conversation by the gateway router
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the response
+   */
+  void HandleMessage(uds_transport::UdsMessagePtr message) override {
+    conversation_handler_.HandleMessage(std::move(message));
+  }
+
+  /**
+   * @brief       Function to hand over the next chunk of a streamed Uds message
+   * @details     Chunks are delivered directly to the conversation by the gateway router
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the received bytes, valid only within this function call
+   */
+  void HandleMessageChunk(uds_transport::UdsMessage::Address source_addr,
+                          uds_transport::UdsMessage::Address target_addr,
+                          core_type::Span<std::uint8_t const> chunk) override {
+    conversation_handler_.HandleMessageChunk(source_addr, target_addr, chunk);
+  }
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   * @details     Connection loss is delivered directly to the conversation by the gateway router
+   */
+  void HandleConnectionLoss() override { conversation_handler_.HandleConnectionLoss(); }
+
+ private:
+  /**
+   * @brief       Function to leave the gateway, last conversation leaving tears the connection down
+   */
+  void Release() noexcept {
+    if (gateway_ != nullptr) {
+      gateway_->GetResponseRouter().RemoveRoute(target_address_, conversation_handler_);
+      gateway_->UpdateRxBufferSize();
+      gateway_.reset();
+    }
+  }
+
+  /**
+   * @brief        Store the local tcp ip address
+   */
+  std::string local_ip_address_;
+
+  /**
+   * @brief        Store the local port number
+   */
+  std::uint16_t local_port_num_;
+
+  /**
+   * @brief        Store the pool of tcp gateways
+   */
+  std::shared_ptr<DoipTcpGatewayPool> gateway_pool_;
+
+  /**
+   * @brief        Store the gateway in use while connected
+   */
+  std::shared_ptr<DoipTcpGateway> gateway_;
+
+  /**
+   * @brief        Store the target address routed to this conversation
+   */
+  uds_transport::UdsMessage::Address target_address_;
+};
+
+ConnectionManager::ConnectionManager() noexcept
+    : io_context_{},
+      tcp_gateway_pool_{std::make_shared<DoipTcpGatewayPool>()} {}
 
 std::unique_ptr<uds_transport::Connection> ConnectionManager::CreateTcpConnection(
     uds_transport::ConversionHandler const &conversation, std::string_view tcp_ip_address,
     std::uint16_t port_num) {
-  return std::make_unique<DoipTcpConnection>(conversation, tcp_ip_address, port_num);
+  return std::make_unique<DoipSharedTcpConnection>(conversation, tcp_ip_address, port_num,
+                                                   tcp_gateway_pool_);
 }
 
 std::unique_ptr<uds_transport::Connection> ConnectionManager::CreateUdpConnection(
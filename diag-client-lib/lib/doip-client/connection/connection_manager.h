@@ -17,8 +17,16 @@
 namespace doip_client {
 namespace connection {
 
+/**
+ * @brief    Forward declaration of pool holding tcp connections shared by conversations
+ */
+class DoipTcpGatewayPool;
+
 /**
  * @brief    Manages Doip tcp and udp connections
+ * @details  Tcp connections towards the same gateway (remote ip, source address) are pooled, so that
+ *           conversations talking to different ECUs behind one DoIP edge node share a single socket
+ *           and a single routing activation
  */
 class ConnectionManager final {
  public:
@@ -40,6 +48,7 @@ class ConnectionManager final {
 
   /**
    * @brief       Function to find or create a new Tcp connection
+   * @details     The returned connection binds to a pooled gateway connection on ConnectToHost
    * @param[in]   conversation
    *              The conversation handler used by tcp connection to communicate
    * @param[in]   tcp_ip_address
@@ -71,6 +80,11 @@ class ConnectionManager final {
    * @brief  Stores the io context
    */
   IoContext io_context_;
+
+  /**
+   * @brief  Stores the pool of tcp gateway connections
+   */
+  std::shared_ptr<DoipTcpGatewayPool> tcp_gateway_pool_;
 };
 }  // namespace connection
 }  // namespace doip_client
@@ -48,6 +48,11 @@ class SocketHandler final {
    */
   using HandlerRead = std::function<void(MessagePtr)>;
 
+  /**
+   * @brief         Function template used for notification of connection loss
+   */
+  using HandlerDisconnect = std::function<void()>;
+
   /**
    * @brief         Constructs an instance of TcpSocketHandler
    * @param[in]     socket
@@ -90,6 +95,36 @@ class SocketHandler final {
    */
   void SetReadHandler(HandlerRead read_handler) { client_.SetReadHandler(std::move(read_handler)); }
 
+  /**
+   * @brief         Function to set the handler that is invoked when the connection to remote host is lost
+   * @details       Only available for stream clients
+   * @param[in]     disconnect_handler
+   *                The handler to be set
+   */
+  void SetDisconnectHandler(HandlerDisconnect disconnect_handler) {
+    client_.SetDisconnectHandler(std::move(disconnect_handler));
+  }
+
+  /**
+   * @brief         Function to limit the payload length of received messages
+   * @details       Only available for stream clients
+   * @param[in]     max_payload_length
+   *                The maximum payload length received
+   */
+  void SetMaxPayloadLength(std::uint32_t max_payload_length) noexcept {
+    client_.SetMaxPayloadLength(max_payload_length);
+  }
+
+  /**
+   * @brief         Function to enable delivery of large messages in fragments
+   * @details       Only available for stream clients
+   * @param[in]     fragmented_reception
+   *                True to deliver fragments
+   */
+  void SetFragmentedReception(bool fragmented_reception) noexcept {
+    client_.SetFragmentedReception(fragmented_reception);
+  }
+
   /**
    * @brief         Function to connect to remote ip address and port number
    * @param[in]     host_ip_address
@@ -109,6 +144,12 @@ class SocketHandler final {
    */
   core_type::Result<void> DisconnectFromHost() { return client_.DisconnectFromHost(); }
 
+  /**
+   * @brief         Function to abort the connection to remote host, reported as connection loss
+   * @details       Only available for stream clients
+   */
+  void AbortConnection() noexcept { client_.AbortConnection(); }
+
   /**
    * @brief         Function to get the connection status
    * @return        True if connected, False otherwise
@@ -125,6 +166,17 @@ class SocketHandler final {
     return client_.Transmit(std::move(message));
   }
 
+  /**
+   * @brief         Function to transmit the provided buffers as one message without copying them
+   * @details       Only available for stream clients supporting vectored write
+   * @param[in]     buffer_views
+   *                The views on buffers, valid until the function returns
+   * @return        Empty void on success, otherwise error is returned
+   */
+  core_type::Result<void> Transmit(boost_support::message::tcp::TcpMessageBufferViews buffer_views) {
+    return client_.Transmit(buffer_views);
+  }
+
  private:
   /**
    * @brief  Store the client object
@@ -10,6 +10,7 @@
 
 /* includes */
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <string_view>
 
@@ -54,6 +55,12 @@ class Connection {
    */
   using InitializationResult = uds_transport::UdsTransportProtocolHandler::InitializationResult;
 
+  /**
+   * @brief   Type alias for handler invoked once the transmission of a Uds message is confirmed or failed
+   */
+  using TransmissionCompletionHandler =
+      std::function<void(UdsTransportProtocolMgr::TransmissionResult)>;
+
   /**
    * @brief       Constructor to create a new connection
    * @param[in]   connection_name
@@ -159,6 +166,33 @@ class Connection {
    */
   virtual UdsTransportProtocolMgr::TransmissionResult Transmit(UdsMessageConstPtr message) = 0;
 
+  /**
+   * @brief       Function to transmit a valid Uds message without waiting for its confirmation
+   * @details     The handler is invoked exactly once with the result Transmit would return, from the reception or
+   *              timer context once confirmed or timed out, or from the calling context if sending failed
+   * @param[in]   message
+   *              The Uds message ptr (unique_ptr semantics) with the request.
+   * @param[in]   completion_handler
+   *              The handler invoked with the transmission result
+   */
+  virtual void TransmitAsync(UdsMessageConstPtr message,
+                             TransmissionCompletionHandler completion_handler) = 0;
+
+  /**
+   * @brief       Function to stop waiting for further responses of an ongoing transmission
+   * @details     The pending Transmit returns without waiting for the remaining responses, responses arriving
+   *              afterwards are discarded. If no transmission is pending yet, the next one returns without
+   *              waiting, until the cancellation is reset
+   */
+  virtual void CancelTransmit() = 0;
+
+  /**
+   * @brief       Function to withdraw a cancellation not consumed by any transmission
+   * @details     Called before starting a new transmission, so that the cancellation of a previous one does not
+   *              stop it
+   */
+  virtual void ResetCancelTransmit() = 0;
+
   /**
    * @brief       Function to Hands over a valid received Uds message
    * @param[in]   message
@@ -167,6 +201,27 @@ class Connection {
    */
   virtual void HandleMessage(UdsMessagePtr message) = 0;
 
+  /**
+   * @brief       Function to hand over the next chunk of a received Uds message streamed to the conversation
+   * @details     This is called instead of HandleMessage after the conversation answered the indication with
+   *              kIndicationStreamed, until the size indicated is handed over
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the next payload bytes, valid within this function call only
+   */
+  virtual void HandleMessageChunk(UdsMessage::Address source_addr, UdsMessage::Address target_addr,
+                                  core_type::Span<std::uint8_t const> chunk) = 0;
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   * @details     This is called by underlying transport protocol handler when the connection is lost without
+   *              being disconnected by the conversation
+   */
+  virtual void HandleConnectionLoss() = 0;
+
  protected:
   /**
    * @brief        Store the conversation handler
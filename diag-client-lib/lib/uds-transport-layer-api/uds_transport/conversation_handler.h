@@ -82,6 +82,34 @@ class ConversionHandler {
    */
   virtual void HandleMessage(UdsMessagePtr message) const noexcept = 0;
 
+  /**
+   * @brief       Function to hand over the next chunk of a received Uds message streamed to the conversation
+   * @details     This is called instead of HandleMessage after the indication was answered with kIndicationStreamed,
+   *              until the size indicated is handed over
+   * @param[in]   source_addr
+   *              The UDS source address of message
+   * @param[in]   target_addr
+   *              The UDS target address of message
+   * @param[in]   chunk
+   *              The view onto the next payload bytes, valid within this function call only
+   */
+  virtual void HandleMessageChunk(UdsMessage::Address source_addr, UdsMessage::Address target_addr,
+                                  core_type::Span<std::uint8_t const> chunk) const noexcept = 0;
+
+  /**
+   * @brief       Function to indicate the loss of connection to remote host server
+   * @details     Any pending request waiting for response shall be finished immediately
+   */
+  virtual void HandleConnectionLoss() const noexcept = 0;
+
+  /**
+   * @brief       Function to get the size of the largest message the conversation accepts
+   * @details     The transport protocol sizes its reception limit accordingly, larger messages are rejected
+   * @return      The size in bytes of the UdsMessage starting from SID, zero if no message is received on the
+   *              connection
+   */
+  virtual std::size_t GetRxBufferSize() const noexcept = 0;
+
  protected:
   /**
    * @brief         Store the conversation handle id
@@ -23,7 +23,8 @@ class UdsTransportProtocolMgr {
     kIndicationOverflow,
     kIndicationUnknownTargetAddress,
     kIndicationPending,
-    kIndicationNOk
+    kIndicationNOk,
+    kIndicationStreamed
   };
   // Result for transmission of message sent
   enum class TransmissionResult : std::uint8_t {
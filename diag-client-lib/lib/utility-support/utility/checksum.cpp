@@ -0,0 +1,315 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/checksum.h"
+
+#include <array>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILITY_CHECKSUM_PCLMUL
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__) && defined(__linux__)
+#define UTILITY_CHECKSUM_ARMV8_CRC
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1U << 7U)
+#endif
+#endif
+
+namespace utility {
+namespace checksum {
+namespace {
+
+/**
+ * @brief  Type alias for slicing-by-8 tables, table k holds the CRC of a byte followed by k zero bytes
+ */
+template<typename Register>
+using SlicingTables = std::array<std::array<Register, 256U>, 8U>;
+
+/**
+ * @brief  Reflected CRC-32 polynomial
+ */
+constexpr std::uint32_t kCrc32Polynomial{0xEDB88320U};
+
+/**
+ * @brief  CRC-16/CCITT polynomial
+ */
+constexpr std::uint16_t kCrc16Polynomial{0x1021U};
+
+/**
+ * @brief       Function to create the CRC-32 slicing tables
+ * @return      The tables
+ */
+constexpr SlicingTables<std::uint32_t> CreateCrc32Tables() noexcept {
+  SlicingTables<std::uint32_t> tables{};
+  for (std::uint32_t byte{0U}; byte < 256U; ++byte) {
+    std::uint32_t crc{byte};
+    for (std::uint8_t bit{0U}; bit < 8U; ++bit) {
+      crc = (crc & 1U) != 0U ? (crc >> 1U) ^ kCrc32Polynomial : crc >> 1U;
+    }
+    tables[0U][byte] = crc;
+  }
+  for (std::size_t table{1U}; table < tables.size(); ++table) {
+    for (std::size_t byte{0U}; byte < 256U; ++byte) {
+      std::uint32_t const previous{tables[table - 1U][byte]};
+      tables[table][byte] = (previous >> 8U) ^ tables[0U][previous & 0xFFU];
+    }
+  }
+  return tables;
+}
+
+/**
+ * @brief       Function to create the CRC-16 slicing tables
+ * @return      The tables
+ */
+constexpr SlicingTables<std::uint16_t> CreateCrc16Tables() noexcept {
+  SlicingTables<std::uint16_t> tables{};
+  for (std::uint32_t byte{0U}; byte < 256U; ++byte) {
+    std::uint32_t crc{byte << 8U};
+    for (std::uint8_t bit{0U}; bit < 8U; ++bit) {
+      crc = (crc & 0x8000U) != 0U ? (crc << 1U) ^ kCrc16Polynomial : crc << 1U;
+    }
+    tables[0U][byte] = static_cast<std::uint16_t>(crc);
+  }
+  for (std::size_t table{1U}; table < tables.size(); ++table) {
+    for (std::size_t byte{0U}; byte < 256U; ++byte) {
+      std::uint16_t const previous{tables[table - 1U][byte]};
+      tables[table][byte] =
+          static_cast<std::uint16_t>((previous << 8U) ^ tables[0U][previous >> 8U]);
+    }
+  }
+  return tables;
+}
+
+/**
+ * @brief  CRC-32 slicing tables computed at compile time
+ */
+constexpr SlicingTables<std::uint32_t> kCrc32Tables{CreateCrc32Tables()};
+
+/**
+ * @brief  CRC-16 slicing tables computed at compile time
+ */
+constexpr SlicingTables<std::uint16_t> kCrc16Tables{CreateCrc16Tables()};
+
+/**
+ * @brief       Function to update the CRC-32 register one byte at a time
+ */
+std::uint32_t Crc32Bytewise(std::uint32_t crc, std::uint8_t const *data, std::size_t length) noexcept {
+  for (std::size_t index{0U}; index < length; ++index) {
+    crc = (crc >> 8U) ^ kCrc32Tables[0U][(crc ^ data[index]) & 0xFFU];
+  }
+  return crc;
+}
+
+/**
+ * @brief       Function to update the CRC-32 register eight bytes at a time
+ */
+std::uint32_t Crc32SlicingBy8(std::uint32_t crc, std::uint8_t const *data, std::size_t length) noexcept {
+  while (length >= 8U) {
+    std::uint32_t const low{crc ^ (static_cast<std::uint32_t>(data[0U]) |
+                                   (static_cast<std::uint32_t>(data[1U]) << 8U) |
+                                   (static_cast<std::uint32_t>(data[2U]) << 16U) |
+                                   (static_cast<std::uint32_t>(data[3U]) << 24U))};
+    crc = kCrc32Tables[7U][low & 0xFFU] ^ kCrc32Tables[6U][(low >> 8U) & 0xFFU] ^
+          kCrc32Tables[5U][(low >> 16U) & 0xFFU] ^ kCrc32Tables[4U][low >> 24U] ^
+          kCrc32Tables[3U][data[4U]] ^ kCrc32Tables[2U][data[5U]] ^ kCrc32Tables[1U][data[6U]] ^
+          kCrc32Tables[0U][data[7U]];
+    data += 8U;
+    length -= 8U;
+  }
+  return Crc32Bytewise(crc, data, length);
+}
+
+#if defined(UTILITY_CHECKSUM_PCLMUL)
+/**
+ * @brief       Function to update the CRC-32 register by folding with carry-less multiplication
+ * @details     Folding constants and Barrett reduction as in Intel's "Fast CRC Computation for Generic Polynomials
+ *              Using PCLMULQDQ Instruction", in the bit reflected domain. Four 128 bit lanes are folded in parallel
+ *              by 64 bytes, remaining 16 byte blocks one by one and the tail by table.
+ */
+__attribute__((target("pclmul,sse4.1"))) std::uint32_t Crc32Pclmul(std::uint32_t crc,
+                                                                    std::uint8_t const *data,
+                                                                    std::size_t length) noexcept {
+  if (length < 64U) { return Crc32SlicingBy8(crc, data, length); }
+  __m128i const k1k2{_mm_set_epi64x(0x01C6E41596, 0x0154442BD4)};
+  __m128i const k3k4{_mm_set_epi64x(0x00CCAA009E, 0x01751997D0)};
+  __m128i const k5k0{_mm_set_epi64x(0x0000000000, 0x0163CD6124)};
+  __m128i const poly{_mm_set_epi64x(0x01F7011641, 0x01DB710641)};
+  __m128i const mask32{_mm_setr_epi32(~0, 0, ~0, 0)};
+
+  __m128i x1{_mm_loadu_si128(reinterpret_cast<__m128i const *>(data))};
+  __m128i x2{_mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 16U))};
+  __m128i x3{_mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 32U))};
+  __m128i x4{_mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 48U))};
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+  data += 64U;
+  length -= 64U;
+
+  // fold 4 lanes by 64 bytes
+  while (length >= 64U) {
+    __m128i const x5{_mm_clmulepi64_si128(x1, k1k2, 0x00)};
+    __m128i const x6{_mm_clmulepi64_si128(x2, k1k2, 0x00)};
+    __m128i const x7{_mm_clmulepi64_si128(x3, k1k2, 0x00)};
+    __m128i const x8{_mm_clmulepi64_si128(x4, k1k2, 0x00)};
+    x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+    x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+    x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+    x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(data)));
+    x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 16U)));
+    x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 32U)));
+    x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                       _mm_loadu_si128(reinterpret_cast<__m128i const *>(data + 48U)));
+    data += 64U;
+    length -= 64U;
+  }
+
+  // fold 4 lanes into one
+  for (__m128i const next: {x2, x3, x4}) {
+    __m128i const x5{_mm_clmulepi64_si128(x1, k3k4, 0x00)};
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), next), x5);
+  }
+
+  // fold by 16 bytes
+  while (length >= 16U) {
+    __m128i const x5{_mm_clmulepi64_si128(x1, k3k4, 0x00)};
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11),
+                                     _mm_loadu_si128(reinterpret_cast<__m128i const *>(data))),
+                       x5);
+    data += 16U;
+    length -= 16U;
+  }
+
+  // fold 128 bits to 64 bits
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), x2);
+
+  // Barrett reduction to 32 bits
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+  x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  crc = static_cast<std::uint32_t>(_mm_extract_epi32(x1, 1));
+  return Crc32SlicingBy8(crc, data, length);
+}
+#endif
+
+#if defined(UTILITY_CHECKSUM_ARMV8_CRC)
+#if defined(__clang__)
+#define UTILITY_CHECKSUM_CRC_TARGET "crc"
+#else
+#define UTILITY_CHECKSUM_CRC_TARGET "+crc"
+#endif
+/**
+ * @brief       Function to update the CRC-32 register with the AArch64 CRC32 instructions
+ */
+__attribute__((target(UTILITY_CHECKSUM_CRC_TARGET))) std::uint32_t Crc32Armv8(
+    std::uint32_t crc, std::uint8_t const *data, std::size_t length) noexcept {
+  while (length >= 8U) {
+    std::uint64_t word{0U};
+    for (std::uint8_t byte{0U}; byte < 8U; ++byte) {
+      word |= static_cast<std::uint64_t>(data[byte]) << (8U * byte);
+    }
+    crc = __crc32d(crc, word);
+    data += 8U;
+    length -= 8U;
+  }
+  for (std::size_t index{0U}; index < length; ++index) { crc = __crc32b(crc, data[index]); }
+  return crc;
+}
+#endif
+
+/**
+ * @brief       Function to update the CRC-16 register one byte at a time
+ */
+std::uint16_t Crc16Bytewise(std::uint16_t crc, std::uint8_t const *data, std::size_t length) noexcept {
+  for (std::size_t index{0U}; index < length; ++index) {
+    crc = static_cast<std::uint16_t>((crc << 8U) ^ kCrc16Tables[0U][(crc >> 8U) ^ data[index]]);
+  }
+  return crc;
+}
+
+/**
+ * @brief       Function to update the CRC-16 register eight bytes at a time
+ * @details     The register only affects the first two bytes of every step
+ */
+std::uint16_t Crc16SlicingBy8(std::uint16_t crc, std::uint8_t const *data, std::size_t length) noexcept {
+  while (length >= 8U) {
+    crc = static_cast<std::uint16_t>(
+        kCrc16Tables[7U][data[0U] ^ (crc >> 8U)] ^ kCrc16Tables[6U][data[1U] ^ (crc & 0xFFU)] ^
+        kCrc16Tables[5U][data[2U]] ^ kCrc16Tables[4U][data[3U]] ^ kCrc16Tables[3U][data[4U]] ^
+        kCrc16Tables[2U][data[5U]] ^ kCrc16Tables[1U][data[6U]] ^ kCrc16Tables[0U][data[7U]]);
+    data += 8U;
+    length -= 8U;
+  }
+  return Crc16Bytewise(crc, data, length);
+}
+
+/**
+ * @brief       Function to get the fastest CRC-32 kernel supported, detected once
+ * @return      The kernel
+ */
+Crc32Kernel GetFastestCrc32Kernel() noexcept {
+  static Crc32Kernel const kernel{Crc32::IsSupported(Crc32Kernel::kPclmul)      ? Crc32Kernel::kPclmul
+                                  : Crc32::IsSupported(Crc32Kernel::kArmv8Crc) ? Crc32Kernel::kArmv8Crc
+                                                                                : Crc32Kernel::kSlicingBy8};
+  return kernel;
+}
+}  // namespace
+
+Crc32::Crc32() noexcept : Crc32{GetFastestCrc32Kernel()} {}
+
+Crc32::Crc32(Crc32Kernel kernel) noexcept
+    : kernel_{IsSupported(kernel) ? kernel : Crc32Kernel::kSlicingBy8},
+      state_{0xFFFFFFFFU} {}
+
+void Crc32::Update(std::uint8_t const *data, std::size_t length) noexcept {
+  switch (kernel_) {
+#if defined(UTILITY_CHECKSUM_PCLMUL)
+    case Crc32Kernel::kPclmul:
+      state_ = Crc32Pclmul(state_, data, length);
+      break;
+#endif
+#if defined(UTILITY_CHECKSUM_ARMV8_CRC)
+    case Crc32Kernel::kArmv8Crc:
+      state_ = Crc32Armv8(state_, data, length);
+      break;
+#endif
+    default:
+      state_ = Crc32SlicingBy8(state_, data, length);
+      break;
+  }
+}
+
+bool Crc32::IsSupported(Crc32Kernel kernel) noexcept {
+  bool is_supported{kernel == Crc32Kernel::kSlicingBy8};
+#if defined(UTILITY_CHECKSUM_PCLMUL)
+  if (kernel == Crc32Kernel::kPclmul) {
+    is_supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+  }
+#endif
+#if defined(UTILITY_CHECKSUM_ARMV8_CRC)
+  if (kernel == Crc32Kernel::kArmv8Crc) { is_supported = (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0U; }
+#endif
+  return is_supported;
+}
+
+Crc16Ccitt::Crc16Ccitt(Crc16Kernel kernel) noexcept : kernel_{kernel}, state_{0xFFFFU} {}
+
+void Crc16Ccitt::Update(std::uint8_t const *data, std::size_t length) noexcept {
+  state_ = kernel_ == Crc16Kernel::kSlicingBy8 ? Crc16SlicingBy8(state_, data, length)
+                                               : Crc16Bytewise(state_, data, length);
+}
+
+}  // namespace checksum
+}  // namespace utility
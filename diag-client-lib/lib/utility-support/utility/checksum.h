@@ -0,0 +1,139 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_CHECKSUM_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_CHECKSUM_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utility {
+namespace checksum {
+
+/**
+ * @brief  Definitions of CRC32 kernels
+ */
+enum class Crc32Kernel : std::uint8_t {
+  kSlicingBy8 = 0U, /**< Portable table driven kernel processing 8 bytes per step */
+  kPclmul = 1U,     /**< x86 kernel folding 64 bytes per step with carry-less multiplication */
+  kArmv8Crc = 2U    /**< AArch64 kernel using the CRC32 instructions */
+};
+
+/**
+ * @brief  Definitions of CRC16 kernels
+ */
+enum class Crc16Kernel : std::uint8_t {
+  kBytewise = 0U,  /**< Table driven kernel processing 1 byte per step */
+  kSlicingBy8 = 1U /**< Table driven kernel processing 8 bytes per step */
+};
+
+/**
+ * @brief       CRC-32 as used by Ethernet and zlib
+ * @details     Reflected polynomial 0x04C11DB7, initial value and final xor 0xFFFFFFFF. The check value of "123456789"
+ *              is 0xCBF43926. The kernel is selected once on construction, hardware kernels are used when supported
+ *              by the processor at runtime.
+ */
+class Crc32 final {
+ public:
+  /**
+   * @brief         Constructs an instance of Crc32 with the fastest kernel supported
+   */
+  Crc32() noexcept;
+
+  /**
+   * @brief         Constructs an instance of Crc32
+   * @param[in]     kernel
+   *                The kernel used, the slicing-by-8 kernel is used if not supported
+   */
+  explicit Crc32(Crc32Kernel kernel) noexcept;
+
+  /**
+   * @brief         Function to continue the calculation with further data
+   * @param[in]     data
+   *                The pointer to data
+   * @param[in]     length
+   *                The number of bytes
+   */
+  void Update(std::uint8_t const *data, std::size_t length) noexcept;
+
+  /**
+   * @brief         Function to get the CRC of all data passed so far
+   * @return        The CRC value
+   */
+  std::uint32_t GetValue() const noexcept { return ~state_; }
+
+  /**
+   * @brief         Function to get the kernel used
+   * @return        The kernel
+   */
+  Crc32Kernel GetKernel() const noexcept { return kernel_; }
+
+  /**
+   * @brief         Function to check whether a kernel is supported by the processor
+   * @param[in]     kernel
+   *                The kernel checked
+   * @return        True if supported, otherwise False
+   */
+  static bool IsSupported(Crc32Kernel kernel) noexcept;
+
+ private:
+  /**
+   * @brief         Store the kernel
+   */
+  Crc32Kernel kernel_;
+
+  /**
+   * @brief         Store the CRC register before final xor
+   */
+  std::uint32_t state_;
+};
+
+/**
+ * @brief       CRC-16/CCITT-FALSE as used by AUTOSAR Crc_CalculateCRC16
+ * @details     Polynomial 0x1021 not reflected, initial value 0xFFFF and no final xor. The check value of "123456789"
+ *              is 0x29B1.
+ */
+class Crc16Ccitt final {
+ public:
+  /**
+   * @brief         Constructs an instance of Crc16Ccitt
+   * @param[in]     kernel
+   *                The kernel used
+   */
+  explicit Crc16Ccitt(Crc16Kernel kernel = Crc16Kernel::kSlicingBy8) noexcept;
+
+  /**
+   * @brief         Function to continue the calculation with further data
+   * @param[in]     data
+   *                The pointer to data
+   * @param[in]     length
+   *                The number of bytes
+   */
+  void Update(std::uint8_t const *data, std::size_t length) noexcept;
+
+  /**
+   * @brief         Function to get the CRC of all data passed so far
+   * @return        The CRC value
+   */
+  std::uint16_t GetValue() const noexcept { return state_; }
+
+ private:
+  /**
+   * @brief         Store the kernel
+   */
+  Crc16Kernel kernel_;
+
+  /**
+   * @brief         Store the CRC register
+   */
+  std::uint16_t state_;
+};
+
+}  // namespace checksum
+}  // namespace utility
+
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_CHECKSUM_H
@@ -22,39 +22,40 @@ template<typename ExecutorHandler>
 class Executor {
  public:
   // ctor
-  Executor() : exit_request_{false}, running_{false} {
-    thread_ = std::thread([&]() {
-      std::unique_lock<std::mutex> exit_lck(exit_mutex_lock_);
-      while (!exit_request_.load()) {
-        if (!running_.load()) { cond_var_.wait(exit_lck); }
-        if (running_) {
-          std::unique_lock<std::mutex> lck(mutex_lock_);
-          while (!queue_.empty()) {
-            auto func = queue_.front();
-            lck.unlock();
-            func();
-            lck.lock();
-            queue_.pop();
-          }
-          running_.store(false);
+  Executor() : queue_{}, mutex_lock_{}, thread_{}, cond_var_{}, exit_request_{false} {
+    thread_ = std::thread([this]() {
+      std::unique_lock<std::mutex> lck(mutex_lock_);
+      while (!exit_request_ || !queue_.empty()) {
+        // sleep until a job is queued or exit is requested, predicate protects against lost wake-up
+        cond_var_.wait(lck, [this]() { return exit_request_ || !queue_.empty(); });
+        // jobs queued before the exit request are still executed, so that no job is dropped
+        while (!queue_.empty()) {
+          ExecutorHandler func{std::move(queue_.front())};
+          queue_.pop();
+          lck.unlock();
+          func();
+          lck.lock();
         }
       }
     });
   }
 
-  // dtor
+  // dtor, waits until all queued jobs are executed
   ~Executor() {
-    exit_request_ = true;
-    running_ = false;
+    {
+      std::lock_guard<std::mutex> const lck(mutex_lock_);
+      exit_request_ = true;
+    }
     cond_var_.notify_one();
     thread_.join();
   }
 
   // function to add job to executor
   void AddExecute(ExecutorHandler executor_handler) {
-    std::unique_lock<std::mutex> lck(mutex_lock_);
-    queue_.push(std::move(executor_handler));
-    running_.store(true);
+    {
+      std::lock_guard<std::mutex> const lck(mutex_lock_);
+      queue_.push(std::move(executor_handler));
+    }
     cond_var_.notify_one();
   }
 
@@ -63,16 +64,12 @@ class Executor {
   std::queue<ExecutorHandler> queue_;
   // mutex to lock the critical section
   std::mutex mutex_lock_;
-  // mutex to lock the critical section
-  std::mutex exit_mutex_lock_;
   // threading var
   std::thread thread_;
   // conditional variable to block the thread
   std::condition_variable cond_var_;
   // flag to terminate the thread
-  std::atomic<bool> exit_request_;
-  // flag th start the thread
-  std::atomic<bool> running_;
+  bool exit_request_;
 };
 }  // namespace executor
 }  // namespace utility
@@ -10,5 +10,9 @@ constexpr std::string_view StripFilePath(std::string_view path) {
 }  // namespace details
 }  // namespace utility
 
-// Macro to get the file name during compile time
-#define FILE_NAME utility::details::StripFilePath(__FILE__)
+// Macro to get the file name during compile time, the constexpr variable forces evaluation at compile time
+#define FILE_NAME                                                                       \
+  []() noexcept {                                                                       \
+    constexpr std::string_view file_name{utility::details::StripFilePath(__FILE__)};    \
+    return file_name;                                                                   \
+  }()
@@ -0,0 +1,301 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/log_sink.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <utility>
+
+#include "utility/logger.h"
+
+namespace utility {
+namespace logger {
+namespace {
+
+/**
+ * @brief  Interval in which the background thread drains the ring buffers
+ */
+constexpr std::chrono::milliseconds kDrainInterval{10u};
+
+/**
+ * @brief  Store whether the sink accepts messages, cleared once the sink is destroyed
+ */
+std::atomic<bool> sink_running{false};
+}  // namespace
+
+/**
+ * @brief       Ring buffer holding the messages of one producing thread
+ * @details     Only the owning thread pushes and only the background thread pops, the indices are thus sufficient
+ *              for synchronization
+ */
+class LogSink::RingBuffer final {
+ public:
+  /**
+   * @brief  Message stored in the ring buffer
+   */
+  struct Record {
+    LogLevel log_level;
+    Context const *context;
+    std::string message;
+  };
+
+  /**
+   * @brief         Function to push a message, called by the owning thread
+   * @param[in]     record
+   *                The message
+   * @return        True if pushed, False if the ring buffer is full
+   */
+  bool Push(Record &&record) noexcept {
+    std::size_t const head{head_.load(std::memory_order_relaxed)};
+    if (head - tail_.load(std::memory_order_acquire) == kRingBufferCapacity) { return false; }
+    records_[head % kRingBufferCapacity] = std::move(record);
+    head_.store(head + 1u, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief         Function to pop all messages, called by the background thread
+   * @param[in]     func
+   *                The functor invoked with each message
+   */
+  template<typename Func>
+  void PopAll(Func &&func) noexcept {
+    std::size_t tail{tail_.load(std::memory_order_relaxed)};
+    std::size_t const head{head_.load(std::memory_order_acquire)};
+    for (; tail != head; tail++) {
+      Record &record{records_[tail % kRingBufferCapacity]};
+      func(record);
+      // release the memory of message in the producing thread on next push
+      record.message.clear();
+      tail_.store(tail + 1u, std::memory_order_release);
+    }
+  }
+
+  /**
+   * @brief         Function to check if all messages are popped
+   * @return        True if empty, otherwise False
+   */
+  bool IsEmpty() const noexcept {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief         Function to mark the owning thread as exited
+   */
+  void Close() noexcept { closed_.store(true, std::memory_order_release); }
+
+  /**
+   * @brief         Function to check if the owning thread has exited
+   * @return        True if exited, otherwise False
+   */
+  bool IsClosed() const noexcept { return closed_.load(std::memory_order_acquire); }
+
+ private:
+  /**
+   * @brief  Store the messages
+   */
+  std::array<Record, kRingBufferCapacity> records_{};
+
+  /**
+   * @brief  Index of next push, on separate cache line from pop index to avoid false sharing
+   */
+  alignas(64) std::atomic<std::size_t> head_{0u};
+
+  /**
+   * @brief  Index of next pop
+   */
+  alignas(64) std::atomic<std::size_t> tail_{0u};
+
+  /**
+   * @brief  Store whether the owning thread has exited
+   */
+  std::atomic<bool> closed_{false};
+};
+
+namespace {
+
+/**
+ * @brief       Owner of the ring buffer of one thread, marks the ring buffer closed on thread exit
+ */
+template<typename RingBuffer>
+class ThreadRingBuffer final {
+ public:
+  ~ThreadRingBuffer() noexcept {
+    if (ring_buffer) { ring_buffer->Close(); }
+  }
+
+  std::shared_ptr<RingBuffer> ring_buffer{};
+};
+
+/**
+ * @brief       Function to write a message to the dlt infrastructure
+ */
+#ifdef ENABLE_DLT_LOGGER
+void WriteDltMessage(LogLevel log_level, DltContext const &context, std::string const &message) {
+  DLT_LOG(const_cast<DltContext &>(context), static_cast<DltLogLevelType>(log_level),
+          DLT_CSTRING(message.c_str()));
+}
+#endif
+}  // namespace
+
+LogSink &LogSink::GetLogSink() noexcept {
+  static LogSink log_sink{};
+  return log_sink;
+}
+
+LogSink::LogSink() noexcept
+    : ring_buffers_{},
+      ring_buffers_mutex_{},
+#ifdef ENABLE_DLT_LOGGER
+      log_output_{LogOutput::kDlt},
+#else
+      log_output_{LogOutput::kConsole},
+#endif
+      log_file_{},
+      output_mutex_{},
+      batch_{},
+      dropped_count_{0u},
+      reported_dropped_count_{0u},
+      flush_requested_{0u},
+      flush_completed_{0u},
+      exit_request_{false},
+      mutex_{},
+      cond_var_{},
+      flush_cond_var_{},
+      thread_{} {
+  sink_running = true;
+  thread_ = utility::thread::Thread{"LogSink", [this]() { Run(); }};
+}
+
+LogSink::~LogSink() noexcept {
+  {
+    std::lock_guard<std::mutex> const lck{mutex_};
+    exit_request_ = true;
+  }
+  cond_var_.notify_all();
+  thread_.Join();
+  sink_running = false;
+}
+
+void LogSink::SetOutput(LogOutput log_output, std::string file_path) noexcept {
+  std::lock_guard<std::mutex> const lck{output_mutex_};
+  if (log_file_.is_open()) { log_file_.close(); }
+#ifndef ENABLE_DLT_LOGGER
+  if (log_output == LogOutput::kDlt) { log_output = LogOutput::kConsole; }
+#endif
+  if (log_output == LogOutput::kFile) {
+    log_file_.open(file_path, std::ios::out | std::ios::app);
+    if (!log_file_.is_open()) { log_output = LogOutput::kConsole; }
+  }
+  log_output_ = log_output;
+}
+
+bool LogSink::Push(LogLevel log_level, Context const &context, std::string message) noexcept {
+  bool pushed{false};
+  if (sink_running.load(std::memory_order_acquire)) {
+    pushed = GetThreadRingBuffer().Push(RingBuffer::Record{log_level, &context, std::move(message)});
+    if (!pushed) { dropped_count_.fetch_add(1u, std::memory_order_relaxed); }
+  } else {
+    // logging during static destruction after the sink is gone, write directly
+#ifdef ENABLE_DLT_LOGGER
+    WriteDltMessage(log_level, context, message);
+#else
+    std::cout << message << std::endl;
+#endif
+    pushed = true;
+  }
+  return pushed;
+}
+
+void LogSink::Flush() noexcept {
+  if (sink_running.load(std::memory_order_acquire)) {
+    std::unique_lock<std::mutex> lck{mutex_};
+    std::uint64_t const flush_request{++flush_requested_};
+    cond_var_.notify_all();
+    flush_cond_var_.wait(lck, [this, flush_request]() {
+      return (flush_completed_ >= flush_request) || exit_request_;
+    });
+  }
+}
+
+LogSink::RingBuffer &LogSink::GetThreadRingBuffer() noexcept {
+  thread_local ThreadRingBuffer<RingBuffer> thread_ring_buffer{};
+  if (!thread_ring_buffer.ring_buffer) {
+    thread_ring_buffer.ring_buffer = std::make_shared<RingBuffer>();
+    std::lock_guard<std::mutex> const lck{ring_buffers_mutex_};
+    ring_buffers_.emplace_back(thread_ring_buffer.ring_buffer);
+  }
+  return *thread_ring_buffer.ring_buffer;
+}
+
+void LogSink::Run() noexcept {
+  bool exit_request{false};
+  while (!exit_request) {
+    std::uint64_t flush_request{};
+    {
+      std::unique_lock<std::mutex> lck{mutex_};
+      cond_var_.wait_for(lck, kDrainInterval,
+                         [this]() { return exit_request_ || (flush_requested_ != flush_completed_); });
+      exit_request = exit_request_;
+      flush_request = flush_requested_;
+    }
+    // messages pushed before the flush request are visible now
+    Drain();
+    {
+      std::lock_guard<std::mutex> const lck{mutex_};
+      flush_completed_ = flush_request;
+    }
+    flush_cond_var_.notify_all();
+  }
+}
+
+void LogSink::Drain() noexcept {
+  std::vector<std::shared_ptr<RingBuffer>> ring_buffers{};
+  {
+    std::lock_guard<std::mutex> const lck{ring_buffers_mutex_};
+    // forget the ring buffers of exited threads once all their messages are written
+    ring_buffers_.erase(std::remove_if(ring_buffers_.begin(), ring_buffers_.end(),
+                                       [](std::shared_ptr<RingBuffer> const &ring_buffer) {
+                                         return ring_buffer->IsClosed() && ring_buffer->IsEmpty();
+                                       }),
+                        ring_buffers_.end());
+    ring_buffers = ring_buffers_;
+  }
+
+  std::lock_guard<std::mutex> const lck{output_mutex_};
+  for (std::shared_ptr<RingBuffer> const &ring_buffer: ring_buffers) {
+    ring_buffer->PopAll([this](RingBuffer::Record const &record) {
+#ifdef ENABLE_DLT_LOGGER
+      if (log_output_ == LogOutput::kDlt) {
+        WriteDltMessage(record.log_level, *record.context, record.message);
+        return;
+      }
+#endif
+      batch_.append(record.message).push_back('\n');
+    });
+  }
+  std::uint64_t const dropped_count{dropped_count_.load(std::memory_order_relaxed)};
+  if (dropped_count != reported_dropped_count_) {
+    batch_.append(std::to_string(dropped_count - reported_dropped_count_))
+        .append(" log messages dropped\n");
+    reported_dropped_count_ = dropped_count;
+  }
+  if (!batch_.empty()) {
+    std::ostream &output{log_output_ == LogOutput::kFile ? static_cast<std::ostream &>(log_file_)
+                                                         : std::cout};
+    output.write(batch_.data(), static_cast<std::streamsize>(batch_.size()));
+    output.flush();
+    batch_.clear();
+  }
+}
+
+}  // namespace logger
+}  // namespace utility
@@ -0,0 +1,211 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_SINK_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_SINK_H
+
+#ifdef ENABLE_DLT_LOGGER
+#include <dlt/dlt.h>
+#endif
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utility/thread.h"
+
+namespace utility {
+namespace logger {
+
+/**
+ * @brief       Forward declaration of log level
+ */
+enum class LogLevel : std::uint8_t;
+
+/**
+ * @brief       Destination of the log messages written by the sink
+ */
+enum class LogOutput : std::uint8_t { kConsole = 0U, kFile, kDlt };
+
+/**
+ * @brief       Asynchronous sink of all log messages
+ * @details     Producers push the formatted messages into a lock-free ring buffer owned by the calling thread, a
+ *              background thread drains all ring buffers and writes the messages batch-wise to the configured
+ *              output. Producers thus never wait for terminal, disk or dlt. Messages are dropped and counted when a
+ *              ring buffer is full.
+ */
+class LogSink final {
+ public:
+  /**
+   * @brief  Type alias of the context of the logger the message belongs to
+   */
+#ifdef ENABLE_DLT_LOGGER
+  using Context = DltContext;
+#else
+  using Context = std::string;
+#endif
+
+  /**
+   * @brief  Number of messages each producing thread can buffer
+   */
+  static constexpr std::size_t kRingBufferCapacity{1024u};
+
+ public:
+  /**
+   * @brief         Function to get the sink, the background thread is started on first call
+   * @return        The reference to sink
+   */
+  static LogSink &GetLogSink() noexcept;
+
+  /**
+   * @brief  Deleted copy assignment and copy constructor
+   */
+  LogSink(const LogSink &other) noexcept = delete;
+  LogSink &operator=(const LogSink &other) noexcept = delete;
+
+  /**
+   * @brief  Deleted move assignment and move constructor
+   */
+  LogSink(LogSink &&other) noexcept = delete;
+  LogSink &operator=(LogSink &&other) noexcept = delete;
+
+  /**
+   * @brief         Function to select the output of the messages
+   * @details       Dlt is only available when built with dlt, console is used instead. Console is used as well if
+   *                the file cannot be opened.
+   * @param[in]     log_output
+   *                The output
+   * @param[in]     file_path
+   *                The path of the log file, only used with file output
+   */
+  void SetOutput(LogOutput log_output, std::string file_path) noexcept;
+
+  /**
+   * @brief         Function to push a message into the ring buffer of the calling thread
+   * @param[in]     log_level
+   *                The log level of the message
+   * @param[in]     context
+   *                The context of the logger, must outlive the message
+   * @param[in]     message
+   *                The formatted message
+   * @return        True if buffered, False if dropped due to full ring buffer
+   */
+  bool Push(LogLevel log_level, Context const &context, std::string message) noexcept;
+
+  /**
+   * @brief         Function to wait until all messages pushed before are written
+   */
+  void Flush() noexcept;
+
+  /**
+   * @brief         Function to get the number of messages dropped due to full ring buffers
+   * @return        The number of dropped messages
+   */
+  std::uint64_t GetDroppedCount() const noexcept { return dropped_count_.load(std::memory_order_relaxed); }
+
+ private:
+  /**
+   * @brief  Forward declaration of the single producer single consumer ring buffer
+   */
+  class RingBuffer;
+
+  /**
+   * @brief         Constructs an instance of LogSink and start the background thread
+   */
+  LogSink() noexcept;
+
+  /**
+   * @brief         Destruct an instance of LogSink, writing the remaining messages
+   */
+  ~LogSink() noexcept;
+
+  /**
+   * @brief         Function to get the ring buffer of the calling thread, registered on first use
+   * @return        The reference to ring buffer
+   */
+  RingBuffer &GetThreadRingBuffer() noexcept;
+
+  /**
+   * @brief         Function run by the background thread
+   */
+  void Run() noexcept;
+
+  /**
+   * @brief         Function to write all buffered messages to the output
+   */
+  void Drain() noexcept;
+
+  /**
+   * @brief  Store the ring buffers of all producing threads
+   */
+  std::vector<std::shared_ptr<RingBuffer>> ring_buffers_;
+
+  /**
+   * @brief  Mutex to protect the registration of ring buffers
+   */
+  std::mutex ring_buffers_mutex_;
+
+  /**
+   * @brief  Store the output
+   */
+  LogOutput log_output_;
+
+  /**
+   * @brief  Store the log file
+   */
+  std::ofstream log_file_;
+
+  /**
+   * @brief  Mutex to protect the output
+   */
+  std::mutex output_mutex_;
+
+  /**
+   * @brief  Store the batch of messages written at once to console or file
+   */
+  std::string batch_;
+
+  /**
+   * @brief  Store the number of dropped messages
+   */
+  std::atomic<std::uint64_t> dropped_count_;
+
+  /**
+   * @brief  Store the number of dropped messages already reported
+   */
+  std::uint64_t reported_dropped_count_;
+
+  /**
+   * @brief  Store the number of requested and completed flushes
+   */
+  std::uint64_t flush_requested_;
+  std::uint64_t flush_completed_;
+
+  /**
+   * @brief  Store the exit request of background thread
+   */
+  bool exit_request_;
+
+  /**
+   * @brief  Mutex and conditional variable to wake up the background thread and flushing threads
+   */
+  std::mutex mutex_;
+  std::condition_variable cond_var_;
+  std::condition_variable flush_cond_var_;
+
+  /**
+   * @brief  Store the background thread
+   */
+  utility::thread::Thread thread_;
+};
+}  // namespace logger
+}  // namespace utility
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOG_SINK_H
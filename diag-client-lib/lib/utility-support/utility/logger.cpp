@@ -37,6 +37,8 @@ Logger::Logger(std::string_view app_id, std::string_view context_id)
 }
 
 Logger::~Logger() {
+  // messages still buffered refer to the context, write them before it is unregistered
+  LogSink::GetLogSink().Flush();
 #ifdef ENABLE_DLT_LOGGER
   DLT_UNREGISTER_CONTEXT(contxt_);
   if (registration_with_app_id_) { DLT_UNREGISTER_APP(); }
@@ -8,10 +8,9 @@
 #ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOGGER_H
 #define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_LOGGER_H
 
-#ifdef ENABLE_DLT_LOGGER
-#include <dlt/dlt.h>
-#endif
-#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -19,16 +18,44 @@
 #include <utility>
 
 #include "utility/file_path.h"
+#include "utility/log_sink.h"
 
 #define UNUSED_PARAM(expr) static_cast<void>(expr)
 
+/**
+ * @brief       Most verbose log level compiled in, messages above are removed at compile time
+ * @details     Values as of LogLevel, set with cmake cache entry "BUILD_LOG_LEVEL"
+ */
+#ifndef LOGGER_MAX_LOG_LEVEL
+#define LOGGER_MAX_LOG_LEVEL 6
+#endif
+
 namespace utility {
 namespace logger {
 
+/**
+ * @brief       Severity of log messages, ordered from least to most verbose
+ */
+enum class LogLevel : std::uint8_t {
+  kOff = 0U,
+  kFatal = 1U,
+  kError = 2U,
+  kWarn = 3U,
+  kInfo = 4U,
+  kDebug = 5U,
+  kVerbose = 6U
+};
+
+/**
+ * @brief       Most verbose log level compiled in
+ */
+constexpr LogLevel kMaxLogLevel{static_cast<LogLevel>(LOGGER_MAX_LOG_LEVEL)};
+
 /**
  * @brief       Logger class that is used to log Dlt messages from the component
  * @details     This class uses COVESA DLT infrastructure to send message to DLT. Also the class does not log dlt message
- *              if "ENABLE_DLT_LOGGER" cmake flag is set to OFF
+ *              if "ENABLE_DLT_LOGGER" cmake flag is set to OFF. The messages are formatted in the calling thread and
+ *              written asynchronously by the LogSink.
  */
 class Logger final {
  public:
@@ -48,11 +75,7 @@ class Logger final {
   template<typename Func>
   auto LogFatal(const std::string_view file_name, int line_no, const std::string_view func_name,
                 Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_FATAL, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kFatal>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
   /**
@@ -71,11 +94,8 @@ class Logger final {
   template<typename Func>
   auto LogFatalAndTerminate(const std::string_view file_name, int line_no,
                             const std::string_view func_name, Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_FATAL, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kFatal>(file_name, func_name, line_no, std::forward<Func>(func));
+    LogSink::GetLogSink().Flush();
     std::abort();  // abort in case of fatal issue
   }
 
@@ -95,11 +115,7 @@ class Logger final {
   template<typename Func>
   auto LogError(const std::string_view file_name, int line_no, const std::string_view func_name,
                 Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_ERROR, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kError>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
   /**
@@ -118,11 +134,7 @@ class Logger final {
   template<typename Func>
   auto LogWarn(const std::string_view file_name, int line_no, const std::string_view func_name,
                Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_WARN, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kWarn>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
   /**
@@ -141,11 +153,7 @@ class Logger final {
   template<typename Func>
   auto LogInfo(const std::string_view file_name, int line_no, const std::string_view func_name,
                Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_INFO, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kInfo>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
   /**
@@ -164,11 +172,7 @@ class Logger final {
   template<typename Func>
   auto LogDebug(const std::string_view file_name, int line_no, const std::string_view func_name,
                 Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_DEBUG, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kDebug>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
   /**
@@ -187,14 +191,34 @@ class Logger final {
   template<typename Func>
   auto LogVerbose(const std::string_view file_name, int line_no, const std::string_view func_name,
                   Func &&func) noexcept -> void {
-#ifdef ENABLE_DLT_LOGGER
-    LogDltMessage(DLT_LOG_VERBOSE, file_name, func_name, line_no, std::forward<Func>(func));
-#else
-    LogMessageToStdOutput(file_name, func_name, line_no, std::forward<Func>(func));
-#endif
+    LogMessage<LogLevel::kVerbose>(file_name, func_name, line_no, std::forward<Func>(func));
   }
 
  public:
+  /**
+   * @brief       Set the most verbose log level logged at runtime by all loggers
+   * @details     Messages above the level are dropped before their functor is invoked
+   * @param[in]   log_level
+   *              The log level
+   */
+  static void SetLogLevel(LogLevel log_level) noexcept { log_level_ = log_level; }
+
+  /**
+   * @brief       Get the most verbose log level logged at runtime
+   * @return      The log level
+   */
+  static LogLevel GetLogLevel() noexcept { return log_level_; }
+
+  /**
+   * @brief       Check whether messages of the log level are logged
+   * @param[in]   log_level
+   *              The log level
+   * @return      True if logged, otherwise False
+   */
+  static bool IsLogLevelEnabled(LogLevel log_level) noexcept {
+    return (log_level <= kMaxLogLevel) && (log_level <= log_level_.load(std::memory_order_relaxed));
+  }
+
   /**
    * @brief       Construct an instance of Logger
    * @param[in]   context_id
@@ -218,32 +242,11 @@ class Logger final {
 
  private:
   /**
-   * @brief       Function to create the final logging message
-   * @tparam      Func
-   *              The functor type
-   * @param[in]   file_name
-   *              The file name
-   * @param[in]   func_name
-   *              The function name
-   * @param[in]   line_no
-   *              The line number
-   * @param[in]   func
-   *              The functor which gets invoked
-   */
-  template<typename Func>
-  auto CreateLoggingMessage(const std::string_view file_name,
-                            const std::string_view /* func_name */, int line_no,
-                            Func &&func) noexcept -> std::stringstream {
-    std::stringstream msg{};
-    func(msg);
-    msg << " [" << file_name << ":" << line_no << "]";
-    return msg;
-  }
-
-  /**
-   * @brief       Function to send the messages to dlt infrastructure
+   * @brief       Function to log message if the log level is compiled in and enabled at runtime
    * @tparam      log_level
    *              The log level
+   * @tparam      Func
+   *              The functor type
    * @param[in]   file_name
    *              The file name
    * @param[in]   func_name
@@ -253,22 +256,27 @@ class Logger final {
    * @param[in]   func
    *              The functor which gets invoked
    */
-#ifdef ENABLE_DLT_LOGGER
-  template<typename Func>
-  void LogDltMessage(DltLogLevelType log_level, const std::string_view file_name,
-                     const std::string_view func_name, int line_no, Func &&func) {
-    DLT_LOG(
-        contxt_, log_level,
-        DLT_CSTRING(CreateLoggingMessage(file_name, func_name, line_no, std::forward<Func>(func))
-                        .str()
-                        .c_str()));
+  template<LogLevel log_level, typename Func>
+  void LogMessage(const std::string_view file_name, const std::string_view func_name, int line_no,
+                  Func &&func) noexcept {
+    if constexpr (log_level <= kMaxLogLevel) {
+      if (IsLogLevelEnabled(log_level)) {
+        LogSink::GetLogSink().Push(
+            log_level, contxt_,
+            CreateLoggingMessage(file_name, func_name, line_no, std::forward<Func>(func)).str());
+      }
+    } else {
+      UNUSED_PARAM(file_name);
+      UNUSED_PARAM(func_name);
+      UNUSED_PARAM(line_no);
+      UNUSED_PARAM(func);
+    }
   }
-#endif
 
   /**
-   * @brief       Function to send the messages to standard output
+   * @brief       Function to create the final logging message
    * @tparam      Func
-   *              The logging functor to be executed
+   *              The functor type
    * @param[in]   file_name
    *              The file name
    * @param[in]   func_name
@@ -279,10 +287,13 @@ class Logger final {
    *              The functor which gets invoked
    */
   template<typename Func>
-  void LogMessageToStdOutput(const std::string_view file_name, const std::string_view func_name,
-                             int line_no, Func &&func) {
-    std::cout << CreateLoggingMessage(file_name, func_name, line_no, std::forward<Func>(func)).str()
-              << std::endl;
+  auto CreateLoggingMessage(const std::string_view file_name,
+                            const std::string_view /* func_name */, int line_no,
+                            Func &&func) noexcept -> std::stringstream {
+    std::stringstream msg{};
+    func(msg);
+    msg << " [" << file_name << ":" << line_no << "]";
+    return msg;
   }
 
 #ifdef ENABLE_DLT_LOGGER
@@ -299,6 +310,9 @@ class Logger final {
 
   // store the information about registration with app id
   bool registration_with_app_id_;
+
+  // Stores the most verbose log level logged at runtime, shared by all loggers
+  static inline std::atomic<LogLevel> log_level_{LogLevel::kVerbose};
 };
 }  // namespace logger
 }  // namespace utility
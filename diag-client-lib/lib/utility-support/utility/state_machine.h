@@ -0,0 +1,161 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATE_MACHINE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATE_MACHINE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace utility {
+namespace state {
+
+/**
+ * @brief       Table of the allowed transitions between states
+ * @details     Built at compile time from the list of allowed (from, to) pairs. States must be enumerated
+ *              contiguously starting with zero.
+ * @tparam      EnumState
+ *              The enumeration of states
+ * @tparam      kNumberOfStates
+ *              The number of states, at most 32
+ */
+template<typename EnumState, std::size_t kNumberOfStates>
+class TransitionTable final {
+  static_assert(kNumberOfStates <= 32u, "Transition table supports at most 32 states");
+
+ public:
+  /**
+   * @brief  Type alias for one allowed transition from first to second state
+   */
+  using Transition = std::pair<EnumState, EnumState>;
+
+  /**
+   * @brief         Constructs the table from the allowed transitions
+   * @param[in]     transitions
+   *                The allowed transitions
+   */
+  template<std::size_t kNumberOfTransitions>
+  constexpr explicit TransitionTable(Transition const (&transitions)[kNumberOfTransitions]) noexcept
+      : allowed_states_{} {
+    for (Transition const &transition: transitions) {
+      allowed_states_[ToIndex(transition.first)] |=
+          (std::uint32_t{1u} << ToIndex(transition.second));
+    }
+  }
+
+  /**
+   * @brief         Function to check if the transition is allowed
+   * @param[in]     from_state
+   *                The current state
+   * @param[in]     to_state
+   *                The new state
+   * @return        True if allowed, otherwise False
+   */
+  constexpr bool IsAllowed(EnumState from_state, EnumState to_state) const noexcept {
+    return (allowed_states_[ToIndex(from_state)] & (std::uint32_t{1u} << ToIndex(to_state))) != 0u;
+  }
+
+ private:
+  /**
+   * @brief         Function to get the index of state
+   */
+  static constexpr std::size_t ToIndex(EnumState state) noexcept {
+    return static_cast<std::size_t>(state);
+  }
+
+  /**
+   * @brief  Store the states reachable from each state as bit mask
+   */
+  std::array<std::uint32_t, kNumberOfStates> allowed_states_;
+};
+
+/**
+ * @brief       Lock-free state machine checking transitions against a compile time table
+ * @details     The active state is a single atomic value, reading it takes no lock. Transitions are applied with
+ *              compare-exchange, so concurrent transitions from the same state are decided for exactly one caller.
+ * @tparam      EnumState
+ *              The enumeration of states
+ * @tparam      kTransitionTable
+ *              The transition table with static storage duration
+ */
+template<typename EnumState, auto const &kTransitionTable>
+class StateMachine final {
+ public:
+  /**
+   * @brief         Constructs an instance of StateMachine
+   * @param[in]     initial_state
+   *                The state to start in
+   */
+  constexpr explicit StateMachine(EnumState initial_state) noexcept : state_{initial_state} {}
+
+  /**
+   * @brief         Deleted copy assignment and copy constructor
+   */
+  StateMachine(const StateMachine &other) noexcept = delete;
+  StateMachine &operator=(const StateMachine &other) noexcept = delete;
+
+  /**
+   * @brief         Deleted move assignment and move constructor
+   */
+  StateMachine(StateMachine &&other) noexcept = delete;
+  StateMachine &operator=(StateMachine &&other) noexcept = delete;
+
+  /**
+   * @brief         Destructs an instance of StateMachine
+   */
+  ~StateMachine() noexcept = default;
+
+  /**
+   * @brief         Function to get the active state
+   * @return        The active state
+   */
+  EnumState GetState() const noexcept { return state_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief         Function to move from the expected state into the new state
+   * @param[in]     expected_state
+   *                The state expected to be active
+   * @param[in]     new_state
+   *                The new state
+   * @return        True if the expected state was active and the transition is allowed, otherwise False
+   */
+  bool TransitionTo(EnumState expected_state, EnumState new_state) noexcept {
+    return kTransitionTable.IsAllowed(expected_state, new_state) &&
+           state_.compare_exchange_strong(expected_state, new_state, std::memory_order_acq_rel,
+                                          std::memory_order_acquire);
+  }
+
+  /**
+   * @brief         Function to move from the active state into the new state
+   * @param[in]     new_state
+   *                The new state
+   * @return        True if the transition from the active state is allowed, otherwise False
+   */
+  bool TransitionTo(EnumState new_state) noexcept {
+    EnumState current_state{state_.load(std::memory_order_acquire)};
+    bool transitioned{false};
+    while (!transitioned && kTransitionTable.IsAllowed(current_state, new_state)) {
+      transitioned = state_.compare_exchange_weak(current_state, new_state,
+                                                  std::memory_order_acq_rel,
+                                                  std::memory_order_acquire);
+    }
+    return transitioned;
+  }
+
+ private:
+  /**
+   * @brief  Store the active state
+   */
+  std::atomic<EnumState> state_;
+};
+
+}  // namespace state
+}  // namespace utility
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_STATE_MACHINE_H
@@ -0,0 +1,295 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "utility/timer_service.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace utility {
+namespace timer {
+namespace {
+
+/**
+ * @brief       Function to build the timer identifier
+ * @param[in]   index
+ *              The index of timer
+ * @param[in]   generation
+ *              The generation of timer, incremented on every reuse of the index
+ * @return      The timer identifier
+ */
+constexpr TimerService::TimerId ToTimerId(std::uint32_t index, std::uint32_t generation) noexcept {
+  return (static_cast<TimerService::TimerId>(generation) << 32u) | index;
+}
+
+/**
+ * @brief       Function to get the index of timer from its identifier
+ */
+constexpr std::uint32_t ToIndex(TimerService::TimerId timer_id) noexcept {
+  return static_cast<std::uint32_t>(timer_id & 0xFFFFFFFFu);
+}
+
+/**
+ * @brief       Function to get the generation of timer from its identifier
+ */
+constexpr std::uint32_t ToGeneration(TimerService::TimerId timer_id) noexcept {
+  return static_cast<std::uint32_t>(timer_id >> 32u);
+}
+}  // namespace
+
+TimerService &TimerService::GetTimerService() noexcept {
+  static TimerService timer_service{Clock::now()};
+  return timer_service;
+}
+
+TimerService::TimerService(Clock::time_point start_time) noexcept
+    : start_time_{start_time},
+      timers_{},
+      free_timers_{},
+      levels_{},
+      current_tick_{0u},
+      wake_up_tick_{kNoTick},
+      armed_timers_{0u},
+      running_timer_id_{kInvalidTimerId},
+      exit_request_{false},
+      mutex_{},
+      cond_var_{},
+      callback_cond_var_{},
+      thread_id_{},
+      thread_{} {
+  for (Level &level: levels_) {
+    level.slots.fill(kNoTimer);
+    level.occupied_slots = 0u;
+  }
+  thread_ = utility::thread::Thread{"TimerService", [this]() { Run(); }};
+}
+
+TimerService::~TimerService() noexcept {
+  {
+    std::lock_guard<std::mutex> const lck{mutex_};
+    exit_request_ = true;
+  }
+  cond_var_.notify_all();
+  thread_.Join();
+}
+
+auto TimerService::Arm(std::chrono::milliseconds timeout, TimeoutCallback timeout_callback) noexcept
+    -> TimerId {
+  std::uint64_t const timeout_ticks{static_cast<std::uint64_t>(
+      std::clamp(timeout, std::chrono::milliseconds{0}, kMaxTimeout).count())};
+  bool wake_up{false};
+  TimerId timer_id{kInvalidTimerId};
+  {
+    std::lock_guard<std::mutex> const lck{mutex_};
+    std::uint32_t index{};
+    if (free_timers_.empty()) {
+      index = static_cast<std::uint32_t>(timers_.size());
+      timers_.emplace_back(Timer{{}, 0u, 0u, kNoTimer, kNoTimer, 0u, 0u, TimerState::kFree});
+    } else {
+      index = free_timers_.back();
+      free_timers_.pop_back();
+    }
+    if (armed_timers_ == 0u) {
+      // the wheel is not advanced while empty, catch up so that the expiry is not capped in the past
+      current_tick_ = std::max(current_tick_, GetCurrentTick());
+    }
+    Timer &timer{timers_[index]};
+    timer.callback = std::move(timeout_callback);
+    // expire no earlier than the next tick, also when the wheel lags behind the clock
+    timer.expiry_tick = std::max(GetCurrentTick() + timeout_ticks, current_tick_ + 1u);
+    // keep the expiry within the range covered by the wheel
+    timer.expiry_tick = std::min(timer.expiry_tick,
+                                 current_tick_ + static_cast<std::uint64_t>(kMaxTimeout.count()));
+    timer.generation++;
+    timer.state = TimerState::kArmed;
+    Insert(index);
+    armed_timers_++;
+    timer_id = ToTimerId(index, timer.generation);
+    wake_up = timer.expiry_tick < wake_up_tick_;
+  }
+  if (wake_up) { cond_var_.notify_all(); }
+  return timer_id;
+}
+
+bool TimerService::Cancel(TimerId timer_id) noexcept {
+  bool cancelled{false};
+  std::uint32_t const index{ToIndex(timer_id)};
+  std::unique_lock<std::mutex> lck{mutex_};
+  if (timer_id == kInvalidTimerId) {
+    // never armed, matches the running timer id while no callback is invoked
+  } else if (running_timer_id_ == timer_id) {
+    // the index is released before the callback is invoked and may already be reused by another timer
+    if (std::this_thread::get_id() != thread_id_) {
+      // wait for the callback to return
+      callback_cond_var_.wait(lck, [this, timer_id]() { return running_timer_id_ != timer_id; });
+    } else {
+      // cancelled from a callback
+    }
+  } else if ((index < timers_.size()) && (timers_[index].generation == ToGeneration(timer_id))) {
+    Timer &timer{timers_[index]};
+    if (timer.state == TimerState::kArmed) {
+      Unlink(index);
+      armed_timers_--;
+      Release(index);
+      cancelled = true;
+    } else if (timer.state == TimerState::kExpired) {
+      // expired but callback not yet invoked
+      Release(index);
+      cancelled = true;
+    } else {
+      // callback already returned
+    }
+  }
+  return cancelled;
+}
+
+std::uint64_t TimerService::GetCurrentTick() const noexcept {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start_time_).count());
+}
+
+void TimerService::Insert(std::uint32_t index) noexcept {
+  Timer &timer{timers_[index]};
+  std::uint64_t const delta{timer.expiry_tick - current_tick_};
+  // select the lowest level covering the remaining time
+  std::uint32_t level_index{0u};
+  while ((level_index < kNumberOfLevels - 1u) &&
+         (delta >= (std::uint64_t{1u} << (kSlotBits * (level_index + 1u))))) {
+    level_index++;
+  }
+  auto const slot_index{
+      static_cast<std::uint32_t>((timer.expiry_tick >> (kSlotBits * level_index)) & kSlotMask)};
+  Level &level{levels_[level_index]};
+  timer.level = static_cast<std::uint8_t>(level_index);
+  timer.slot = static_cast<std::uint8_t>(slot_index);
+  timer.previous = kNoTimer;
+  timer.next = level.slots[slot_index];
+  if (timer.next != kNoTimer) { timers_[timer.next].previous = index; }
+  level.slots[slot_index] = index;
+  level.occupied_slots |= (std::uint64_t{1u} << slot_index);
+}
+
+void TimerService::Unlink(std::uint32_t index) noexcept {
+  Timer &timer{timers_[index]};
+  Level &level{levels_[timer.level]};
+  if (timer.previous != kNoTimer) {
+    timers_[timer.previous].next = timer.next;
+  } else {
+    level.slots[timer.slot] = timer.next;
+  }
+  if (timer.next != kNoTimer) { timers_[timer.next].previous = timer.previous; }
+  if (level.slots[timer.slot] == kNoTimer) {
+    level.occupied_slots &= ~(std::uint64_t{1u} << timer.slot);
+  }
+  timer.previous = kNoTimer;
+  timer.next = kNoTimer;
+}
+
+void TimerService::Release(std::uint32_t index) noexcept {
+  Timer &timer{timers_[index]};
+  timer.callback = nullptr;
+  timer.state = TimerState::kFree;
+  free_timers_.emplace_back(index);
+}
+
+void TimerService::AdvanceTick(std::vector<TimerId> &expired_timers) noexcept {
+  current_tick_++;
+  // move the timers of the higher levels down whenever the level below wraps around, highest level first
+  for (std::uint32_t level_index{kNumberOfLevels - 1u}; level_index > 0u; level_index--) {
+    if ((current_tick_ & ((std::uint64_t{1u} << (kSlotBits * level_index)) - 1u)) == 0u) {
+      Level &level{levels_[level_index]};
+      auto const slot_index{
+          static_cast<std::uint32_t>((current_tick_ >> (kSlotBits * level_index)) & kSlotMask)};
+      std::uint32_t index{level.slots[slot_index]};
+      level.slots[slot_index] = kNoTimer;
+      level.occupied_slots &= ~(std::uint64_t{1u} << slot_index);
+      while (index != kNoTimer) {
+        std::uint32_t const next{timers_[index].next};
+        Insert(index);
+        index = next;
+      }
+    }
+  }
+  // expire all timers of the current slot
+  Level &level{levels_[0u]};
+  auto const slot_index{static_cast<std::uint32_t>(current_tick_ & kSlotMask)};
+  std::uint32_t index{level.slots[slot_index]};
+  level.slots[slot_index] = kNoTimer;
+  level.occupied_slots &= ~(std::uint64_t{1u} << slot_index);
+  while (index != kNoTimer) {
+    Timer &timer{timers_[index]};
+    std::uint32_t const next{timer.next};
+    timer.previous = kNoTimer;
+    timer.next = kNoTimer;
+    timer.state = TimerState::kExpired;
+    armed_timers_--;
+    expired_timers.emplace_back(ToTimerId(index, timer.generation));
+    index = next;
+  }
+}
+
+std::uint64_t TimerService::GetNextWakeUpTick() const noexcept {
+  std::uint64_t wake_up_tick{kNoTick};
+  if (armed_timers_ != 0u) {
+    // next occupied slot of the lowest level before it wraps around, otherwise the wrap around itself
+    std::uint64_t const slot_index{current_tick_ & kSlotMask};
+    std::uint64_t const later_slots{slot_index == kSlotMask
+                                        ? 0u
+                                        : levels_[0u].occupied_slots &
+                                              (~std::uint64_t{0u} << (slot_index + 1u))};
+    if (later_slots != 0u) {
+      std::uint64_t next_slot{slot_index + 1u};
+      while ((later_slots & (std::uint64_t{1u} << next_slot)) == 0u) { next_slot++; }
+      wake_up_tick = (current_tick_ - slot_index) + next_slot;
+    } else {
+      wake_up_tick = (current_tick_ - slot_index) + kNumberOfSlots;
+    }
+  }
+  return wake_up_tick;
+}
+
+void TimerService::Run() noexcept {
+  std::vector<TimerId> expired_timers{};
+  std::unique_lock<std::mutex> lck{mutex_};
+  thread_id_ = std::this_thread::get_id();
+  while (!exit_request_) {
+    std::uint64_t const tick{GetCurrentTick()};
+    if (armed_timers_ == 0u) {
+      // nothing to expire, skip the ticks elapsed while idle instead of advancing the wheel one by one
+      current_tick_ = std::max(current_tick_, tick);
+    }
+    while (current_tick_ < tick) { AdvanceTick(expired_timers); }
+    // invoke the callbacks without lock, timers cancelled meanwhile are skipped
+    for (TimerId const timer_id: expired_timers) {
+      Timer &timer{timers_[ToIndex(timer_id)]};
+      if ((timer.generation == ToGeneration(timer_id)) && (timer.state == TimerState::kExpired)) {
+        TimeoutCallback callback{std::move(timer.callback)};
+        Release(ToIndex(timer_id));
+        running_timer_id_ = timer_id;
+        lck.unlock();
+        callback();
+        lck.lock();
+        running_timer_id_ = kInvalidTimerId;
+        callback_cond_var_.notify_all();
+      }
+    }
+    expired_timers.clear();
+    wake_up_tick_ = GetNextWakeUpTick();
+    if (wake_up_tick_ == kNoTick) {
+      cond_var_.wait(lck, [this]() { return exit_request_ || (armed_timers_ != 0u); });
+    } else if (wake_up_tick_ > GetCurrentTick()) {
+      static_cast<void>(
+          cond_var_.wait_until(lck, start_time_ + std::chrono::milliseconds{wake_up_tick_}));
+    } else {
+      // already due
+    }
+  }
+}
+
+}  // namespace timer
+}  // namespace utility
@@ -0,0 +1,288 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#ifndef DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TIMER_SERVICE_H
+#define DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TIMER_SERVICE_H
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utility/thread.h"
+
+namespace utility {
+namespace timer {
+
+/**
+ * @brief       Process wide timer service invoking callbacks on expiry
+ * @details     Timers are kept in a hierarchical timing wheel with a resolution of one millisecond, which makes arming
+ *              and cancellation O(1) independent of the number of running timers. A single background thread advances
+ *              the wheel and invokes the callbacks of expired timers, callbacks must therefore return quickly.
+ */
+class TimerService final {
+ public:
+  /**
+   * @brief  Type alias for the clock used for time monitoring
+   */
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief  Type alias for the callback invoked on expiry
+   */
+  using TimeoutCallback = std::function<void()>;
+
+  /**
+   * @brief  Type alias for the identifier of an armed timer, zero never identifies a timer
+   */
+  using TimerId = std::uint64_t;
+
+  /**
+   * @brief  Identifier never returned for an armed timer
+   */
+  static constexpr TimerId kInvalidTimerId{0u};
+
+  /**
+   * @brief  Longest timeout supported, longer timeouts are shortened to it
+   */
+  static constexpr std::chrono::milliseconds kMaxTimeout{(1ull << 24u) - 1u};
+
+ public:
+  /**
+   * @brief         Function to get the timer service, the background thread is started on first call
+   * @return        The reference to timer service
+   */
+  static TimerService &GetTimerService() noexcept;
+
+  /**
+   * @brief         Constructs an instance of TimerService and start the background thread
+   * @details       Use the process wide timer service, own instances are meant for testing only
+   * @param[in]     start_time
+   *                The time of tick zero, lying in the past the service behaves as if running since then
+   */
+  explicit TimerService(Clock::time_point start_time) noexcept;
+
+  /**
+   * @brief         Destruct an instance of TimerService, pending timers are discarded
+   */
+  ~TimerService() noexcept;
+
+  /**
+   * @brief  Deleted copy assignment and copy constructor
+   */
+  TimerService(const TimerService &other) noexcept = delete;
+  TimerService &operator=(const TimerService &other) noexcept = delete;
+
+  /**
+   * @brief  Deleted move assignment and move constructor
+   */
+  TimerService(TimerService &&other) noexcept = delete;
+  TimerService &operator=(TimerService &&other) noexcept = delete;
+
+  /**
+   * @brief         Function to arm a timer
+   * @param[in]     timeout
+   *                The timeout after which the callback is invoked
+   * @param[in]     timeout_callback
+   *                The callback invoked from the timer thread on expiry
+   * @return        The identifier of the timer used for cancellation
+   */
+  TimerId Arm(std::chrono::milliseconds timeout, TimeoutCallback timeout_callback) noexcept;
+
+  /**
+   * @brief         Function to cancel an armed timer
+   * @details       When the callback of the timer is being invoked the function waits for it to return, unless called
+   *                from the callback itself. Objects used by the callback can thus be released after cancellation.
+   *                Locks acquired by the callback must not be held while cancelling.
+   * @param[in]     timer_id
+   *                The identifier of the timer
+   * @return        True if cancelled before expiry, False if already expired or unknown
+   */
+  bool Cancel(TimerId timer_id) noexcept;
+
+ private:
+  /**
+   * @brief  Number of levels of the timing wheel
+   */
+  static constexpr std::uint32_t kNumberOfLevels{4u};
+
+  /**
+   * @brief  Number of bits of the slot index in each level
+   */
+  static constexpr std::uint32_t kSlotBits{6u};
+
+  /**
+   * @brief  Number of slots of each level
+   */
+  static constexpr std::uint32_t kNumberOfSlots{1u << kSlotBits};
+
+  /**
+   * @brief  Mask of the slot index
+   */
+  static constexpr std::uint64_t kSlotMask{kNumberOfSlots - 1u};
+
+  /**
+   * @brief  Index marking the end of a list of timers
+   */
+  static constexpr std::uint32_t kNoTimer{std::numeric_limits<std::uint32_t>::max()};
+
+  /**
+   * @brief  Tick marking that the background thread sleeps without deadline
+   */
+  static constexpr std::uint64_t kNoTick{std::numeric_limits<std::uint64_t>::max()};
+
+  /**
+   * @brief  Definition of timer state
+   */
+  enum class TimerState : std::uint8_t { kFree = 0u, kArmed, kExpired };
+
+  /**
+   * @brief  Timer stored in the timing wheel, linked with the other timers of its slot
+   */
+  struct Timer {
+    TimeoutCallback callback;
+    std::uint64_t expiry_tick;
+    std::uint32_t generation;
+    std::uint32_t previous;
+    std::uint32_t next;
+    std::uint8_t level;
+    std::uint8_t slot;
+    TimerState state;
+  };
+
+  /**
+   * @brief  One level of the timing wheel
+   */
+  struct Level {
+    std::array<std::uint32_t, kNumberOfSlots> slots;
+    std::uint64_t occupied_slots;
+  };
+
+  /**
+   * @brief         Function to get the current tick
+   * @return        The number of milliseconds since construction
+   */
+  std::uint64_t GetCurrentTick() const noexcept;
+
+  /**
+   * @brief         Function to insert the timer into the slot matching its expiry
+   * @param[in]     index
+   *                The index of timer
+   */
+  void Insert(std::uint32_t index) noexcept;
+
+  /**
+   * @brief         Function to remove the timer from its slot
+   * @param[in]     index
+   *                The index of timer
+   */
+  void Unlink(std::uint32_t index) noexcept;
+
+  /**
+   * @brief         Function to release the timer for reuse
+   * @param[in]     index
+   *                The index of timer
+   */
+  void Release(std::uint32_t index) noexcept;
+
+  /**
+   * @brief         Function to advance the wheel by one tick
+   * @param[out]    expired_timers
+   *                The identifiers of expired timers are appended
+   */
+  void AdvanceTick(std::vector<TimerId> &expired_timers) noexcept;
+
+  /**
+   * @brief         Function to get the tick at which the background thread has to wake up next
+   * @return        The tick
+   */
+  std::uint64_t GetNextWakeUpTick() const noexcept;
+
+  /**
+   * @brief         Function run by the background thread
+   */
+  void Run() noexcept;
+
+  /**
+   * @brief  Store the time point of tick zero
+   */
+  Clock::time_point const start_time_;
+
+  /**
+   * @brief  Store the timers, indexed by the lower half of the timer identifier
+   */
+  std::vector<Timer> timers_;
+
+  /**
+   * @brief  Store the indices of released timers
+   */
+  std::vector<std::uint32_t> free_timers_;
+
+  /**
+   * @brief  Store the levels of the timing wheel
+   */
+  std::array<Level, kNumberOfLevels> levels_;
+
+  /**
+   * @brief  Store the tick up to which the wheel has been advanced
+   */
+  std::uint64_t current_tick_;
+
+  /**
+   * @brief  Store the tick at which the background thread wakes up
+   */
+  std::uint64_t wake_up_tick_;
+
+  /**
+   * @brief  Store the number of armed timers
+   */
+  std::size_t armed_timers_;
+
+  /**
+   * @brief  Store the identifier of the timer whose callback is being invoked
+   */
+  TimerId running_timer_id_;
+
+  /**
+   * @brief  Store the exit request of background thread
+   */
+  bool exit_request_;
+
+  /**
+   * @brief  Mutex protecting the timing wheel
+   */
+  std::mutex mutex_;
+
+  /**
+   * @brief  Conditional variable to wake up the background thread
+   */
+  std::condition_variable cond_var_;
+
+  /**
+   * @brief  Conditional variable notified when a callback returned
+   */
+  std::condition_variable callback_cond_var_;
+
+  /**
+   * @brief  Store the identifier of the background thread
+   */
+  std::thread::id thread_id_;
+
+  /**
+   * @brief  Store the background thread
+   */
+  utility::thread::Thread thread_;
+};
+
+}  // namespace timer
+}  // namespace utility
+#endif  // DIAGNOSTIC_CLIENT_LIB_LIB_UTILITY_UTILITY_TIMER_SERVICE_H
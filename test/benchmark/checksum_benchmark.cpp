@@ -0,0 +1,113 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// Measures the throughput of the CRC-32 and CRC-16/CCITT kernels over an image larger than the caches, and of framing
+// TransferData blocks with the checksum calculated per block while framing compared to a separate pass over the image.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "utility/checksum.h"
+
+namespace {
+
+/**
+ * @brief  Number of image bytes, larger than the last level cache
+ */
+constexpr std::size_t kImageLength{256u * 1024u * 1024u};
+
+/**
+ * @brief  Number of data bytes per TransferData block
+ */
+constexpr std::size_t kBlockDataLength{4094u};
+
+/**
+ * @brief  Throughput of a measurement along with the checksum calculated
+ */
+struct Measurement {
+  double throughput;
+  std::uint32_t checksum;
+};
+
+/**
+ * @brief       Function to measure a checksum calculation over the image
+ * @param[in]   checksum
+ *              The checksum instance used
+ * @return      The measurement
+ */
+template<typename Checksum>
+Measurement MeasureKernel(Checksum checksum, std::vector<std::uint8_t> const &image) {
+  auto const start{std::chrono::steady_clock::now()};
+  checksum.Update(image.data(), image.size());
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  return Measurement{static_cast<double>(image.size()) / 1e9 / elapsed.count(), checksum.GetValue()};
+}
+
+/**
+ * @brief       Function to measure framing of all blocks of the image
+ * @param[in]   is_fused
+ *              True to calculate the checksum of each block while framing, False for a separate pass before
+ * @return      The measurement
+ */
+Measurement MeasureFraming(std::vector<std::uint8_t> const &image, bool is_fused) {
+  std::vector<std::uint8_t> request(kBlockDataLength + 2u);
+  utility::checksum::Crc32 checksum{};
+  auto const start{std::chrono::steady_clock::now()};
+  if (!is_fused) { checksum.Update(image.data(), image.size()); }
+  for (std::size_t offset{0u}; offset < image.size(); offset += kBlockDataLength) {
+    std::size_t const block_length{std::min(kBlockDataLength, image.size() - offset)};
+    if (is_fused) { checksum.Update(image.data() + offset, block_length); }
+    request[0u] = 0x36u;
+    request[1u] = static_cast<std::uint8_t>(offset / kBlockDataLength + 1u);
+    std::memcpy(request.data() + 2u, image.data() + offset, block_length);
+  }
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  // the request is used so that the copies are not optimized away
+  return Measurement{static_cast<double>(image.size()) / 1e9 / elapsed.count(),
+                     checksum.GetValue() ^ request[2u]};
+}
+
+/**
+ * @brief       Function to print a result line
+ */
+void PrintResult(std::string const &name, Measurement const &measurement) {
+  std::cout << name << ": " << measurement.throughput << " GB/s (0x" << std::hex << measurement.checksum
+            << std::dec << ")\n";
+}
+}  // namespace
+
+int main() {
+  std::vector<std::uint8_t> image(kImageLength);
+  std::uint32_t seed{0x12345678u};
+  for (std::uint8_t &byte: image) {
+    seed = seed * 1664525u + 1013904223u;
+    byte = static_cast<std::uint8_t>(seed >> 24u);
+  }
+  using utility::checksum::Crc16Ccitt;
+  using utility::checksum::Crc16Kernel;
+  using utility::checksum::Crc32;
+  using utility::checksum::Crc32Kernel;
+
+  PrintResult("CRC-32 slicing-by-8      ", MeasureKernel(Crc32{Crc32Kernel::kSlicingBy8}, image));
+  if (Crc32::IsSupported(Crc32Kernel::kPclmul)) {
+    PrintResult("CRC-32 PCLMULQDQ         ", MeasureKernel(Crc32{Crc32Kernel::kPclmul}, image));
+  }
+  if (Crc32::IsSupported(Crc32Kernel::kArmv8Crc)) {
+    PrintResult("CRC-32 ARMv8 CRC32       ", MeasureKernel(Crc32{Crc32Kernel::kArmv8Crc}, image));
+  }
+  PrintResult("CRC-16 bytewise          ", MeasureKernel(Crc16Ccitt{Crc16Kernel::kBytewise}, image));
+  PrintResult("CRC-16 slicing-by-8      ", MeasureKernel(Crc16Ccitt{Crc16Kernel::kSlicingBy8}, image));
+  PrintResult("Framing, separate CRC-32 ", MeasureFraming(image, false));
+  PrintResult("Framing, fused CRC-32    ", MeasureFraming(image, true));
+  std::cout << std::flush;
+  return 0;
+}
@@ -0,0 +1,177 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// Measures the throughput of opening a raw binary, Intel HEX and Motorola S-record image, which maps and validates
+// every record, and of reading all segment data in TransferData sized blocks as done by the flash engine. The
+// images are generated in the temporary directory, the file size in MiB is given as first argument (default 256).
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "boost-support/file/image_file.h"
+
+namespace {
+
+/**
+ * @brief  Number of data bytes per record, as written by common linkers
+ */
+constexpr std::size_t kRecordDataLength{32u};
+
+/**
+ * @brief  Number of data bytes per TransferData block
+ */
+constexpr std::size_t kBlockDataLength{4094u};
+
+/**
+ * @brief  Upper case hex digits
+ */
+constexpr char kHexDigits[]{"0123456789ABCDEF"};
+
+/**
+ * @brief       Function to append a byte as two hex digits
+ */
+void AppendHexByte(std::string &line, std::uint8_t byte) {
+  line.push_back(kHexDigits[byte >> 4u]);
+  line.push_back(kHexDigits[byte & 0x0Fu]);
+}
+
+/**
+ * @brief       Function to append the record bytes as hex followed by the checksum and line ending
+ * @param[in]   record
+ *              The record bytes without checksum
+ * @param[in]   is_intel_hex
+ *              True for two's complement checksum of Intel HEX, False for one's complement of S-record
+ */
+void AppendRecord(std::string &line, std::vector<std::uint8_t> const &record, bool is_intel_hex) {
+  std::uint8_t sum{0u};
+  for (std::uint8_t const byte: record) {
+    AppendHexByte(line, byte);
+    sum = static_cast<std::uint8_t>(sum + byte);
+  }
+  AppendHexByte(line, is_intel_hex ? static_cast<std::uint8_t>(0x100u - sum)
+                                   : static_cast<std::uint8_t>(~sum));
+  line.append("\r\n");
+}
+
+/**
+ * @brief       Function to write an image of the given format with at least the given file size
+ * @return      The number of data bytes written
+ */
+std::size_t WriteImage(std::filesystem::path const &path, boost_support::file::ImageFormat format,
+                       std::size_t file_size) {
+  std::ofstream file{path, std::ios::binary};
+  std::string chunk{};
+  std::vector<std::uint8_t> record{};
+  std::size_t written{0u};
+  std::size_t data_length{0u};
+  std::uint32_t address{0u};
+  while (written < file_size) {
+    chunk.clear();
+    for (std::size_t index{0u}; index < 4096u; ++index) {
+      record.clear();
+      if (format == boost_support::file::ImageFormat::kIntelHex) {
+        if ((address & 0xFFFFu) == 0u) {
+          // extended linear address record on every 64 KiB boundary
+          chunk.push_back(':');
+          AppendRecord(chunk,
+                       {0x02u, 0x00u, 0x00u, 0x04u, static_cast<std::uint8_t>(address >> 24u),
+                        static_cast<std::uint8_t>(address >> 16u)},
+                       true);
+        }
+        record = {static_cast<std::uint8_t>(kRecordDataLength),
+                  static_cast<std::uint8_t>(address >> 8u), static_cast<std::uint8_t>(address),
+                  0x00u};
+        chunk.push_back(':');
+      } else if (format == boost_support::file::ImageFormat::kMotorolaSRecord) {
+        record = {static_cast<std::uint8_t>(kRecordDataLength + 5u),
+                  static_cast<std::uint8_t>(address >> 24u), static_cast<std::uint8_t>(address >> 16u),
+                  static_cast<std::uint8_t>(address >> 8u), static_cast<std::uint8_t>(address)};
+        chunk.append("S3");
+      }
+      for (std::size_t byte{0u}; byte < kRecordDataLength; ++byte) {
+        record.emplace_back(static_cast<std::uint8_t>((address + byte) * 7u));
+      }
+      if (format == boost_support::file::ImageFormat::kBinary) {
+        chunk.append(record.begin(), record.end());
+      } else {
+        AppendRecord(chunk, record, format == boost_support::file::ImageFormat::kIntelHex);
+      }
+      address += static_cast<std::uint32_t>(kRecordDataLength);
+      data_length += kRecordDataLength;
+    }
+    file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+    written += chunk.size();
+  }
+  if (format == boost_support::file::ImageFormat::kIntelHex) { file << ":00000001FF\r\n"; }
+  return data_length;
+}
+
+/**
+ * @brief       Function to measure open and read of an image and print the throughput
+ */
+bool MeasureImage(std::string const &name, std::filesystem::path const &path,
+                  boost_support::file::ImageFormat format, std::size_t file_size) {
+  std::size_t const data_length{WriteImage(path, format, file_size)};
+  std::uintmax_t const file_length{std::filesystem::file_size(path)};
+
+  auto const open_start{std::chrono::steady_clock::now()};
+  core_type::Result<boost_support::file::ImageFile, boost_support::file::ImageFileErrorCode>
+      image_result{boost_support::file::ImageFile::Open(path.string(), 0u)};
+  std::chrono::duration<double> const open_elapsed{std::chrono::steady_clock::now() - open_start};
+  if (!image_result.HasValue() || image_result.Value().GetLength() != data_length) {
+    std::cout << name << " image rejected" << std::endl;
+    return false;
+  }
+
+  auto const read_start{std::chrono::steady_clock::now()};
+  std::uint64_t checksum{0u};
+  for (boost_support::file::ImageSegment const &segment: image_result.Value().GetSegments()) {
+    boost_support::file::ImageFile::SegmentReader reader{
+        image_result.Value().GetSegmentReader(segment)};
+    while (reader.GetRemainingLength() != 0u) {
+      core_type::Span<std::uint8_t const> const block{reader.Read(kBlockDataLength)};
+      if (block.empty()) { break; }
+      // touch the block as the framing does when copying it into the request
+      checksum += block[0u] + block[block.size() - 1u];
+    }
+  }
+  std::chrono::duration<double> const read_elapsed{std::chrono::steady_clock::now() - read_start};
+
+  double const file_gb{static_cast<double>(file_length) / 1e9};
+  std::cout << name << " file " << file_length / (1024u * 1024u) << " MiB, "
+            << image_result.Value().GetSegments().size() << " segments\n"
+            << "  Open and validate        : " << file_gb / open_elapsed.count() << " GB/s\n"
+            << "  Read segments            : " << file_gb / read_elapsed.count() << " GB/s"
+            << " (checksum " << checksum << ")" << std::endl;
+  return true;
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::size_t const file_size{(argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256u) * 1024u * 1024u};
+  std::filesystem::path const directory{std::filesystem::temp_directory_path()};
+  std::filesystem::path const binary_path{directory / "image_file_benchmark.bin"};
+  std::filesystem::path const hex_path{directory / "image_file_benchmark.hex"};
+  std::filesystem::path const srec_path{directory / "image_file_benchmark.s37"};
+
+  bool const is_measured{
+      MeasureImage("Binary", binary_path, boost_support::file::ImageFormat::kBinary, file_size) &&
+      MeasureImage("Intel HEX", hex_path, boost_support::file::ImageFormat::kIntelHex, file_size) &&
+      MeasureImage("S-record", srec_path, boost_support::file::ImageFormat::kMotorolaSRecord,
+                   file_size)};
+
+  std::filesystem::remove(binary_path);
+  std::filesystem::remove(hex_path);
+  std::filesystem::remove(srec_path);
+  return is_measured ? 0 : 1;
+}
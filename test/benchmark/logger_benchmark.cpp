@@ -0,0 +1,79 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// Measures the cost of a per frame debug log on the receive path, once filtered by runtime log level and once
+// formatted and pushed to the asynchronous log sink writing to a discarded standard output.
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+#include "utility/logger.h"
+
+namespace {
+
+/**
+ * @brief  Stream buffer discarding all output
+ */
+class NullBuffer final : public std::streambuf {
+ protected:
+  int_type overflow(int_type ch) override { return traits_type::not_eof(ch); }
+
+  std::streamsize xsputn(const char_type *, std::streamsize count) override { return count; }
+};
+
+/**
+ * @brief       Function to log the given number of receive messages as done on the tcp receive path
+ * @param[in]   logger
+ *              The logger
+ * @param[in]   count
+ *              The number of messages
+ * @return      The average duration of one log call in nanoseconds
+ */
+double MeasureDebugLog(utility::logger::Logger &logger, std::uint32_t count) {
+  std::string const remote_ip_address{"172.16.25.128"};
+  std::uint16_t const remote_port_num{13400u};
+  auto const start{std::chrono::steady_clock::now()};
+  for (std::uint32_t index{0u}; index < count; index++) {
+    logger.LogDebug(FILE_NAME, __LINE__, __func__,
+                    [&remote_ip_address, remote_port_num](std::stringstream &msg) {
+                      msg << "Tcp Message received from "
+                          << "<" << remote_ip_address << "," << remote_port_num << ">";
+                    });
+  }
+  std::chrono::duration<double, std::nano> const elapsed{std::chrono::steady_clock::now() - start};
+  return elapsed.count() / count;
+}
+}  // namespace
+
+int main() {
+  constexpr std::uint32_t kFilteredCount{10'000'000u};
+  constexpr std::uint32_t kLoggedCount{200'000u};
+  utility::logger::Logger logger{"bnch"};
+
+  // Debug disabled at runtime, the functor is never invoked
+  utility::logger::Logger::SetLogLevel(utility::logger::LogLevel::kInfo);
+  double const filtered_ns{MeasureDebugLog(logger, kFilteredCount)};
+
+  // Debug enabled, message is formatted and written
+  utility::logger::Logger::SetLogLevel(utility::logger::LogLevel::kVerbose);
+  NullBuffer null_buffer{};
+  std::streambuf *const cout_buffer{std::cout.rdbuf(&null_buffer)};
+  double const logged_ns{MeasureDebugLog(logger, kLoggedCount)};
+  utility::logger::LogSink::GetLogSink().Flush();
+  std::cout.rdbuf(cout_buffer);
+
+  std::cout << "Compiled log level       : " << static_cast<int>(utility::logger::kMaxLogLevel)
+            << "\n"
+            << "LogDebug filtered        : " << filtered_ns << " ns/call\n"
+            << "LogDebug formatted       : " << logged_ns << " ns/call\n"
+            << "LogDebug dropped         : " << utility::logger::LogSink::GetLogSink().GetDroppedCount()
+            << " of " << kLoggedCount << std::endl;
+  return 0;
+}
@@ -0,0 +1,118 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// Measures the cost of querying and changing a handler state as done per received frame, once with the heap and mutex
+// based StateContext and once with the lock-free StateMachine.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <utility>
+
+#include "utility/state.h"
+#include "utility/state_machine.h"
+
+namespace {
+
+/**
+ * @brief  States of a request waiting for its response
+ */
+enum class RequestState : std::uint8_t { kIdle = 0u, kWaitForResponse, kResponseReceived };
+
+/**
+ * @brief  Allowed request state transitions
+ */
+constexpr std::pair<RequestState, RequestState> kRequestTransitions[]{
+    {RequestState::kIdle, RequestState::kWaitForResponse},
+    {RequestState::kWaitForResponse, RequestState::kResponseReceived},
+    {RequestState::kResponseReceived, RequestState::kIdle}};
+
+/**
+ * @brief  Request transition table
+ */
+constexpr utility::state::TransitionTable<RequestState, 3u> kRequestTransitionTable{
+    kRequestTransitions};
+
+/**
+ * @brief  State without behaviour, as used by the handlers
+ */
+class EmptyState final : public utility::state::State<RequestState> {
+ public:
+  explicit EmptyState(RequestState state) : State<RequestState>(state) {}
+
+  void Start() override {}
+
+  void Stop() override {}
+};
+
+/**
+ * @brief       Function to run the given number of request cycles, each querying the state per frame
+ * @param[in]   get_state
+ *              The functor returning the active state
+ * @param[in]   transition_to
+ *              The functor changing the state
+ * @param[in]   count
+ *              The number of request cycles
+ * @return      The average duration of one request cycle in nanoseconds
+ */
+template<typename GetState, typename TransitionTo>
+double MeasureRequestCycle(GetState &&get_state, TransitionTo &&transition_to,
+                           std::uint32_t count) {
+  std::uint32_t matched{0u};
+  auto const start{std::chrono::steady_clock::now()};
+  for (std::uint32_t index{0u}; index < count; index++) {
+    transition_to(RequestState::kIdle, RequestState::kWaitForResponse);
+    // acknowledgement and response frame both check the state
+    if (get_state() == RequestState::kWaitForResponse) { matched++; }
+    if (get_state() == RequestState::kWaitForResponse) {
+      transition_to(RequestState::kWaitForResponse, RequestState::kResponseReceived);
+    }
+    if (get_state() == RequestState::kResponseReceived) { matched++; }
+    transition_to(RequestState::kResponseReceived, RequestState::kIdle);
+  }
+  std::chrono::duration<double, std::nano> const elapsed{std::chrono::steady_clock::now() - start};
+  // keep the loop from being optimized away
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+  if (matched != 2u * count) { std::cerr << "Unexpected state sequence" << std::endl; }
+  return elapsed.count() / count;
+}
+}  // namespace
+
+int main() {
+  constexpr std::uint32_t kCount{5'000'000u};
+
+  utility::state::StateContext<RequestState> state_context{};
+  state_context.AddState(RequestState::kIdle, std::make_unique<EmptyState>(RequestState::kIdle));
+  state_context.AddState(RequestState::kWaitForResponse,
+                         std::make_unique<EmptyState>(RequestState::kWaitForResponse));
+  state_context.AddState(RequestState::kResponseReceived,
+                         std::make_unique<EmptyState>(RequestState::kResponseReceived));
+  state_context.TransitionTo(RequestState::kIdle);
+  double const state_context_ns{MeasureRequestCycle(
+      [&state_context]() { return state_context.GetActiveState().GetState(); },
+      [&state_context](RequestState expected_state, RequestState new_state) {
+        if (state_context.GetActiveState().GetState() == expected_state) {
+          state_context.TransitionTo(new_state);
+        }
+      },
+      kCount)};
+
+  utility::state::StateMachine<RequestState, kRequestTransitionTable> state_machine{
+      RequestState::kIdle};
+  double const state_machine_ns{MeasureRequestCycle(
+      [&state_machine]() { return state_machine.GetState(); },
+      [&state_machine](RequestState expected_state, RequestState new_state) {
+        static_cast<void>(state_machine.TransitionTo(expected_state, new_state));
+      },
+      kCount)};
+
+  std::cout << "StateContext request cycle : " << state_context_ns << " ns\n"
+            << "StateMachine request cycle : " << state_machine_ns << " ns" << std::endl;
+  return 0;
+}
@@ -0,0 +1,139 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// Floods a udp server on loopback with vehicle announcement sized datagrams. Bursts of datagrams sent back-to-back
+// model many DoIP entities answering one broadcast identification request, the loss shows how many responses are
+// dropped by the receive path, and the time from the end of a burst until its last datagram is received shows how fast
+// the receive path drains queued datagrams. A continuous flood measures the sustained reception rate. The datagram
+// length is given as first argument (default 41, a vehicle announcement with VIN/GID sync status).
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "boost-support/server/udp/udp_server.h"
+#include "utility/logger.h"
+
+namespace {
+
+/**
+ * @brief  Loopback address of the udp server
+ */
+constexpr char kServerIpAddress[]{"127.0.0.1"};
+
+/**
+ * @brief  Loopback address of the sender, datagrams from the own address are ignored by the server
+ */
+constexpr char kSenderIpAddress[]{"127.0.0.2"};
+
+/**
+ * @brief  Port number of the udp server
+ */
+constexpr std::uint16_t kServerPortNum{23401u};
+
+/**
+ * @brief  Number of datagrams per burst, as many DoIP entities responding to one broadcast
+ */
+constexpr std::size_t kBurstLength{256u};
+
+/**
+ * @brief  Number of bursts sent
+ */
+constexpr std::size_t kBurstCount{200u};
+
+/**
+ * @brief  Number of datagrams of the continuous flood
+ */
+constexpr std::size_t kFloodLength{500000u};
+
+/**
+ * @brief       Function to wait until no further datagram is received
+ * @param[in]   received_count
+ *              The number of datagrams received so far
+ * @return      The time the last datagram was received
+ */
+std::chrono::steady_clock::time_point WaitUntilIdle(std::atomic<std::size_t> const &received_count) {
+  std::size_t last_count{received_count.load()};
+  auto last_change{std::chrono::steady_clock::now()};
+  while (std::chrono::steady_clock::now() - last_change < std::chrono::milliseconds{50}) {
+    std::this_thread::sleep_for(std::chrono::microseconds{200});
+    std::size_t const count{received_count.load()};
+    if (count != last_count) {
+      last_count = count;
+      last_change = std::chrono::steady_clock::now();
+    }
+  }
+  return last_change;
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  std::size_t const datagram_length{argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 41u};
+  // logging of every datagram is not part of the measurement
+  utility::logger::Logger::SetLogLevel(utility::logger::LogLevel::kError);
+
+  std::atomic<std::size_t> received_count{0u};
+  std::atomic<std::size_t> received_bytes{0u};
+  std::atomic<std::chrono::steady_clock::time_point> last_received{};
+  boost_support::server::udp::UdpServer server{kServerIpAddress, kServerPortNum};
+  server.SetReadHandler([&received_count, &received_bytes, &last_received](
+                            boost_support::server::udp::UdpServer::MessagePtr message) {
+    received_bytes.fetch_add(message->GetPayload().size(), std::memory_order_relaxed);
+    last_received.store(std::chrono::steady_clock::now(), std::memory_order_relaxed);
+    received_count.fetch_add(1u, std::memory_order_release);
+  });
+  server.Initialize();
+
+  boost::asio::io_context io_context{};
+  boost::asio::ip::udp::socket sender{io_context, boost::asio::ip::udp::endpoint{
+                                                      boost::asio::ip::make_address(kSenderIpAddress), 0u}};
+  boost::asio::ip::udp::endpoint const server_endpoint{boost::asio::ip::make_address(kServerIpAddress),
+                                                       kServerPortNum};
+  std::vector<std::uint8_t> datagram(datagram_length, 0xA5u);
+
+  // Bursts, waiting for the receiver to drain each burst before the next one
+  std::chrono::duration<double> drain_elapsed{};
+  for (std::size_t burst{0u}; burst < kBurstCount; ++burst) {
+    for (std::size_t index{0u}; index < kBurstLength; ++index) {
+      static_cast<void>(sender.send_to(boost::asio::buffer(datagram), server_endpoint));
+    }
+    auto const send_end{std::chrono::steady_clock::now()};
+    static_cast<void>(WaitUntilIdle(received_count));
+    if (last_received.load() > send_end) { drain_elapsed += last_received.load() - send_end; }
+  }
+  std::size_t const burst_sent{kBurstCount * kBurstLength};
+  std::size_t const burst_received{received_count.exchange(0u)};
+  std::size_t const burst_received_bytes{received_bytes.exchange(0u)};
+  std::cout << "Datagram length          : " << datagram_length << " bytes sent, "
+            << (burst_received != 0u ? burst_received_bytes / burst_received : 0u) << " bytes received\n"
+            << "Bursts of " << kBurstLength << " datagrams  : " << burst_received << " of " << burst_sent
+            << " received, " << 100.0 * static_cast<double>(burst_sent - burst_received) / burst_sent
+            << " % lost\n"
+            << "Burst drain after send   : " << 1e6 * drain_elapsed.count() / kBurstCount << " us per burst\n";
+
+  // Continuous flood
+  auto const start{std::chrono::steady_clock::now()};
+  for (std::size_t index{0u}; index < kFloodLength; ++index) {
+    static_cast<void>(sender.send_to(boost::asio::buffer(datagram), server_endpoint));
+  }
+  auto const send_end{std::chrono::steady_clock::now()};
+  auto const receive_end{WaitUntilIdle(received_count)};
+  std::size_t const flood_received{received_count.load()};
+  std::chrono::duration<double> const send_elapsed{send_end - start};
+  std::chrono::duration<double> const receive_elapsed{receive_end - start};
+  std::cout << "Flood sent               : " << kFloodLength / send_elapsed.count() / 1e6 << " M datagrams/s\n"
+            << "Flood received           : " << flood_received / receive_elapsed.count() / 1e6
+            << " M datagrams/s, " << flood_received << " of " << kFloodLength << " received" << std::endl;
+
+  server.DeInitialize();
+  return 0;
+}
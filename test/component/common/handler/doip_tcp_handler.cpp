@@ -28,6 +28,15 @@ constexpr std::uint32_t kDoipRoutingActivationResMinLen{9u};  // without OEM spe
 constexpr std::uint16_t kDoipDiagMessage{0x8001};
 constexpr std::uint16_t kDoipDiagMessagePosAck{0x8002};
 constexpr std::uint16_t kDoipDiagMessageNegAck{0x8003};
+/**
+ * @brief  Alive check type
+ */
+constexpr std::uint16_t kDoipAliveCheckReqType{0x0007};
+constexpr std::uint16_t kDoipAliveCheckResType{0x0008};
+/**
+ * @brief  Generic header negative acknowledgement type
+ */
+constexpr std::uint16_t kDoipGenericHeaderNackType{0x0000};
 /**
  * @brief  Diagnostic Message request/response lengths
  */
@@ -110,6 +119,14 @@ void DoipTcpHandler::ProcessReceivedTcpMessage(
           doip_message.GetPayload().size() - kSourceAddressSize}};
       ProcessDiagnosticRequestMessage(client_source_address, server_target_address, diag_request);
     } break;
+
+    case kDoipAliveCheckResType: {
+      ProcessAliveCheckResponseMessage(ConvertToAddr(doip_message.GetPayload()));
+    } break;
+
+    case kDoipGenericHeaderNackType: {
+      ProcessGenericHeaderNackMessage(doip_message.GetPayload()[0u]);
+    } break;
   }
 }
 
@@ -206,6 +223,39 @@ auto ComposeDiagnosticResponseMessage(std::uint16_t source_address, std::uint16_
   return response;
 }
 
+auto ComposeAliveCheckRequest() noexcept -> DoipTcpHandler::TcpServer::MessagePtr {
+  // Alive check request consists of header only
+  DoipTcpHandler::TcpServer::MessagePtr request{
+      std::make_unique<DoipTcpHandler::TcpServer::Message>(
+          "", 0u, CreateDoipGenericHeader(kDoipAliveCheckReqType, 0u))};
+  return request;
+}
+
+auto ComposeDiagnosticMessageWithPattern(std::uint8_t protocol_version,
+                                         std::uint8_t inverse_protocol_version,
+                                         std::uint16_t source_address,
+                                         std::uint16_t target_address,
+                                         std::size_t diag_response_size) noexcept
+    -> DoipTcpHandler::TcpServer::MessagePtr {
+  // Create header
+  DoipTcpHandler::TcpServer::Message::BufferType response_buffer{CreateDoipGenericHeader(
+      kDoipDiagMessage, kDoipDiagMessageReqResMinLen + diag_response_size)};
+  response_buffer[0u] = protocol_version;
+  response_buffer[1u] = inverse_protocol_version;
+  // Add SA
+  response_buffer.emplace_back(source_address >> 8U);
+  response_buffer.emplace_back(source_address & 0xFFU);
+  // Add TA
+  response_buffer.emplace_back(target_address >> 8U);
+  response_buffer.emplace_back(target_address & 0xFFU);
+  // Fill data bytes with positive response
+  response_buffer.resize(response_buffer.size() + diag_response_size, 0x62u);
+
+  DoipTcpHandler::TcpServer::MessagePtr response{
+      std::make_unique<DoipTcpHandler::TcpServer::Message>("", 0u, std::move(response_buffer))};
+  return response;
+}
+
 }  // namespace handler
 }  // namespace common
 }  // namespace component
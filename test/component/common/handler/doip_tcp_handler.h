@@ -49,6 +49,17 @@ class DoipTcpHandler {
                core_type::Span<std::uint8_t const> diag_request),
               (noexcept));
 
+  /*!
+   * @brief           Function that gets invoked on reception of Alive check response message
+   */
+  MOCK_METHOD(void, ProcessAliveCheckResponseMessage, (std::uint16_t client_source_address),
+              (noexcept));
+
+  /*!
+   * @brief           Function that gets invoked on reception of Generic header negative acknowledgement message
+   */
+  MOCK_METHOD(void, ProcessGenericHeaderNackMessage, (std::uint8_t nack_code), (noexcept));
+
   void SendTcpMessage(TcpServer::MessageConstPtr tcp_message) noexcept;
 
  private:
@@ -78,6 +89,15 @@ auto ComposeDiagnosticResponseMessage(std::uint16_t source_address, std::uint16_
                                       core_type::Span<std::uint8_t const> diag_response) noexcept
     -> DoipTcpHandler::TcpServer::MessagePtr;
 
+auto ComposeAliveCheckRequest() noexcept -> DoipTcpHandler::TcpServer::MessagePtr;
+
+auto ComposeDiagnosticMessageWithPattern(std::uint8_t protocol_version,
+                                         std::uint8_t inverse_protocol_version,
+                                         std::uint16_t source_address,
+                                         std::uint16_t target_address,
+                                         std::size_t diag_response_size) noexcept
+    -> DoipTcpHandler::TcpServer::MessagePtr;
+
 }  // namespace handler
 }  // namespace common
 }  // namespace component
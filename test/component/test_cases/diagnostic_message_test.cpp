@@ -34,6 +34,13 @@ const std::uint16_t kDiagClientLogicalAddress{0x0001U};
 const std::uint16_t kDiagServerLogicalAddress{0xFA25U};
 // Path to json file
 constexpr std::string_view kDiagClientConfigPath{"./etc/diag_client_config.json"};
+// Logical address of first ECU behind the gateway
+const std::uint16_t kDiagServerLogicalAddressOne{0x1010U};
+// Logical address of second ECU behind the gateway
+const std::uint16_t kDiagServerLogicalAddressTwo{0x1011U};
+// Path to json file with both conversations using the same source address
+constexpr std::string_view kDiagClientSharedGatewayConfigPath{
+    "./etc/diag_client_shared_gateway_config.json"};
 // Default routing activation type
 constexpr std::uint8_t kDoipRoutingActivationReqActTypeDefault{0x00U};
 // Successful routing activation response code
@@ -47,6 +54,13 @@ constexpr std::uint8_t kDoipDiagnosticMessageNegAckCodeOutOfMemory{0x05};
 constexpr std::uint8_t kDoipDiagnosticMessageNegAckCodeTargetUnreachable{0x06};
 constexpr std::uint8_t kDoipDiagnosticMessageNegAckCodeUnknownNetwork{0x07};
 constexpr std::uint8_t kDoipDiagnosticMessageNegAckCodeTpError{0x08};
+// Generic header negative acknowledgement codes
+constexpr std::uint8_t kDoipGenericHeaderNackIncorrectPattern{0x00};
+constexpr std::uint8_t kDoipGenericHeaderNackMessageTooLarge{0x02};
+// Doip protocol version
+constexpr std::uint8_t kDoipProtocolVersion{0x03};
+// Maximum diagnostic message size received by diag client, as configured RxBufferSize
+constexpr std::size_t kDiagClientMaxMessageSize{12288u};
 
 // Uds message implementation
 class UdsMessage : public diag::client::uds_message::UdsMessage {
@@ -113,10 +127,12 @@ class DiagMessageFixture : public component::ComponentTest {
   using TcpServer = boost_support::server::tcp::TcpServer;
 
  protected:
-  DiagMessageFixture()
+  DiagMessageFixture() : DiagMessageFixture{kDiagClientConfigPath} {}
+
+  explicit DiagMessageFixture(std::string_view diag_client_config_path)
       : tcp_acceptor_{kDiagServerName, kDiagTcpIpAddress, kDiagTcpPortNum, 1u},
         doip_tcp_handler_{},
-        diag_client_{diag::client::CreateDiagnosticClient(kDiagClientConfigPath)} {}
+        diag_client_{diag::client::CreateDiagnosticClient(diag_client_config_path)} {}
 
   void SetUp() override {
     ASSERT_TRUE(diag_client_->Initialize().HasValue());
@@ -228,6 +244,153 @@ TEST_F(DiagMessageFixture, VerifyDiagPositiveResponse) {
   EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAreArray(kDiagResponse));
 }
 
+/**
+ * @brief  Verify that asynchronous sending of diagnostic request works correctly and response is received.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagPositiveResponseAsync) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  UdsMessage::ByteVector kDiagResponse{0x50, 0x01, 0x00, 0x32, 0x01, 0xF4};
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &kDiagResponse]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address,
+                                               std::uint8_t activation_type,
+                                               std::optional<std::uint8_t> vm_specific) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(activation_type, kDoipRoutingActivationReqActTypeDefault);
+              EXPECT_FALSE(vm_specific.has_value());
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .Times(2)
+            .WillRepeatedly(::testing::Invoke([this, &kDiagRequest, &kDiagResponse](
+                                                  std::uint16_t client_source_address,
+                                                  std::uint16_t server_target_address,
+                                                  core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(server_target_address, kDiagServerLogicalAddress);
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              // Send Diagnostic Positive Acknowledgement message
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              // Send Diagnostic response message
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagResponse}));
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Send request and get the response via future
+  std::future<diag::client::conversation::DiagClientConversation::DiagResult> diag_result_future{
+      diag_client_conversation.GetConversation().SendDiagnosticRequestAsync(
+          std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest))};
+
+  diag::client::conversation::DiagClientConversation::DiagResult diag_result{
+      diag_result_future.get()};
+  ASSERT_TRUE(diag_result.HasValue());
+  EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAreArray(kDiagResponse));
+
+  // Send request and get the response via handler
+  std::promise<UdsMessage::ByteVector> response_payload_promise{};
+  std::future<UdsMessage::ByteVector> response_payload_future{
+      response_payload_promise.get_future()};
+  diag_client_conversation.GetConversation().SendDiagnosticRequestAsync(
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest),
+      [&response_payload_promise](
+          diag::client::conversation::DiagClientConversation::DiagResult result) {
+        EXPECT_TRUE(result.HasValue());
+        response_payload_promise.set_value(result.HasValue() ? result.Value()->GetPayload()
+                                                             : UdsMessage::ByteVector{});
+      });
+
+  EXPECT_THAT(response_payload_future.get(), testing::ElementsAreArray(kDiagResponse));
+}
+
+/**
+ * @brief  Verify that received diagnostic response stays valid when next diagnostic request is sent.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagResponseRetainedAcrossRequests) {
+  UdsMessage::ByteVector kDiagRequestDefaultSession{0x10, 0x01};
+  UdsMessage::ByteVector kDiagResponseDefaultSession{0x50, 0x01, 0x00, 0x32, 0x01, 0xF4};
+  UdsMessage::ByteVector kDiagRequestExtendedSession{0x10, 0x03};
+  UdsMessage::ByteVector kDiagResponseExtendedSession{0x50, 0x03, 0x00, 0x32, 0x01, 0xF4};
+
+  std::future<bool> is_server_created{CreateServerWithExpectation([this,
+                                                                   &kDiagResponseDefaultSession,
+                                                                   &kDiagResponseExtendedSession]() {
+    // Create an expectation of routing activation response
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address,
+                                           std::uint8_t activation_type,
+                                           std::optional<std::uint8_t> vm_specific) {
+          EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+          EXPECT_EQ(activation_type, kDoipRoutingActivationReqActTypeDefault);
+          EXPECT_FALSE(vm_specific.has_value());
+          // Send Routing activation response
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+              client_source_address, kDiagServerLogicalAddress,
+              kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+        }));
+
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke(
+            [this, &kDiagResponseDefaultSession, &kDiagResponseExtendedSession](
+                std::uint16_t client_source_address, std::uint16_t server_target_address,
+                core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(server_target_address, kDiagServerLogicalAddress);
+              // Send Diagnostic Positive Acknowledgement message
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              // Send Diagnostic response message matching the requested session
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{diag_request[1u] == 0x01u
+                                                          ? kDiagResponseDefaultSession
+                                                          : kDiagResponseExtendedSession}));
+            }));
+  })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  diag::client::conversation::DiagClientConversation::DiagResult first_diag_result{
+      diag_client_conversation.GetConversation().SendDiagnosticRequest(
+          std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequestDefaultSession))};
+  ASSERT_TRUE(first_diag_result.HasValue());
+
+  diag::client::conversation::DiagClientConversation::DiagResult second_diag_result{
+      diag_client_conversation.GetConversation().SendDiagnosticRequest(
+          std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequestExtendedSession))};
+  ASSERT_TRUE(second_diag_result.HasValue());
+
+  // First response is not overwritten by the second one
+  EXPECT_THAT(first_diag_result.Value()->GetPayload(),
+              testing::ElementsAreArray(kDiagResponseDefaultSession));
+  EXPECT_THAT(second_diag_result.Value()->GetPayload(),
+              testing::ElementsAreArray(kDiagResponseExtendedSession));
+}
+
 /**
  * @brief  Verify that sending of diagnostic request works correctly when negative diagnostic response is received.
  */
@@ -362,6 +525,105 @@ TEST_F(DiagMessageFixture, VerifyDiagPendingResponse) {
   EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAreArray(kDiagFinalResponse));
 }
 
+/**
+ * @brief  Verify that asynchronous request handles pending response and the next request is sent from the handler.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagPendingResponseAsync) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  UdsMessage::ByteVector kDiagPendingResponse{0x7F, 0x10, 0x78};
+  UdsMessage::ByteVector kDiagFinalResponse{0x50, 0x01, 0x00, 0x32, 0x01, 0xF4};
+  constexpr std::uint8_t kNumOfPending{5u};
+
+  std::future<bool> is_server_created{CreateServerWithExpectation(
+      [this, &kDiagRequest, &kDiagPendingResponse, &kDiagFinalResponse]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address,
+                                               std::uint8_t activation_type,
+                                               std::optional<std::uint8_t> vm_specific) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(activation_type, kDoipRoutingActivationReqActTypeDefault);
+              EXPECT_FALSE(vm_specific.has_value());
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &kDiagPendingResponse,
+                                         &kDiagFinalResponse](
+                                            std::uint16_t client_source_address,
+                                            std::uint16_t server_target_address,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(server_target_address, kDiagServerLogicalAddress);
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              // Send Diagnostic Positive Acknowledgement message
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              // Send Diagnostic pending response message, together longer than P2ClientMax
+              for (std::uint8_t pending_count{0}; pending_count < kNumOfPending; pending_count++) {
+                doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                    kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                    core_type::Span<std::uint8_t const>{kDiagPendingResponse}));
+                std::this_thread::sleep_for(std::chrono::milliseconds(300));
+              }
+              // Send final diagnostic response message
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagFinalResponse}));
+            }))
+            .WillOnce(::testing::Invoke([this](std::uint16_t, std::uint16_t,
+                                               core_type::Span<std::uint8_t const>) {
+              // Send Diagnostic Positive Acknowledgement message only, no response follows
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  std::promise<UdsMessage::ByteVector> response_payload_promise{};
+  std::future<UdsMessage::ByteVector> response_payload_future{
+      response_payload_promise.get_future()};
+  std::promise<diag::client::conversation::DiagClientConversation::DiagError> next_error_promise{};
+  std::future<diag::client::conversation::DiagClientConversation::DiagError> next_error_future{
+      next_error_promise.get_future()};
+  diag_client_conversation.GetConversation().SendDiagnosticRequestAsync(
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest),
+      [&diag_client_conversation, &kDiagRequest, &response_payload_promise, &next_error_promise](
+          diag::client::conversation::DiagClientConversation::DiagResult result) {
+        EXPECT_TRUE(result.HasValue());
+        response_payload_promise.set_value(result.HasValue() ? result.Value()->GetPayload()
+                                                             : UdsMessage::ByteVector{});
+        // Send next request from within the handler
+        diag_client_conversation.GetConversation().SendDiagnosticRequestAsync(
+            std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest),
+            [&next_error_promise](
+                diag::client::conversation::DiagClientConversation::DiagResult next_result) {
+              EXPECT_FALSE(next_result.HasValue());
+              next_error_promise.set_value(
+                  next_result.HasValue()
+                      ? diag::client::conversation::DiagClientConversation::DiagError::
+                            kDiagGenericFailure
+                      : next_result.Error());
+            });
+      });
+
+  EXPECT_THAT(response_payload_future.get(), testing::ElementsAreArray(kDiagFinalResponse));
+  EXPECT_EQ(next_error_future.get(),
+            diag::client::conversation::DiagClientConversation::DiagError::kDiagResponseTimeout);
+}
+
 /**
  * @brief  Verify that correct error is propagated in case of no diagnostic response received and timeout happens.
  */
@@ -419,6 +681,80 @@ TEST_F(DiagMessageFixture, VerifyDiagResponseTimeout) {
               diag::client::conversation::DiagClientConversation::DiagError::kDiagResponseTimeout);
 }
 
+/**
+ * @brief  Verify that diagnostic request is rejected while previous request is still outstanding.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagRequestRejectedWhenBusy) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  std::promise<void> request_received_promise{};
+  std::future<void> request_received_future{request_received_promise.get_future()};
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &request_received_promise]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address,
+                                               std::uint8_t activation_type,
+                                               std::optional<std::uint8_t> vm_specific) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(activation_type, kDoipRoutingActivationReqActTypeDefault);
+              EXPECT_FALSE(vm_specific.has_value());
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        // Only the first request is transmitted, no response is sent
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &request_received_promise](
+                                            std::uint16_t client_source_address,
+                                            std::uint16_t server_target_address,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_EQ(server_target_address, kDiagServerLogicalAddress);
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              // Send Diagnostic Positive Acknowledgement message
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              request_received_promise.set_value();
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Send first request which waits for the response until timeout
+  std::future<diag::client::conversation::DiagClientConversation::DiagError> first_result_future{
+      std::async(std::launch::async, [&diag_client_conversation, &kDiagRequest]() {
+        diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                             diag::client::conversation::DiagClientConversation::DiagError>
+            diag_result{diag_client_conversation.GetConversation().SendDiagnosticRequest(
+                std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest))};
+        return diag_result.HasValue()
+                   ? diag::client::conversation::DiagClientConversation::DiagError::kDiagGenericFailure
+                   : diag_result.Error();
+      })};
+  request_received_future.get();
+
+  // Send second request while first one is outstanding
+  diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                       diag::client::conversation::DiagClientConversation::DiagError>
+      diag_result{diag_client_conversation.GetConversation().SendDiagnosticRequest(
+          std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest))};
+
+  ASSERT_FALSE(diag_result.HasValue());
+  EXPECT_EQ(diag_result.Error(),
+            diag::client::conversation::DiagClientConversation::DiagError::kDiagBusyProcessing);
+  EXPECT_EQ(first_result_future.get(),
+            diag::client::conversation::DiagClientConversation::DiagError::kDiagResponseTimeout);
+}
+
 /**
  * @brief  Verify that correct error is propagated in case invalid parameter provided when sending diagnostic request.
  */
@@ -570,6 +906,512 @@ TEST_F(DiagMessageFixture, VerifyDiagAcknowledgementTimeout) {
               diag::client::conversation::DiagClientConversation::DiagError::kDiagAckTimeout);
 }
 
+/**
+ * @brief  Verify that asynchronous request returns without waiting for the diagnostic acknowledgement, which times out
+ *         afterwards.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagAcknowledgementTimeoutAsync) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+
+  std::future<bool> is_server_created{CreateServerWithExpectation([this, &kDiagRequest]() {
+    // Create an expectation of routing activation response
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                           std::optional<std::uint8_t>) {
+          // Send Routing activation response
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+              client_source_address, kDiagServerLogicalAddress,
+              kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+        }));
+
+    // Diagnostic request is never acknowledged
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([&kDiagRequest](std::uint16_t, std::uint16_t,
+                                                    core_type::Span<std::uint8_t const> diag_request) {
+          EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+        }));
+  })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  auto const start{std::chrono::steady_clock::now()};
+  std::future<diag::client::conversation::DiagClientConversation::DiagResult> diag_result_future{
+      diag_client_conversation.GetConversation().SendDiagnosticRequestAsync(
+          std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest))};
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  // Verify the caller returned before the acknowledgement timeout of 2 sec expired
+  EXPECT_LT(elapsed.count(), 0.5);
+
+  diag::client::conversation::DiagClientConversation::DiagResult const diag_result{
+      diag_result_future.get()};
+  ASSERT_FALSE(diag_result.HasValue());
+  EXPECT_EQ(diag_result.Error(),
+            diag::client::conversation::DiagClientConversation::DiagError::kDiagAckTimeout);
+}
+
+/**
+ * @brief  Verify that alive check request of server is answered with the source address of tester.
+ */
+TEST_F(DiagMessageFixture, VerifyAliveCheckResponse) {
+  std::promise<void> alive_check_answered{};
+  std::future<bool> is_server_created{CreateServerWithExpectation([this, &alive_check_answered]() {
+    // Create an expectation of routing activation response
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                           std::optional<std::uint8_t>) {
+          // Send Routing activation response followed by alive check request
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+              client_source_address, kDiagServerLogicalAddress,
+              kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeAliveCheckRequest());
+        }));
+
+    EXPECT_CALL(*doip_tcp_handler_, ProcessAliveCheckResponseMessage(testing::_))
+        .WillOnce(::testing::Invoke([&alive_check_answered](std::uint16_t client_source_address) {
+          EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+          alive_check_answered.set_value();
+        }));
+  })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  EXPECT_EQ(alive_check_answered.get_future().wait_for(std::chrono::seconds(2)),
+            std::future_status::ready);
+}
+
+/**
+ * @brief  Verify that pending diagnostic request is finished immediately when server closes the connection.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagConnectionLost) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  std::promise<void> diag_request_received{};
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &diag_request_received]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &diag_request_received](
+                                            std::uint16_t, std::uint16_t,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              // Send Diagnostic Positive Acknowledgement message, response is never sent
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              diag_request_received.set_value();
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  std::future<diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                                   diag::client::conversation::DiagClientConversation::DiagError>>
+      diag_result{std::async(std::launch::async, [&diag_client_conversation, &kDiagRequest]() {
+        return diag_client_conversation.GetConversation().SendDiagnosticRequest(
+            std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest));
+      })};
+
+  ASSERT_EQ(diag_request_received.get_future().wait_for(std::chrono::seconds(2)),
+            std::future_status::ready);
+  // Close the connection from server side while the client waits for the response
+  doip_tcp_handler_->DeInitialize();
+
+  // P2 timeout is not awaited
+  ASSERT_EQ(diag_result.wait_for(std::chrono::milliseconds(500)), std::future_status::ready);
+  auto const result{diag_result.get()};
+  ASSERT_FALSE(result.HasValue());
+  EXPECT_THAT(result.Error(),
+              diag::client::conversation::DiagClientConversation::DiagError::kDiagConnectionLost);
+}
+
+/**
+ * @brief  Verify that diagnostic response larger than the tcp channel length is received up to configured buffer size.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagLargeResponse) {
+  UdsMessage::ByteVector kDiagRequest{0x22, 0xF1, 0x90};
+  UdsMessage::ByteVector kDiagResponse(kDiagClientMaxMessageSize);
+  kDiagResponse[0u] = 0x62;
+  for (std::size_t index{1u}; index < kDiagResponse.size(); ++index) {
+    kDiagResponse[index] = static_cast<std::uint8_t>(index);
+  }
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &kDiagResponse]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &kDiagResponse](
+                                            std::uint16_t, std::uint16_t,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagResponse}));
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Create uds message
+  diag::client::uds_message::UdsRequestMessagePtr uds_message{
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest)};
+
+  diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                       diag::client::conversation::DiagClientConversation::DiagError>
+      diag_result{
+          diag_client_conversation.GetConversation().SendDiagnosticRequest(std::move(uds_message))};
+
+  ASSERT_TRUE(diag_result.HasValue());
+  EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAreArray(kDiagResponse));
+}
+
+/**
+ * @brief  Verify that large diagnostic response is streamed to the response sink in chunks.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagStreamedResponse) {
+  UdsMessage::ByteVector kDiagRequest{0x22, 0xF1, 0x90};
+  UdsMessage::ByteVector kDiagPendingResponse{0x7F, 0x22, 0x78};
+  UdsMessage::ByteVector kDiagResponse(kDiagClientMaxMessageSize);
+  kDiagResponse[0u] = 0x62;
+  for (std::size_t index{1u}; index < kDiagResponse.size(); ++index) {
+    kDiagResponse[index] = static_cast<std::uint8_t>(index);
+  }
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &kDiagPendingResponse, &kDiagResponse]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &kDiagPendingResponse, &kDiagResponse](
+                                            std::uint16_t, std::uint16_t,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              // Send pending response first, handled internally
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagPendingResponse}));
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagResponse}));
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Create uds message
+  diag::client::uds_message::UdsRequestMessagePtr uds_message{
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest)};
+
+  UdsMessage::ByteVector streamed_response{};
+  std::size_t streamed_chunk_count{0u};
+  diag::client::Result<void, diag::client::conversation::DiagClientConversation::DiagError>
+      diag_result{diag_client_conversation.GetConversation().SendDiagnosticRequest(
+          std::move(uds_message),
+          [&streamed_response, &streamed_chunk_count, &kDiagResponse](
+              std::size_t response_size, core_type::Span<std::uint8_t const> chunk) {
+            EXPECT_EQ(response_size, kDiagResponse.size());
+            streamed_response.insert(streamed_response.end(), chunk.begin(), chunk.end());
+            ++streamed_chunk_count;
+          })};
+
+  ASSERT_TRUE(diag_result.HasValue());
+  EXPECT_GT(streamed_chunk_count, 1u);
+  EXPECT_THAT(streamed_response, testing::ElementsAreArray(kDiagResponse));
+}
+
+/**
+ * @brief  Verify that too large diagnostic message is negatively acknowledged and skipped, following response is received.
+ */
+TEST_F(DiagMessageFixture, VerifyDiagMessageTooLargeSkipped) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  UdsMessage::ByteVector kDiagResponse{0x50, 0x01, 0x00, 0x32, 0x01, 0xF4};
+  std::promise<void> nack_received{};
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &kDiagResponse, &nack_received]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this, &kDiagRequest, &kDiagResponse](
+                                            std::uint16_t, std::uint16_t,
+                                            core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              // Send too large response followed by the valid one
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticMessageWithPattern(
+                      kDoipProtocolVersion, static_cast<std::uint8_t>(~kDoipProtocolVersion),
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      4u * kDiagClientMaxMessageSize));
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{kDiagResponse}));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_, ProcessGenericHeaderNackMessage(testing::_))
+            .WillOnce(::testing::Invoke([&nack_received](std::uint8_t nack_code) {
+              EXPECT_EQ(nack_code, kDoipGenericHeaderNackMessageTooLarge);
+              nack_received.set_value();
+            }));
+      })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Create uds message
+  diag::client::uds_message::UdsRequestMessagePtr uds_message{
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest)};
+
+  diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                       diag::client::conversation::DiagClientConversation::DiagError>
+      diag_result{
+          diag_client_conversation.GetConversation().SendDiagnosticRequest(std::move(uds_message))};
+
+  ASSERT_TRUE(diag_result.HasValue());
+  EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAreArray(kDiagResponse));
+  // response may be received before the server reads the nack
+  EXPECT_EQ(nack_received.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+}
+
+/**
+ * @brief  Verify that message with incorrect pattern is negatively acknowledged and the connection is closed.
+ */
+TEST_F(DiagMessageFixture, VerifyIncorrectPatternClosesConnection) {
+  UdsMessage::ByteVector kDiagRequest{0x10, 0x01};
+  std::promise<void> nack_received{};
+
+  std::future<bool> is_server_created{CreateServerWithExpectation([this, &kDiagRequest, &nack_received]() {
+    // Create an expectation of routing activation response
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                           std::optional<std::uint8_t>) {
+          // Send Routing activation response
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+              client_source_address, kDiagServerLogicalAddress,
+              kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+        }));
+
+    EXPECT_CALL(*doip_tcp_handler_,
+                ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([this, &kDiagRequest](
+                                        std::uint16_t, std::uint16_t,
+                                        core_type::Span<std::uint8_t const> diag_request) {
+          EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+          doip_tcp_handler_->SendTcpMessage(
+              common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  kDoipDiagnosticMessagePosAckCodeConfirm));
+          // Send response with corrupted header
+          doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticMessageWithPattern(
+              kDoipProtocolVersion, kDoipProtocolVersion, kDiagServerLogicalAddress,
+              kDiagClientLogicalAddress, 2u));
+        }));
+
+    EXPECT_CALL(*doip_tcp_handler_, ProcessGenericHeaderNackMessage(testing::_))
+        .WillOnce(::testing::Invoke([&nack_received](std::uint8_t nack_code) {
+          EXPECT_EQ(nack_code, kDoipGenericHeaderNackIncorrectPattern);
+          nack_received.set_value();
+        }));
+  })};
+
+  DiagConnectedConversation diag_client_conversation{*diag_client_, "DiagTesterOne"};
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Create uds message
+  diag::client::uds_message::UdsRequestMessagePtr uds_message{
+      std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest)};
+
+  diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                       diag::client::conversation::DiagClientConversation::DiagError>
+      diag_result{
+          diag_client_conversation.GetConversation().SendDiagnosticRequest(std::move(uds_message))};
+
+  ASSERT_FALSE(diag_result.HasValue());
+  EXPECT_THAT(diag_result.Error(),
+              diag::client::conversation::DiagClientConversation::DiagError::kDiagConnectionLost);
+  // connection loss may be detected before the server reads the nack
+  EXPECT_EQ(nack_received.get_future().wait_for(std::chrono::seconds(1)), std::future_status::ready);
+}
+
+// Fixture to test diagnostic messages of conversations sharing one gateway connection
+class DiagMessageSharedGatewayFixture : public DiagMessageFixture {
+ protected:
+  DiagMessageSharedGatewayFixture() : DiagMessageFixture{kDiagClientSharedGatewayConfigPath} {}
+};
+
+/**
+ * @brief  Verify that concurrent requests to different target addresses over one connection are
+ *         matched with their acknowledgement and response when answered out of order.
+ */
+TEST_F(DiagMessageSharedGatewayFixture, VerifyConcurrentRequestsAnsweredOutOfOrder) {
+  UdsMessage::ByteVector kDiagRequest{0x22, 0xF1, 0x8A};
+  // target address of the request held back until the other request is received
+  std::optional<std::uint16_t> held_target_address{};
+
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation([this, &kDiagRequest, &held_target_address]() {
+        // Single routing activation for both conversations
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddressOne,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .Times(2)
+            .WillRepeatedly(::testing::Invoke([this, &kDiagRequest, &held_target_address](
+                                                  std::uint16_t client_source_address,
+                                                  std::uint16_t server_target_address,
+                                                  core_type::Span<std::uint8_t const> diag_request) {
+              EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+              EXPECT_THAT(diag_request, testing::ElementsAreArray(kDiagRequest));
+              if (!held_target_address.has_value()) {
+                // Hold back the first request until the second one is in flight
+                held_target_address = server_target_address;
+                return;
+              }
+              // Acknowledge and answer the second request before the first one
+              for (std::uint16_t const target_address:
+                   {server_target_address, held_target_address.value()}) {
+                doip_tcp_handler_->SendTcpMessage(
+                    common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                        target_address, client_source_address,
+                        kDoipDiagnosticMessagePosAckCodeConfirm));
+              }
+              for (std::uint16_t const target_address:
+                   {server_target_address, held_target_address.value()}) {
+                UdsMessage::ByteVector const diag_response{
+                    0x62, 0xF1, 0x8A, static_cast<std::uint8_t>(target_address >> 8u),
+                    static_cast<std::uint8_t>(target_address)};
+                doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                    target_address, client_source_address,
+                    core_type::Span<std::uint8_t const>{diag_response}));
+              }
+            }));
+      })};
+
+  diag::client::conversation::DiagClientConversation conversation_one{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  diag::client::conversation::DiagClientConversation conversation_two{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterTwo")};
+  conversation_one.Startup();
+  conversation_two.Startup();
+  EXPECT_EQ(conversation_one.ConnectToDiagServer(kDiagServerLogicalAddressOne, kDiagTcpIpAddress),
+            diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+  EXPECT_EQ(conversation_two.ConnectToDiagServer(kDiagServerLogicalAddressTwo, kDiagTcpIpAddress),
+            diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // Send both requests at the same time
+  auto send_request = [&kDiagRequest](
+                          diag::client::conversation::DiagClientConversation& conversation) {
+    return conversation.SendDiagnosticRequest(
+        std::make_unique<UdsMessage>(kDiagTcpIpAddress, kDiagRequest));
+  };
+  auto diag_result_one{
+      std::async(std::launch::async, send_request, std::ref(conversation_one))};
+  auto diag_result_two{
+      std::async(std::launch::async, send_request, std::ref(conversation_two))};
+
+  // Each conversation receives the response of its own target address
+  auto verify_response_from =
+      [](diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                              diag::client::conversation::DiagClientConversation::DiagError>
+             diag_result,
+         std::uint16_t target_address) {
+        ASSERT_TRUE(diag_result.HasValue());
+        EXPECT_THAT(diag_result.Value()->GetPayload(),
+                    testing::ElementsAre(0x62, 0xF1, 0x8A,
+                                         static_cast<std::uint8_t>(target_address >> 8u),
+                                         static_cast<std::uint8_t>(target_address)));
+      };
+  verify_response_from(diag_result_one.get(), kDiagServerLogicalAddressOne);
+  verify_response_from(diag_result_two.get(), kDiagServerLogicalAddressTwo);
+
+  EXPECT_EQ(
+      conversation_one.DisconnectFromDiagServer(),
+      diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  EXPECT_EQ(
+      conversation_two.DisconnectFromDiagServer(),
+      diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  conversation_one.Shutdown();
+  conversation_two.Shutdown();
+}
+
 }  // namespace test_cases
 }  // namespace component
 }  // namespace test
@@ -0,0 +1,46 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <thread>
+
+#include "utility/executor.h"
+
+namespace test {
+namespace component {
+namespace test_cases {
+
+/**
+ * @brief  Verify that jobs still queued when the executor is destroyed are executed.
+ */
+TEST(ExecutorTest, VerifyQueuedJobsExecutedOnDestruction) {
+  constexpr std::uint32_t kNumberOfJobs{10u};
+  std::uint32_t executed_jobs{0u};
+  {
+    utility::executor::Executor<std::function<void()>> executor{};
+    std::promise<void> job_started{};
+    executor.AddExecute([&job_started]() {
+      job_started.set_value();
+      std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    });
+    job_started.get_future().wait();
+    // queued behind the running job, destruction is requested before they run
+    for (std::uint32_t job{0u}; job < kNumberOfJobs; ++job) {
+      executor.AddExecute([&executed_jobs]() { ++executed_jobs; });
+    }
+  }
+  EXPECT_EQ(executed_jobs, kNumberOfJobs);
+}
+
+}  // namespace test_cases
+}  // namespace component
+}  // namespace test
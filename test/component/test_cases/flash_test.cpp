@@ -0,0 +1,595 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+#include "boost-support/server/tcp/tcp_acceptor.h"
+#include "boost-support/server/tcp/tcp_server.h"
+#include "common/handler/doip_tcp_handler.h"
+#include "component_test.h"
+#include "diag-client/create_diagnostic_client.h"
+#include "diag-client/diagnostic_client.h"
+
+namespace test {
+namespace component {
+namespace test_cases {
+// Diag Server name
+constexpr std::string_view kDiagServerName{"DiagServer"};
+// Diag Test Server Tcp Ip Address
+constexpr std::string_view kDiagTcpIpAddress{"172.16.25.128"};
+// Diag Test Server port number
+constexpr std::uint16_t kDiagTcpPortNum{13400U};
+// Diag Test Client logical address
+const std::uint16_t kDiagClientLogicalAddress{0x0001U};
+// Diag Test Server logical address
+const std::uint16_t kDiagServerLogicalAddress{0xFA25U};
+// Path to json file
+constexpr std::string_view kDiagClientConfigPath{"./etc/diag_client_config.json"};
+// Successful routing activation response code
+constexpr std::uint8_t kDoipRoutingActivationResCodeRoutingSuccessful{0x10U};
+// Diagnostic Message positive acknowledgement code
+constexpr std::uint8_t kDoipDiagnosticMessagePosAckCodeConfirm{0x00U};
+// Number of gateway connections, one per conversation
+constexpr std::size_t kNumberOfConnections{2u};
+
+// Bitwise reference CRC-32 of data
+std::uint32_t CalculateCrc32(core_type::Span<std::uint8_t const> data) {
+  std::uint32_t crc{0xFFFFFFFFu};
+  for (std::uint8_t const byte: data) {
+    crc ^= byte;
+    for (std::uint8_t bit{0u}; bit < 8u; ++bit) { crc = (crc >> 1u) ^ ((crc & 1u) ? 0xEDB88320u : 0u); }
+  }
+  return ~crc;
+}
+
+// Bitwise reference CRC-16/CCITT-FALSE of data
+std::uint16_t CalculateCrc16Ccitt(core_type::Span<std::uint8_t const> data) {
+  std::uint16_t crc{0xFFFFu};
+  for (std::uint8_t const byte: data) {
+    crc = static_cast<std::uint16_t>(crc ^ (byte << 8u));
+    for (std::uint8_t bit{0u}; bit < 8u; ++bit) {
+      crc = static_cast<std::uint16_t>((crc << 1u) ^ ((crc & 0x8000u) ? 0x1021u : 0u));
+    }
+  }
+  return crc;
+}
+
+// Fixture to test flashing of several ECUs behind one gateway
+class FlashFixture : public component::ComponentTest {
+ public:
+  using TcpAcceptor = boost_support::server::tcp::TcpAcceptor;
+
+  using TcpServer = boost_support::server::tcp::TcpServer;
+
+ protected:
+  FlashFixture()
+      : tcp_acceptor_{kDiagServerName, kDiagTcpIpAddress, kDiagTcpPortNum,
+                      static_cast<std::uint8_t>(kNumberOfConnections)},
+        doip_tcp_handlers_{},
+        diag_client_{diag::client::CreateDiagnosticClient(kDiagClientConfigPath)} {}
+
+  void SetUp() override {
+    ASSERT_TRUE(diag_client_->Initialize().HasValue());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  void TearDown() override {
+    for (std::optional<testing::StrictMock<common::handler::DoipTcpHandler>>& doip_tcp_handler:
+         doip_tcp_handlers_) {
+      if (doip_tcp_handler) { doip_tcp_handler->DeInitialize(); }
+    }
+    diag_client_->DeInitialize();
+  }
+
+  // Accept a connection per handler, the expectation is set on each handler
+  template<typename Functor>
+  auto CreateServersWithExpectation(Functor expectation_functor) noexcept -> std::future<bool> {
+    return std::async(std::launch::async,
+                      [this, expectation_functor = std::move(expectation_functor)]() {
+                        bool is_created{true};
+                        for (std::size_t index{0u}; index < kNumberOfConnections; ++index) {
+                          std::optional<TcpServer> server{tcp_acceptor_.GetTcpServer()};
+                          if (server.has_value()) {
+                            doip_tcp_handlers_[index].emplace(std::move(server).value());
+                            doip_tcp_handlers_[index]->Initialize();
+                            expectation_functor(*doip_tcp_handlers_[index]);
+                          } else {
+                            is_created = false;
+                          }
+                        }
+                        return is_created;
+                      });
+  }
+
+ protected:
+  // tcp acceptor
+  TcpAcceptor tcp_acceptor_;
+
+  // doip tcp handler of every accepted connection
+  std::array<std::optional<testing::StrictMock<common::handler::DoipTcpHandler>>,
+             kNumberOfConnections>
+      doip_tcp_handlers_;
+
+  // diag client library
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+// Fixture to test download of an image into one ECU
+class DownloadFixture : public component::ComponentTest {
+ public:
+  using TcpAcceptor = boost_support::server::tcp::TcpAcceptor;
+
+  using TcpServer = boost_support::server::tcp::TcpServer;
+
+ protected:
+  DownloadFixture()
+      : tcp_acceptor_{kDiagServerName, kDiagTcpIpAddress, kDiagTcpPortNum, 1u},
+        doip_tcp_handler_{},
+        diag_client_{diag::client::CreateDiagnosticClient(kDiagClientConfigPath)} {}
+
+  void SetUp() override {
+    ASSERT_TRUE(diag_client_->Initialize().HasValue());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  void TearDown() override {
+    if (doip_tcp_handler_) { doip_tcp_handler_->DeInitialize(); }
+    diag_client_->DeInitialize();
+  }
+
+  template<typename Functor>
+  auto CreateServerWithExpectation(Functor expectation_functor) noexcept -> std::future<bool> {
+    return std::async(std::launch::async,
+                      [this, expectation_functor = std::move(expectation_functor)]() {
+                        std::optional<TcpServer> server{tcp_acceptor_.GetTcpServer()};
+                        if (server.has_value()) {
+                          doip_tcp_handler_.emplace(std::move(server).value());
+                          doip_tcp_handler_->Initialize();
+                          // Set Expectation
+                          expectation_functor();
+                        }
+                        return doip_tcp_handler_.has_value();
+                      });
+  }
+
+ protected:
+  // tcp acceptor
+  TcpAcceptor tcp_acceptor_;
+
+  // doip tcp handler
+  std::optional<testing::StrictMock<common::handler::DoipTcpHandler>> doip_tcp_handler_;
+
+  // diag client library
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+/**
+ * @brief  Verify that ECUs on different buses are flashed concurrently with session and security tracked.
+ */
+TEST_F(FlashFixture, VerifyConcurrentFlash) {
+  constexpr std::array<std::string_view, 2u> kImagePaths{"./flash_image_a.bin",
+                                                         "./flash_image_b.bin"};
+  constexpr std::size_t kImageLength{600u};
+  for (std::string_view const image_path: kImagePaths) {
+    std::vector<char> const image(kImageLength, 0x5A);
+    std::ofstream image_file{std::string{image_path}, std::ios::binary};
+    image_file.write(image.data(), static_cast<std::streamsize>(image.size()));
+  }
+
+  // RequestTransferExit is answered only once both ECUs reached it, which requires concurrency
+  std::mutex transfer_exit_lock{};
+  std::vector<std::pair<common::handler::DoipTcpHandler*, std::pair<std::uint16_t, std::uint16_t>>>
+      transfer_exit_pending{};
+
+  std::future<bool> is_server_created{CreateServersWithExpectation(
+      [&transfer_exit_lock, &transfer_exit_pending](common::handler::DoipTcpHandler& handler) {
+        EXPECT_CALL(handler,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([&handler](std::uint16_t client_source_address,
+                                                   std::uint8_t, std::optional<std::uint8_t>) {
+              handler.SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(handler, ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillRepeatedly(::testing::Invoke(
+                [&handler, &transfer_exit_lock, &transfer_exit_pending](
+                    std::uint16_t client_source_address, std::uint16_t server_target_address,
+                    core_type::Span<std::uint8_t const> diag_request) {
+                  handler.SendTcpMessage(
+                      common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                          server_target_address, client_source_address,
+                          kDoipDiagnosticMessagePosAckCodeConfirm));
+                  std::vector<std::uint8_t> diag_response{};
+                  switch (diag_request[0u]) {
+                    case 0x10:
+                      diag_response = {0x50, diag_request[1u], 0x00, 0x32, 0x01, 0xF4};
+                      break;
+                    case 0x27:
+                      // seed 0x1234, key is the inverted seed
+                      if (diag_request[1u] == 0x01) {
+                        diag_response = {0x67, 0x01, 0x12, 0x34};
+                      } else {
+                        EXPECT_THAT(diag_request, testing::ElementsAre(0x27, 0x02, 0xED, 0xCB));
+                        diag_response = {0x67, 0x02};
+                      }
+                      break;
+                    case 0x34:
+                      // 100 image bytes per block
+                      diag_response = {0x74, 0x10, 0x66};
+                      break;
+                    case 0x36:
+                      diag_response = {0x76, diag_request[1u]};
+                      break;
+                    case 0x37: {
+                      std::lock_guard<std::mutex> const lck{transfer_exit_lock};
+                      transfer_exit_pending.emplace_back(
+                          &handler, std::make_pair(server_target_address, client_source_address));
+                      if (transfer_exit_pending.size() == kNumberOfConnections) {
+                        std::vector<std::uint8_t> const transfer_exit_response{0x77, 0x00};
+                        for (auto const& pending: transfer_exit_pending) {
+                          pending.first->SendTcpMessage(
+                              common::handler::ComposeDiagnosticResponseMessage(
+                                  pending.second.first, pending.second.second,
+                                  core_type::Span<std::uint8_t const>{transfer_exit_response}));
+                        }
+                      }
+                      break;
+                    }
+                    default:
+                      diag_response = {0x7F, diag_request[0u], 0x11};
+                      break;
+                  }
+                  if (!diag_response.empty()) {
+                    handler.SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                        server_target_address, client_source_address,
+                        core_type::Span<std::uint8_t const>{diag_response}));
+                  }
+                }));
+      })};
+
+  diag::client::flash::FlashRequestType flash_request{};
+  flash_request.conversation_names = {"DiagTesterOne", "DiagTesterTwo"};
+  flash_request.max_sessions_per_gateway = 2u;
+  flash_request.max_sessions_per_bus = 1u;
+  flash_request.security_key_handler = [](diag::client::flash::EcuFlashRequest const&,
+                                          core_type::Span<std::uint8_t const> seed) {
+    std::vector<std::uint8_t> key{};
+    for (std::uint8_t const byte: seed) { key.emplace_back(static_cast<std::uint8_t>(~byte)); }
+    return key;
+  };
+  for (std::size_t index{0u}; index < kImagePaths.size(); ++index) {
+    diag::client::flash::EcuFlashRequest ecu_request{};
+    ecu_request.ecu_name = index == 0u ? "EcuA" : "EcuB";
+    ecu_request.gateway_ip_address = std::string{kDiagTcpIpAddress};
+    ecu_request.target_address = static_cast<std::uint16_t>(0x1010u + index);
+    ecu_request.bus_id = static_cast<std::uint16_t>(index);
+    ecu_request.download_request.image_path = std::string{kImagePaths[index]};
+    if (index == 0u) { ecu_request.security_level = 0x01u; }
+    flash_request.ecu_requests.emplace_back(std::move(ecu_request));
+  }
+
+  std::size_t max_active_ecus{0u};
+  diag::client::flash::FlashProgress last_progress{};
+  diag::client::Result<diag::client::flash::FlashResponseType,
+                       diag::client::DiagClient::FlashError>
+      flash_result{diag_client_->SendFlashRequest(
+          std::move(flash_request),
+          [&max_active_ecus, &last_progress](diag::client::flash::FlashProgress const& progress,
+                                             diag::client::flash::EcuFlashState const&) {
+            max_active_ecus = std::max(max_active_ecus, progress.active_ecus);
+            last_progress = progress;
+          })};
+
+  ASSERT_TRUE(is_server_created.get());
+  ASSERT_TRUE(flash_result.HasValue());
+  ASSERT_EQ(flash_result.Value().ecu_states.size(), 2u);
+  for (diag::client::flash::EcuFlashState const& ecu_state: flash_result.Value().ecu_states) {
+    EXPECT_EQ(ecu_state.phase, diag::client::flash::FlashPhase::kCompleted);
+    EXPECT_EQ(ecu_state.session, diag::client::flash::DiagnosticSession::kProgrammingSession);
+    EXPECT_EQ(ecu_state.transferred_length, kImageLength);
+    EXPECT_EQ(ecu_state.download_response.block_timings.size(), 6u);
+  }
+  EXPECT_EQ(flash_result.Value().ecu_states[0u].security,
+            diag::client::flash::SecurityState::kUnlocked);
+  EXPECT_EQ(flash_result.Value().ecu_states[1u].security,
+            diag::client::flash::SecurityState::kLocked);
+  EXPECT_EQ(max_active_ecus, 2u);
+  EXPECT_EQ(last_progress.completed_ecus, 2u);
+  EXPECT_EQ(last_progress.active_ecus, 0u);
+  EXPECT_EQ(last_progress.total_length, 2u * kImageLength);
+  EXPECT_EQ(last_progress.transferred_length, 2u * kImageLength);
+
+  for (std::string_view const image_path: kImagePaths) {
+    std::remove(std::string{image_path}.c_str());
+  }
+}
+
+/**
+ * @brief  Verify that flash request without conversation is rejected.
+ */
+TEST_F(FlashFixture, VerifyFlashWithoutConversationRejected) {
+  diag::client::flash::FlashRequestType flash_request{};
+  flash_request.ecu_requests.emplace_back();
+
+  diag::client::Result<diag::client::flash::FlashResponseType,
+                       diag::client::DiagClient::FlashError>
+      flash_result{diag_client_->SendFlashRequest(std::move(flash_request), {})};
+
+  ASSERT_FALSE(flash_result.HasValue());
+  EXPECT_EQ(flash_result.Error(), diag::client::DiagClient::FlashError::kInvalidParameter);
+}
+
+/**
+ * @brief  Verify that image is downloaded in blocks of the maximum length accepted by server.
+ */
+TEST_F(DownloadFixture, VerifyDownload) {
+  // maxNumberOfBlockLength of 258 bytes, 256 image bytes per block
+  std::vector<std::uint8_t> kRequestDownloadResponse{0x74, 0x20, 0x01, 0x02};
+  constexpr std::size_t kBlockDataLength{256u};
+  constexpr std::string_view kImagePath{"./flash_image.bin"};
+  std::vector<std::uint8_t> kImage(1000u);
+  for (std::size_t index{0u}; index < kImage.size(); ++index) {
+    kImage[index] = static_cast<std::uint8_t>(index * 7u);
+  }
+  {
+    std::ofstream image_file{std::string{kImagePath}, std::ios::binary};
+    image_file.write(reinterpret_cast<char const*>(kImage.data()),
+                     static_cast<std::streamsize>(kImage.size()));
+  }
+
+  std::vector<std::uint8_t> downloaded_image{};
+  std::vector<std::uint8_t> block_sequence_counters{};
+  std::future<bool> is_server_created{CreateServerWithExpectation(
+      [this, &kRequestDownloadResponse, &kImage, &downloaded_image, &block_sequence_counters]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillRepeatedly(::testing::Invoke([this, &kRequestDownloadResponse, &kImage,
+                                               &downloaded_image, &block_sequence_counters](
+                                                  std::uint16_t, std::uint16_t,
+                                                  core_type::Span<std::uint8_t const> diag_request) {
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              std::vector<std::uint8_t> diag_response{};
+              switch (diag_request[0u]) {
+                case 0x34:
+                  // memory address 0x00001000 and memory size of image
+                  EXPECT_THAT(diag_request,
+                              testing::ElementsAre(0x34, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00, 0x00,
+                                                   0x00, 0x03, 0xE8));
+                  diag_response = kRequestDownloadResponse;
+                  break;
+                case 0x36:
+                  EXPECT_LE(diag_request.size(), 2u + kBlockDataLength);
+                  block_sequence_counters.emplace_back(diag_request[1u]);
+                  downloaded_image.insert(downloaded_image.end(), diag_request.begin() + 2u,
+                                          diag_request.end());
+                  diag_response = std::vector<std::uint8_t>{0x76, diag_request[1u]};
+                  break;
+                case 0x37:
+                  EXPECT_EQ(downloaded_image.size(), kImage.size());
+                  // with transferResponseParameterRecord
+                  diag_response = std::vector<std::uint8_t>{0x77, 0x00};
+                  break;
+                default:
+                  diag_response = std::vector<std::uint8_t>{0x7F, diag_request[0u], 0x11};
+                  break;
+              }
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{diag_response}));
+            }));
+      })};
+
+  diag::client::conversation::DiagClientConversation diag_client_conversation{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+  EXPECT_EQ(
+      diag_client_conversation.ConnectToDiagServer(kDiagServerLogicalAddress, kDiagTcpIpAddress),
+      diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  diag::client::flash::DownloadRequestType download_request{};
+  download_request.image_path = std::string{kImagePath};
+  download_request.memory_address = 0x1000u;
+  download_request.checksum_type = diag::client::flash::ChecksumType::kCrc32;
+
+  diag::client::Result<diag::client::flash::DownloadResponseType,
+                       diag::client::conversation::DiagClientConversation::DownloadError>
+      download_result{
+          diag_client_conversation.SendDownloadRequest(download_request)};
+
+  ASSERT_TRUE(download_result.HasValue());
+  EXPECT_EQ(download_result.Value().max_number_of_block_length, 258u);
+  EXPECT_EQ(download_result.Value().transferred_length, kImage.size());
+  ASSERT_EQ(download_result.Value().block_timings.size(), 4u);
+  EXPECT_EQ(download_result.Value().block_timings.back().block_length, 232u);
+  EXPECT_THAT(block_sequence_counters, testing::ElementsAre(0x01, 0x02, 0x03, 0x04));
+  EXPECT_THAT(downloaded_image, testing::ElementsAreArray(kImage));
+  ASSERT_EQ(download_result.Value().segment_checksums.size(), 1u);
+  EXPECT_EQ(download_result.Value().segment_checksums[0u].memory_address, 0x1000u);
+  EXPECT_EQ(download_result.Value().segment_checksums[0u].memory_size, kImage.size());
+  EXPECT_EQ(download_result.Value().segment_checksums[0u].checksum,
+            CalculateCrc32(core_type::Span<std::uint8_t const>{kImage}));
+  std::remove(std::string{kImagePath}.c_str());
+
+  EXPECT_EQ(
+      diag_client_conversation.DisconnectFromDiagServer(),
+      diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  diag_client_conversation.Shutdown();
+}
+
+/**
+ * @brief  Verify that every address range of Intel HEX image is downloaded with its own RequestDownload.
+ */
+TEST_F(DownloadFixture, VerifyDownloadIntelHexSegments) {
+  std::vector<std::uint8_t> kRequestDownloadResponse{0x74, 0x20, 0x01, 0x02};
+  constexpr std::string_view kImagePath{"./flash_image.hex"};
+  // Intel HEX record with checksum appended
+  auto const compose_record = [](std::uint16_t address, std::uint8_t type,
+                                 std::vector<std::uint8_t> const& data) {
+    std::vector<std::uint8_t> record{static_cast<std::uint8_t>(data.size()),
+                                  static_cast<std::uint8_t>(address >> 8u),
+                                  static_cast<std::uint8_t>(address), type};
+    record.insert(record.end(), data.begin(), data.end());
+    std::uint8_t checksum{0u};
+    for (std::uint8_t const byte: record) { checksum = static_cast<std::uint8_t>(checksum + byte); }
+    record.emplace_back(static_cast<std::uint8_t>(0x100u - checksum));
+    std::stringstream line{};
+    line << ':' << std::hex << std::uppercase << std::setfill('0');
+    for (std::uint8_t const byte: record) { line << std::setw(2) << static_cast<std::uint32_t>(byte); }
+    line << "\r\n";
+    return line.str();
+  };
+  // 32 bytes at 0x00001000 in two records, 16 bytes at 0x00012000 after extended linear address
+  std::vector<std::uint8_t> kImage(48u);
+  for (std::size_t index{0u}; index < kImage.size(); ++index) {
+    kImage[index] = static_cast<std::uint8_t>(index * 3u);
+  }
+  {
+    std::ofstream image_file{std::string{kImagePath}, std::ios::binary};
+    image_file << compose_record(0x1000u, 0x00u, {kImage.begin(), kImage.begin() + 16})
+               << compose_record(0x1010u, 0x00u, {kImage.begin() + 16, kImage.begin() + 32})
+               << compose_record(0x0000u, 0x04u, {0x00, 0x01})
+               << compose_record(0x2000u, 0x00u, {kImage.begin() + 32, kImage.end()})
+               << compose_record(0x0000u, 0x01u, {});
+  }
+
+  std::vector<std::uint8_t> downloaded_image{};
+  std::vector<std::vector<std::uint8_t>> request_downloads{};
+  std::future<bool> is_server_created{CreateServerWithExpectation(
+      [this, &kRequestDownloadResponse, &downloaded_image, &request_downloads]() {
+        // Create an expectation of routing activation response
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+            .WillOnce(::testing::Invoke([this](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+              // Send Routing activation response
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+                  client_source_address, kDiagServerLogicalAddress,
+                  kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+            }));
+
+        EXPECT_CALL(*doip_tcp_handler_,
+                    ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .WillRepeatedly(::testing::Invoke([this, &kRequestDownloadResponse, &downloaded_image,
+                                               &request_downloads](
+                                                  std::uint16_t, std::uint16_t,
+                                                  core_type::Span<std::uint8_t const> diag_request) {
+              doip_tcp_handler_->SendTcpMessage(
+                  common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                      kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                      kDoipDiagnosticMessagePosAckCodeConfirm));
+              std::vector<std::uint8_t> diag_response{};
+              switch (diag_request[0u]) {
+                case 0x34:
+                  request_downloads.emplace_back(diag_request.begin(), diag_request.end());
+                  diag_response = kRequestDownloadResponse;
+                  break;
+                case 0x36:
+                  EXPECT_EQ(diag_request[1u], 0x01);
+                  downloaded_image.insert(downloaded_image.end(), diag_request.begin() + 2u,
+                                          diag_request.end());
+                  diag_response = std::vector<std::uint8_t>{0x76, diag_request[1u]};
+                  break;
+                case 0x37:
+                  diag_response = std::vector<std::uint8_t>{0x77, 0x00};
+                  break;
+                default:
+                  diag_response = std::vector<std::uint8_t>{0x7F, diag_request[0u], 0x11};
+                  break;
+              }
+              doip_tcp_handler_->SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  kDiagServerLogicalAddress, kDiagClientLogicalAddress,
+                  core_type::Span<std::uint8_t const>{diag_response}));
+            }));
+      })};
+
+  diag::client::conversation::DiagClientConversation diag_client_conversation{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  diag_client_conversation.Startup();
+  EXPECT_EQ(
+      diag_client_conversation.ConnectToDiagServer(kDiagServerLogicalAddress, kDiagTcpIpAddress),
+      diag::client::conversation::DiagClientConversation::ConnectResult::kConnectSuccess);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  diag::client::flash::DownloadRequestType download_request{};
+  download_request.image_path = std::string{kImagePath};
+  download_request.checksum_type = diag::client::flash::ChecksumType::kCrc16Ccitt;
+
+  diag::client::Result<diag::client::flash::DownloadResponseType,
+                       diag::client::conversation::DiagClientConversation::DownloadError>
+      download_result{
+          diag_client_conversation.SendDownloadRequest(download_request)};
+
+  ASSERT_TRUE(download_result.HasValue());
+  EXPECT_EQ(download_result.Value().transferred_length, kImage.size());
+  EXPECT_EQ(download_result.Value().block_timings.size(), 2u);
+  ASSERT_EQ(download_result.Value().segment_checksums.size(), 2u);
+  EXPECT_EQ(download_result.Value().segment_checksums[0u].checksum,
+            CalculateCrc16Ccitt(core_type::Span<std::uint8_t const>{kImage.data(), 32u}));
+  EXPECT_EQ(download_result.Value().segment_checksums[1u].memory_address, 0x00012000u);
+  EXPECT_EQ(download_result.Value().segment_checksums[1u].checksum,
+            CalculateCrc16Ccitt(core_type::Span<std::uint8_t const>{kImage.data() + 32u, 16u}));
+  ASSERT_EQ(request_downloads.size(), 2u);
+  EXPECT_THAT(request_downloads[0u], testing::ElementsAre(0x34, 0x00, 0x44, 0x00, 0x00, 0x10, 0x00,
+                                                          0x00, 0x00, 0x00, 0x20));
+  EXPECT_THAT(request_downloads[1u], testing::ElementsAre(0x34, 0x00, 0x44, 0x00, 0x01, 0x20, 0x00,
+                                                          0x00, 0x00, 0x00, 0x10));
+  EXPECT_THAT(downloaded_image, testing::ElementsAreArray(kImage));
+
+  // a corrupted checksum is rejected before anything is sent
+  {
+    std::ofstream image_file{std::string{kImagePath}, std::ios::binary};
+    image_file << ":0210000001020000\r\n:00000001FF\r\n";
+  }
+  diag::client::Result<diag::client::flash::DownloadResponseType,
+                       diag::client::conversation::DiagClientConversation::DownloadError>
+      invalid_download_result{
+          diag_client_conversation.SendDownloadRequest(download_request)};
+  ASSERT_FALSE(invalid_download_result.HasValue());
+  EXPECT_EQ(invalid_download_result.Error(),
+            diag::client::conversation::DiagClientConversation::DownloadError::kImageInvalid);
+  EXPECT_EQ(request_downloads.size(), 2u);
+  std::remove(std::string{kImagePath}.c_str());
+
+  EXPECT_EQ(
+      diag_client_conversation.DisconnectFromDiagServer(),
+      diag::client::conversation::DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+  diag_client_conversation.Shutdown();
+}
+
+}  // namespace test_cases
+}  // namespace component
+}  // namespace test
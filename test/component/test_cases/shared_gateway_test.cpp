@@ -0,0 +1,359 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <future>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "boost-support/server/tcp/tcp_acceptor.h"
+#include "boost-support/server/tcp/tcp_server.h"
+#include "common/handler/doip_tcp_handler.h"
+#include "component_test.h"
+#include "diag-client/create_diagnostic_client.h"
+#include "diag-client/diagnostic_client.h"
+
+namespace test {
+namespace component {
+namespace test_cases {
+// Diag Server name
+constexpr std::string_view kDiagServerName{"DiagServer"};
+// Diag Test Server Tcp Ip Address
+constexpr std::string_view kDiagTcpIpAddress{"172.16.25.128"};
+// Diag Test Server port number
+constexpr std::uint16_t kDiagTcpPortNum{13400U};
+// Diag Test Client logical address, shared by both conversations
+const std::uint16_t kDiagClientLogicalAddress{0x0001U};
+// Logical address of first ECU behind the gateway
+const std::uint16_t kDiagServerLogicalAddressOne{0x1010U};
+// Logical address of second ECU behind the gateway
+const std::uint16_t kDiagServerLogicalAddressTwo{0x1011U};
+// Path to json file with both conversations using the same source address
+constexpr std::string_view kDiagClientConfigPath{"./etc/diag_client_shared_gateway_config.json"};
+// Successful routing activation response code
+constexpr std::uint8_t kDoipRoutingActivationResCodeRoutingSuccessful{0x10U};
+// Diagnostic Message positive acknowledgement code
+constexpr std::uint8_t kDoipDiagnosticMessagePosAckCodeConfirm{0x00U};
+// Maximum number of gateway connections accepted
+constexpr std::size_t kMaxNumberOfConnections{2u};
+// Size of large request, exceeding the socket send buffer so that it is sent in several partial writes
+constexpr std::size_t kLargeRequestSize{1048576u};
+// Number of large requests sent by every conversation
+constexpr std::size_t kNumberOfLargeRequests{4u};
+
+// Uds request message sent to an ECU behind the gateway
+class DiagRequestMessage : public diag::client::uds_message::UdsMessage {
+ public:
+  // ctor
+  DiagRequestMessage(std::string_view host_ip_address, ByteVector payload)
+      : host_ip_address_{host_ip_address},
+        uds_payload_{std::move(payload)} {}
+
+  // dtor
+  ~DiagRequestMessage() override = default;
+
+ private:
+  // host ip address
+  IpAddress host_ip_address_;
+  // store only UDS payload to be sent
+  ByteVector uds_payload_;
+
+  const ByteVector& GetPayload() const override { return uds_payload_; }
+
+  ByteVector& GetPayload() override { return uds_payload_; }
+
+  IpAddress GetHostIpAddress() const noexcept override { return host_ip_address_; }
+};
+
+// Fixture to test sharing of gateway connection between conversations
+class SharedGatewayFixture : public component::ComponentTest {
+ public:
+  using TcpAcceptor = boost_support::server::tcp::TcpAcceptor;
+
+  using TcpServer = boost_support::server::tcp::TcpServer;
+
+  using DiagClientConversation = diag::client::conversation::DiagClientConversation;
+
+ protected:
+  SharedGatewayFixture()
+      : tcp_acceptor_{kDiagServerName, kDiagTcpIpAddress, kDiagTcpPortNum,
+                      static_cast<std::uint8_t>(kMaxNumberOfConnections)},
+        doip_tcp_handlers_{},
+        diag_client_{diag::client::CreateDiagnosticClient(kDiagClientConfigPath)} {}
+
+  void SetUp() override {
+    ASSERT_TRUE(diag_client_->Initialize().HasValue());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  void TearDown() override {
+    for (std::optional<testing::StrictMock<common::handler::DoipTcpHandler>>& doip_tcp_handler:
+         doip_tcp_handlers_) {
+      if (doip_tcp_handler) { doip_tcp_handler->DeInitialize(); }
+    }
+    diag_client_->DeInitialize();
+  }
+
+  // Accept the next connection, the expectation is set on its handler
+  template<typename Functor>
+  auto CreateServerWithExpectation(std::size_t index, Functor expectation_functor) noexcept
+      -> std::future<bool> {
+    return std::async(std::launch::async,
+                      [this, index, expectation_functor = std::move(expectation_functor)]() {
+                        std::optional<TcpServer> server{tcp_acceptor_.GetTcpServer()};
+                        if (server.has_value()) {
+                          doip_tcp_handlers_[index].emplace(std::move(server).value());
+                          doip_tcp_handlers_[index]->Initialize();
+                          expectation_functor(*doip_tcp_handlers_[index]);
+                        }
+                        return doip_tcp_handlers_[index].has_value();
+                      });
+  }
+
+  // Expect one routing activation on the connection
+  static void ExpectRoutingActivation(common::handler::DoipTcpHandler& handler) {
+    EXPECT_CALL(handler, ProcessRoutingActivationRequestMessage(testing::_, testing::_, testing::_))
+        .WillOnce(::testing::Invoke([&handler](std::uint16_t client_source_address, std::uint8_t,
+                                               std::optional<std::uint8_t>) {
+          EXPECT_EQ(client_source_address, kDiagClientLogicalAddress);
+          handler.SendTcpMessage(common::handler::ComposeRoutingActivationResponse(
+              client_source_address, kDiagServerLogicalAddressOne,
+              kDoipRoutingActivationResCodeRoutingSuccessful, std::nullopt));
+        }));
+  }
+
+  // Expect diagnostic requests on the connection, answered by the addressed ECU with its address
+  static void ExpectDiagnosticRequests(common::handler::DoipTcpHandler& handler,
+                                       std::size_t number_of_requests) {
+    EXPECT_CALL(handler, ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+        .Times(static_cast<int>(number_of_requests))
+        .WillRepeatedly(::testing::Invoke([&handler](std::uint16_t client_source_address,
+                                                     std::uint16_t server_target_address,
+                                                     core_type::Span<std::uint8_t const>) {
+          handler.SendTcpMessage(common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+              server_target_address, client_source_address,
+              kDoipDiagnosticMessagePosAckCodeConfirm));
+          std::vector<std::uint8_t> const diag_response{
+              0x62, 0xF1, 0x8A, static_cast<std::uint8_t>(server_target_address >> 8u),
+              static_cast<std::uint8_t>(server_target_address)};
+          handler.SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+              server_target_address, client_source_address,
+              core_type::Span<std::uint8_t const>{diag_response}));
+        }));
+  }
+
+  // Connect the conversation to the ECU behind the gateway
+  static void Connect(DiagClientConversation& conversation, std::uint16_t target_address) {
+    conversation.Startup();
+    EXPECT_EQ(conversation.ConnectToDiagServer(target_address, kDiagTcpIpAddress),
+              DiagClientConversation::ConnectResult::kConnectSuccess);
+  }
+
+  // Disconnect the conversation from the ECU behind the gateway
+  static void Disconnect(DiagClientConversation& conversation) {
+    EXPECT_EQ(conversation.DisconnectFromDiagServer(),
+              DiagClientConversation::DisconnectResult::kDisconnectSuccess);
+    conversation.Shutdown();
+  }
+
+  // Send request and verify the response was sent by the ECU addressed
+  static void VerifyResponseFrom(DiagClientConversation& conversation,
+                                 std::uint16_t target_address) {
+    diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                         DiagClientConversation::DiagError>
+        diag_result{conversation.SendDiagnosticRequest(std::make_unique<DiagRequestMessage>(
+            kDiagTcpIpAddress, DiagRequestMessage::ByteVector{0x22, 0xF1, 0x8A}))};
+    ASSERT_TRUE(diag_result.HasValue());
+    EXPECT_THAT(diag_result.Value()->GetPayload(),
+                testing::ElementsAre(0x62, 0xF1, 0x8A,
+                                     static_cast<std::uint8_t>(target_address >> 8u),
+                                     static_cast<std::uint8_t>(target_address)));
+  }
+
+ protected:
+  // tcp acceptor
+  TcpAcceptor tcp_acceptor_;
+
+  // doip tcp handler of every accepted connection
+  std::array<std::optional<testing::StrictMock<common::handler::DoipTcpHandler>>,
+             kMaxNumberOfConnections>
+      doip_tcp_handlers_;
+
+  // diag client library
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+/**
+ * @brief  Verify that conversations towards different ECUs share one connection and receive their own responses.
+ */
+TEST_F(SharedGatewayFixture, VerifyConnectionSharedAndRoutedByTargetAddress) {
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation(0u, [](common::handler::DoipTcpHandler& handler) {
+        // single routing activation for both conversations
+        ExpectRoutingActivation(handler);
+        ExpectDiagnosticRequests(handler, 2u);
+      })};
+
+  DiagClientConversation conversation_one{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  DiagClientConversation conversation_two{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterTwo")};
+  Connect(conversation_one, kDiagServerLogicalAddressOne);
+  Connect(conversation_two, kDiagServerLogicalAddressTwo);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  VerifyResponseFrom(conversation_two, kDiagServerLogicalAddressTwo);
+  VerifyResponseFrom(conversation_one, kDiagServerLogicalAddressOne);
+
+  Disconnect(conversation_two);
+  Disconnect(conversation_one);
+}
+
+/**
+ * @brief  Verify that connection stays with remaining conversation and is closed when the last conversation leaves.
+ */
+TEST_F(SharedGatewayFixture, VerifyConnectionClosedWhenLastConversationLeaves) {
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation(0u, [](common::handler::DoipTcpHandler& handler) {
+        ExpectRoutingActivation(handler);
+        ExpectDiagnosticRequests(handler, 1u);
+      })};
+
+  DiagClientConversation conversation_one{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  DiagClientConversation conversation_two{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterTwo")};
+  Connect(conversation_one, kDiagServerLogicalAddressOne);
+  Connect(conversation_two, kDiagServerLogicalAddressTwo);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  // the remaining conversation keeps using the connection
+  Disconnect(conversation_one);
+  VerifyResponseFrom(conversation_two, kDiagServerLogicalAddressTwo);
+  Disconnect(conversation_two);
+
+  // the next conversation establishes a new connection with its own routing activation
+  std::future<bool> is_next_server_created{
+      CreateServerWithExpectation(1u, [](common::handler::DoipTcpHandler& handler) {
+        ExpectRoutingActivation(handler);
+        ExpectDiagnosticRequests(handler, 1u);
+      })};
+  Connect(conversation_one, kDiagServerLogicalAddressOne);
+
+  ASSERT_TRUE(is_next_server_created.get());
+
+  VerifyResponseFrom(conversation_one, kDiagServerLogicalAddressOne);
+  Disconnect(conversation_one);
+}
+
+/**
+ * @brief  Verify that conversation addressing an ECU already in use on the gateway gets a dedicated connection.
+ */
+TEST_F(SharedGatewayFixture, VerifySameTargetAddressUsesDedicatedConnection) {
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation(0u, [](common::handler::DoipTcpHandler& handler) {
+        ExpectRoutingActivation(handler);
+        ExpectDiagnosticRequests(handler, 1u);
+      })};
+
+  DiagClientConversation conversation_one{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  Connect(conversation_one, kDiagServerLogicalAddressOne);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  std::future<bool> is_dedicated_server_created{
+      CreateServerWithExpectation(1u, [](common::handler::DoipTcpHandler& handler) {
+        ExpectRoutingActivation(handler);
+        ExpectDiagnosticRequests(handler, 1u);
+      })};
+  DiagClientConversation conversation_two{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterTwo")};
+  Connect(conversation_two, kDiagServerLogicalAddressOne);
+
+  ASSERT_TRUE(is_dedicated_server_created.get());
+
+  VerifyResponseFrom(conversation_one, kDiagServerLogicalAddressOne);
+  VerifyResponseFrom(conversation_two, kDiagServerLogicalAddressOne);
+
+  Disconnect(conversation_two);
+  Disconnect(conversation_one);
+}
+
+/**
+ * @brief  Verify that large requests sent at the same time by conversations sharing a connection are not
+ *         interleaved on the connection.
+ */
+TEST_F(SharedGatewayFixture, VerifyConcurrentLargeRequestsNotInterleaved) {
+  std::future<bool> is_server_created{
+      CreateServerWithExpectation(0u, [](common::handler::DoipTcpHandler& handler) {
+        ExpectRoutingActivation(handler);
+        EXPECT_CALL(handler, ProcessDiagnosticRequestMessage(testing::_, testing::_, testing::_))
+            .Times(static_cast<int>(2u * kNumberOfLargeRequests))
+            .WillRepeatedly(::testing::Invoke([&handler](
+                                                  std::uint16_t client_source_address,
+                                                  std::uint16_t server_target_address,
+                                                  core_type::Span<std::uint8_t const> diag_request) {
+              // every request is filled with the low byte of the ECU addressed
+              EXPECT_EQ(diag_request.size(), kLargeRequestSize);
+              EXPECT_TRUE(std::all_of(diag_request.begin() + 1, diag_request.end(),
+                                      [server_target_address](std::uint8_t const byte) {
+                                        return byte == static_cast<std::uint8_t>(server_target_address);
+                                      }));
+              handler.SendTcpMessage(common::handler::ComposeDiagnosticPositiveAcknowledgementMessage(
+                  server_target_address, client_source_address,
+                  kDoipDiagnosticMessagePosAckCodeConfirm));
+              std::vector<std::uint8_t> const diag_response{0x76, 0x01};
+              handler.SendTcpMessage(common::handler::ComposeDiagnosticResponseMessage(
+                  server_target_address, client_source_address,
+                  core_type::Span<std::uint8_t const>{diag_response}));
+            }));
+      })};
+
+  DiagClientConversation conversation_one{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterOne")};
+  DiagClientConversation conversation_two{
+      diag_client_->GetDiagnosticClientConversation("DiagTesterTwo")};
+  Connect(conversation_one, kDiagServerLogicalAddressOne);
+  Connect(conversation_two, kDiagServerLogicalAddressTwo);
+
+  ASSERT_TRUE(is_server_created.get());
+
+  auto send_large_requests = [](DiagClientConversation& conversation, std::uint16_t target_address) {
+    for (std::size_t count{0u}; count < kNumberOfLargeRequests; ++count) {
+      DiagRequestMessage::ByteVector payload(kLargeRequestSize,
+                                             static_cast<std::uint8_t>(target_address));
+      payload[0u] = 0x36;
+      diag::client::Result<diag::client::uds_message::UdsResponseMessagePtr,
+                           DiagClientConversation::DiagError>
+          diag_result{conversation.SendDiagnosticRequest(
+              std::make_unique<DiagRequestMessage>(kDiagTcpIpAddress, std::move(payload)))};
+      ASSERT_TRUE(diag_result.HasValue());
+      EXPECT_THAT(diag_result.Value()->GetPayload(), testing::ElementsAre(0x76, 0x01));
+    }
+  };
+  std::future<void> requests_one{std::async(std::launch::async, send_large_requests,
+                                            std::ref(conversation_one), kDiagServerLogicalAddressOne)};
+  std::future<void> requests_two{std::async(std::launch::async, send_large_requests,
+                                            std::ref(conversation_two), kDiagServerLogicalAddressTwo)};
+  requests_one.get();
+  requests_two.get();
+
+  Disconnect(conversation_two);
+  Disconnect(conversation_one);
+}
+
+}  // namespace test_cases
+}  // namespace component
+}  // namespace test
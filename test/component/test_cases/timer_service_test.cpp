@@ -0,0 +1,86 @@
+/* Diagnostic Client library
+ * Copyright (C) 2024  Avijit Dey
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "utility/timer_service.h"
+
+namespace test {
+namespace component {
+namespace test_cases {
+
+/**
+ * @brief  Verify that cancellation waits for the running callback even if its timer is reused meanwhile.
+ */
+TEST(TimerServiceTest, VerifyCancelWaitsForRunningCallbackOfReusedTimer) {
+  utility::timer::TimerService &timer_service{utility::timer::TimerService::GetTimerService()};
+  std::promise<void> callback_started{};
+  std::atomic<bool> callback_returned{false};
+
+  utility::timer::TimerService::TimerId const running_timer_id{
+      timer_service.Arm(std::chrono::milliseconds{10}, [&callback_started, &callback_returned]() {
+        callback_started.set_value();
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+        callback_returned.store(true);
+      })};
+  callback_started.get_future().wait();
+
+  // the timer released before invoking its callback is reused by the next timer armed
+  utility::timer::TimerService::TimerId const reused_timer_id{
+      timer_service.Arm(std::chrono::seconds{10}, []() {})};
+  EXPECT_NE(reused_timer_id, running_timer_id);
+
+  // cancellation of the running timer must return only after its callback returned
+  EXPECT_FALSE(timer_service.Cancel(running_timer_id));
+  EXPECT_TRUE(callback_returned.load());
+
+  EXPECT_TRUE(timer_service.Cancel(reused_timer_id));
+}
+
+/**
+ * @brief  Verify that cancellation of the invalid timer id returns immediately.
+ */
+TEST(TimerServiceTest, VerifyCancelOfInvalidTimerId) {
+  EXPECT_FALSE(utility::timer::TimerService::GetTimerService().Cancel(
+      utility::timer::TimerService::kInvalidTimerId));
+}
+
+/**
+ * @brief  Verify that a timer armed after the service was idle for longer than the maximum timeout expires
+ *         in time.
+ */
+TEST(TimerServiceTest, VerifyTimerArmedAfterLongIdlePeriod) {
+  // the service behaves as if started a day ago, without any timer armed since
+  utility::timer::TimerService timer_service{utility::timer::TimerService::Clock::now() -
+                                             std::chrono::hours{24}};
+  std::promise<std::chrono::steady_clock::time_point> timer_expired{};
+  std::future<std::chrono::steady_clock::time_point> timer_expired_future{
+      timer_expired.get_future()};
+
+  std::chrono::steady_clock::time_point const arm_time{std::chrono::steady_clock::now()};
+  static_cast<void>(timer_service.Arm(std::chrono::milliseconds{500}, [&timer_expired]() {
+    timer_expired.set_value(std::chrono::steady_clock::now());
+  }));
+  // arming is not blocked by advancing the wheel over the idle period
+  EXPECT_LT(std::chrono::steady_clock::now() - arm_time, std::chrono::milliseconds{100});
+
+  // neither expired early nor late
+  ASSERT_EQ(timer_expired_future.wait_for(std::chrono::seconds{2}), std::future_status::ready);
+  std::chrono::steady_clock::duration const expiry_time{timer_expired_future.get() - arm_time};
+  // the tick has a resolution of one millisecond
+  EXPECT_GE(expiry_time, std::chrono::milliseconds{499});
+  EXPECT_LT(expiry_time, std::chrono::milliseconds{750});
+}
+
+}  // namespace test_cases
+}  // namespace component
+}  // namespace test
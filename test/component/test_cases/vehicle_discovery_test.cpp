@@ -7,7 +7,10 @@
  */
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #include <string_view>
 #include <thread>
 
@@ -30,6 +33,17 @@ constexpr std::string_view kDiagUdpAnotherUnicastIpAddress{"172.16.25.129"};
 constexpr std::uint16_t kDiagUdpPortNum{13400u};
 // Path to json file
 constexpr std::string_view kDiagClientConfigPath{"./etc/diag_client_config.json"};
+// Diag Client Udp Ip Address of the first discovery endpoint
+constexpr std::string_view kDiagClientFirstInterfaceIpAddress{"172.16.25.127"};
+// Diag Client Udp Ip Address of the second discovery endpoint
+constexpr std::string_view kDiagClientSecondInterfaceIpAddress{"127.0.0.1"};
+// Diag Test Server Unicast Udp Ip Address behind the second discovery endpoint
+constexpr std::string_view kDiagUdpSecondInterfaceUnicastIpAddress{"127.0.0.2"};
+// Diag Test Server Broadcast Udp Ip Address behind the second discovery endpoint
+constexpr std::string_view kDiagUdpSecondInterfaceBroadCastIpAddress{"127.255.255.255"};
+// Path to json file with two discovery endpoints
+constexpr std::string_view kDiagClientMultiInterfaceConfigPath{
+    "./etc/diag_client_multi_interface_config.json"};
 
 // Fixture to test Vehicle discovery functionality
 class VehicleDiscoveryFixture : public component::ComponentTest {
@@ -194,6 +208,141 @@ TEST_F(VehicleDiscoveryFixture, VerifyPreselectionModeEid) {
   EXPECT_EQ(response_collection[0].gid, kGid);
 }
 
+/**
+ * @brief  Verify that vehicle identification request completes once the expected number of DoIP entities responded.
+ */
+TEST_F(VehicleDiscoveryFixture, VerifyExpectedResponseCountCompletesEarly) {
+  constexpr std::string_view kVin{"ABCDEFGH123456789"};
+  constexpr std::string_view kEid{"00:02:36:31:00:1c"};
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+  std::uint16_t const kLogicalAddress{0xFA25u};
+
+  // Create an expectation of vehicle identification response
+  EXPECT_CALL(doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(testing::_, testing::_,
+                                                                            testing::_, testing::_))
+      .WillOnce(
+          ::testing::Invoke([this, kVin, kEid, kGid](std::string_view client_ip_address,
+                                                     std::uint16_t client_port_number,
+                                                     std::string_view, std::string_view) {
+            // Send Vehicle Identification response
+            doip_udp_handler_.SendUdpMessage(doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kVin, kLogicalAddress, kEid, kGid, 0,
+                std::nullopt));
+          }));
+
+  // Send Vehicle Identification request expecting one DoIP entity
+  std::vector<diag::client::vehicle_info::VehicleAddrInfoResponse> streamed_responses{};
+  diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{2u, std::string{kEid},
+                                                                              1u};
+  auto const start{std::chrono::steady_clock::now()};
+  diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                       diag::client::DiagClient::VehicleInfoResponseError>
+      response{diag_client_->SendVehicleIdentificationRequest(
+          std::move(vehicle_info_request),
+          [&streamed_responses](
+              diag::client::vehicle_info::VehicleAddrInfoResponse const &vehicle_response) {
+            streamed_responses.emplace_back(vehicle_response);
+            return false;
+          })};
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  // Verify Vehicle identification response received before DoIPCtrl of 2 sec expired
+  ASSERT_TRUE(response.HasValue());
+  EXPECT_LT(elapsed.count(), 1.0);
+
+  // Verify the response was streamed exactly once and is part of the result
+  ASSERT_EQ(streamed_responses.size(), 1U);
+  EXPECT_EQ(streamed_responses[0].logical_address, kLogicalAddress);
+  EXPECT_EQ(streamed_responses[0].vin, kVin);
+  diag::client::vehicle_info::VehicleInfoMessage::VehicleInfoListResponseType const
+      response_collection{response.Value()->GetVehicleList()};
+  ASSERT_EQ(response_collection.size(), 1U);
+  EXPECT_EQ(response_collection[0].logical_address, kLogicalAddress);
+  EXPECT_EQ(response_collection[0].eid, kEid);
+}
+
+/**
+ * @brief  Verify that received vehicle announcements are added to the registry of DoIP entities and changes notified.
+ */
+TEST_F(VehicleDiscoveryFixture, VerifyVehicleAnnouncementRegistry) {
+  constexpr std::string_view kVin{"ABCDEFGH123456789"};
+  constexpr std::string_view kUpdatedVin{"QRSTUVWX123456789"};
+  constexpr std::string_view kEid{"00:02:36:31:00:1c"};
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+  std::uint16_t const kLogicalAddress{0xFA25u};
+  // Port on which test equipment receives vehicle announcements
+  std::uint16_t const kAnnouncementPortNum{13401u};
+
+  // Record every change notified
+  std::mutex change_mutex{};
+  std::condition_variable change_cond_var{};
+  std::vector<std::pair<diag::client::vehicle_info::VehicleEntityChange,
+                        diag::client::vehicle_info::VehicleEntity>>
+      changes{};
+  diag_client_->SetVehicleEntityChangeHandler(
+      [&change_mutex, &change_cond_var, &changes](
+          diag::client::vehicle_info::VehicleEntityChange change,
+          diag::client::vehicle_info::VehicleEntity const &entity) {
+        {
+          std::lock_guard<std::mutex> const lock{change_mutex};
+          changes.emplace_back(change, entity);
+        }
+        change_cond_var.notify_all();
+      });
+  auto const wait_for_changes{[&change_mutex, &change_cond_var, &changes](std::size_t count) {
+    std::unique_lock<std::mutex> lock{change_mutex};
+    return change_cond_var.wait_for(lock, std::chrono::seconds(1),
+                                    [&changes, count]() { return changes.size() >= count; });
+  }};
+
+  // Broadcast vehicle announcement, repeated as done by DoIP entities on start-up
+  auto const start{std::chrono::steady_clock::now()};
+  for (std::uint8_t repetition{0u}; repetition < 3u; repetition++) {
+    doip_udp_handler_.SendUdpMessage(doip_udp_handler_.ComposeVehicleIdentificationResponse(
+        kDiagUdpBroadCastIpAddress, kAnnouncementPortNum, kVin, kLogicalAddress, kEid, kGid, 0,
+        std::nullopt));
+  }
+  ASSERT_TRUE(wait_for_changes(1u));
+  // Give the repetitions time to arrive, they only refresh the entity
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  // Verify the DoIP entity is found by each of its keys
+  for (diag::client::vehicle_info::VehicleEntityFilter const &filter:
+       {diag::client::vehicle_info::VehicleEntityFilter{},
+        diag::client::vehicle_info::VehicleEntityFilter{kLogicalAddress, "", ""},
+        diag::client::vehicle_info::VehicleEntityFilter{std::nullopt, std::string{kVin}, ""},
+        diag::client::vehicle_info::VehicleEntityFilter{kLogicalAddress, std::string{kVin},
+                                                        std::string{kEid}}}) {
+    diag::client::vehicle_info::VehicleEntityListType const entities{
+        diag_client_->GetVehicleEntities(filter)};
+    ASSERT_EQ(entities.size(), 1U);
+    EXPECT_EQ(entities[0].address_info.ip_address, kDiagUdpUnicastIpAddress);
+    EXPECT_EQ(entities[0].address_info.logical_address, kLogicalAddress);
+    EXPECT_EQ(entities[0].address_info.vin, kVin);
+    EXPECT_EQ(entities[0].address_info.eid, kEid);
+    EXPECT_EQ(entities[0].address_info.gid, kGid);
+    EXPECT_GE(entities[0].last_seen, start);
+  }
+  EXPECT_TRUE(diag_client_->GetVehicleEntities({0xFA26u, "", ""}).empty());
+
+  // Announce the same DoIP entity with synchronized VIN
+  doip_udp_handler_.SendUdpMessage(doip_udp_handler_.ComposeVehicleIdentificationResponse(
+      kDiagUdpBroadCastIpAddress, kAnnouncementPortNum, kUpdatedVin, kLogicalAddress, kEid, kGid, 0,
+      std::nullopt));
+  ASSERT_TRUE(wait_for_changes(2u));
+  EXPECT_TRUE(diag_client_->GetVehicleEntities({std::nullopt, std::string{kVin}, ""}).empty());
+  EXPECT_EQ(diag_client_->GetVehicleEntities({std::nullopt, std::string{kUpdatedVin}, ""}).size(),
+            1U);
+
+  // Verify only the addition and the change were notified
+  diag_client_->SetVehicleEntityChangeHandler({});
+  std::lock_guard<std::mutex> const lock{change_mutex};
+  ASSERT_EQ(changes.size(), 2U);
+  EXPECT_EQ(changes[0].first, diag::client::vehicle_info::VehicleEntityChange::kAdded);
+  EXPECT_EQ(changes[0].second.address_info.vin, kVin);
+  EXPECT_EQ(changes[1].first, diag::client::vehicle_info::VehicleEntityChange::kChanged);
+  EXPECT_EQ(changes[1].second.address_info.vin, kUpdatedVin);
+}
+
 // Fixture to test Vehicle discovery functionality
 class MultipleVehicleDiscoveryFixture : public component::ComponentTest {
  protected:
@@ -316,6 +465,291 @@ TEST_F(MultipleVehicleDiscoveryFixture, VerifyPreselectionModeVin) {
   }
 }
 
+/**
+ * @brief  Verify that the response handler stops the vehicle identification request from waiting for further vehicles.
+ */
+TEST_F(MultipleVehicleDiscoveryFixture, VerifyResponseHandlerStopsCollection) {
+  constexpr std::string_view kVin{"IJKLMNOP123456789"};
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+
+  // First vehicle responds immediately
+  EXPECT_CALL(first_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                           testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kGid](std::string_view client_ip_address,
+                                               std::uint16_t client_port_number, std::string_view,
+                                               std::string_view) {
+        first_doip_udp_handler_.SendUdpMessage(
+            first_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, "ABCDEFGH123456789", 0xFA25u,
+                "00:02:36:31:00:1c", kGid, 0, std::nullopt));
+      }));
+
+  // Second vehicle with the wanted VIN responds later
+  EXPECT_CALL(second_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                            testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kVin, kGid](std::string_view client_ip_address,
+                                                     std::uint16_t client_port_number,
+                                                     std::string_view, std::string_view) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        second_doip_udp_handler_.SendUdpMessage(
+            second_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kVin, 0xFA26u, "00:02:36:32:00:1d", kGid, 0,
+                std::nullopt));
+      }));
+
+  // Send Vehicle Identification request and stop as soon as the wanted VIN is found
+  std::size_t streamed_response_count{0u};
+  diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{0u, ""};
+  auto const start{std::chrono::steady_clock::now()};
+  diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                       diag::client::DiagClient::VehicleInfoResponseError>
+      response{diag_client_->SendVehicleIdentificationRequest(
+          std::move(vehicle_info_request),
+          [&streamed_response_count,
+           kVin](diag::client::vehicle_info::VehicleAddrInfoResponse const &vehicle_response) {
+            ++streamed_response_count;
+            return vehicle_response.vin == kVin;
+          })};
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  ASSERT_TRUE(response.HasValue());
+  EXPECT_LT(elapsed.count(), 1.0);
+
+  // Verify both vehicles were streamed and returned
+  EXPECT_EQ(streamed_response_count, 2U);
+  diag::client::vehicle_info::VehicleInfoMessage::VehicleInfoListResponseType const
+      response_collection{response.Value()->GetVehicleList()};
+  ASSERT_EQ(response_collection.size(), 2U);
+  EXPECT_EQ(response_collection[1].vin, kVin);
+}
+
+/**
+ * @brief  Verify that a unicast sweep requests every target once and completes once every target answered or timed out.
+ */
+TEST_F(MultipleVehicleDiscoveryFixture, VerifyUnicastSweepOverAddressList) {
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+  constexpr std::chrono::milliseconds kResponseTimeout{300u};
+
+  EXPECT_CALL(first_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                           testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kGid](std::string_view client_ip_address,
+                                               std::uint16_t client_port_number, std::string_view eid,
+                                               std::string_view vin) {
+        EXPECT_TRUE(eid.empty());
+        EXPECT_TRUE(vin.empty());
+        first_doip_udp_handler_.SendUdpMessage(
+            first_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, "ABCDEFGH123456789", 0xFA25u,
+                "00:02:36:31:00:1c", kGid, 0, std::nullopt));
+      }));
+
+  EXPECT_CALL(second_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                            testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kGid](std::string_view client_ip_address,
+                                               std::uint16_t client_port_number, std::string_view eid,
+                                               std::string_view vin) {
+        EXPECT_TRUE(eid.empty());
+        EXPECT_TRUE(vin.empty());
+        second_doip_udp_handler_.SendUdpMessage(
+            second_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, "IJKLMNOP123456789", 0xFA26u,
+                "00:02:36:32:00:1d", kGid, 0, std::nullopt));
+      }));
+
+  // Six hosts of the network do not answer, the first vehicle is listed twice
+  diag::client::vehicle_info::VehicleInfoSweepRequestType sweep_request{};
+  sweep_request.targets = {std::string{kDiagUdpUnicastIpAddress}, "172.16.25.136/29",
+                           std::string{kDiagUdpAnotherUnicastIpAddress},
+                           std::string{kDiagUdpUnicastIpAddress}};
+  sweep_request.in_flight_window = 4u;
+  sweep_request.response_timeout = kResponseTimeout;
+
+  std::size_t streamed_response_count{0u};
+  auto const start{std::chrono::steady_clock::now()};
+  diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                       diag::client::DiagClient::VehicleInfoResponseError>
+      response{diag_client_->SendVehicleIdentificationSweep(
+          std::move(sweep_request),
+          [&streamed_response_count](diag::client::vehicle_info::VehicleAddrInfoResponse const &) {
+            ++streamed_response_count;
+            return false;
+          })};
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  ASSERT_TRUE(response.HasValue());
+  // Two rounds of unanswered targets time out, far below DoIPCtrl per target
+  EXPECT_GE(elapsed.count(), 2 * kResponseTimeout.count() / 1000.0);
+  EXPECT_LT(elapsed.count(), 1.5);
+
+  EXPECT_EQ(streamed_response_count, 2U);
+  diag::client::vehicle_info::VehicleInfoMessage::VehicleInfoListResponseType const
+      response_collection{response.Value()->GetVehicleList()};
+  ASSERT_EQ(response_collection.size(), 2U);
+  EXPECT_EQ(response_collection[0].ip_address, kDiagUdpUnicastIpAddress);
+  EXPECT_EQ(response_collection[1].ip_address, kDiagUdpAnotherUnicastIpAddress);
+}
+
+/**
+ * @brief  Verify that a unicast sweep with invalid targets is rejected without sending any request.
+ */
+TEST_F(MultipleVehicleDiscoveryFixture, VerifyUnicastSweepRejectsInvalidTargets) {
+  diag::client::vehicle_info::VehicleInfoSweepRequestType sweep_request{};
+  sweep_request.targets = {std::string{kDiagUdpUnicastIpAddress}, "172.16.25.300"};
+  EXPECT_EQ(diag_client_->SendVehicleIdentificationSweep(sweep_request, {}).Error(),
+            diag::client::DiagClient::VehicleInfoResponseError::kInvalidParameters);
+
+  // Networks larger than a /16 are rejected
+  sweep_request.targets = {"172.0.0.0/8"};
+  EXPECT_EQ(diag_client_->SendVehicleIdentificationSweep(sweep_request, {}).Error(),
+            diag::client::DiagClient::VehicleInfoResponseError::kInvalidParameters);
+}
+
+// Fixture to test Vehicle discovery over several network interfaces
+class MultipleInterfaceVehicleDiscoveryFixture : public component::ComponentTest {
+ protected:
+  MultipleInterfaceVehicleDiscoveryFixture()
+      : first_doip_udp_handler_{kDiagUdpBroadCastIpAddress, kDiagUdpUnicastIpAddress,
+                                kDiagUdpPortNum},
+        second_doip_udp_handler_{kDiagUdpSecondInterfaceBroadCastIpAddress,
+                                 kDiagUdpSecondInterfaceUnicastIpAddress, kDiagUdpPortNum},
+        diag_client_{diag::client::CreateDiagnosticClient(kDiagClientMultiInterfaceConfigPath)} {}
+
+  void SetUp() override {
+    first_doip_udp_handler_.Initialize();
+    second_doip_udp_handler_.Initialize();
+    ASSERT_TRUE(diag_client_->Initialize().HasValue());
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  void TearDown() override {
+    diag_client_->DeInitialize();
+    first_doip_udp_handler_.DeInitialize();
+    second_doip_udp_handler_.DeInitialize();
+  }
+
+ protected:
+  // doip udp handler reachable through the first discovery endpoint
+  testing::StrictMock<common::handler::DoipUdpHandler> first_doip_udp_handler_;
+
+  // doip udp handler reachable through the second discovery endpoint
+  testing::StrictMock<common::handler::DoipUdpHandler> second_doip_udp_handler_;
+
+  // diag client library
+  std::unique_ptr<diag::client::DiagClient> diag_client_;
+};
+
+/**
+ * @brief  Verify that vehicle identification requests are sent on all discovery endpoints in parallel and the responses
+ *         are merged, tagged with the interface they were received on.
+ */
+TEST_F(MultipleInterfaceVehicleDiscoveryFixture, VerifyResponsesMergedAcrossInterfaces) {
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+  constexpr std::string_view kFirstVin{"ABCDEFGH123456789"};
+  constexpr std::string_view kFirstEid{"00:02:36:31:00:1c"};
+  constexpr std::string_view kSecondVin{"IJKLMNOP123456789"};
+  constexpr std::string_view kSecondEid{"00:02:36:32:00:1d"};
+  // Both vehicles use the same logical address
+  std::uint16_t const kLogicalAddress{0xFA25u};
+
+  EXPECT_CALL(first_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                           testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kFirstVin, kFirstEid, kGid, kLogicalAddress](
+                                      std::string_view client_ip_address,
+                                      std::uint16_t client_port_number, std::string_view,
+                                      std::string_view) {
+        first_doip_udp_handler_.SendUdpMessage(
+            first_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kFirstVin, kLogicalAddress, kFirstEid, kGid,
+                0, std::nullopt));
+      }));
+
+  // The second interface reaches another vehicle and, later, the vehicle of first interface again
+  EXPECT_CALL(second_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                            testing::_, testing::_, testing::_, testing::_))
+      .WillOnce(::testing::Invoke([this, kFirstVin, kFirstEid, kSecondVin, kSecondEid, kGid,
+                                   kLogicalAddress](std::string_view client_ip_address,
+                                                    std::uint16_t client_port_number,
+                                                    std::string_view, std::string_view) {
+        EXPECT_EQ(client_ip_address, kDiagClientSecondInterfaceIpAddress);
+        second_doip_udp_handler_.SendUdpMessage(
+            second_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kSecondVin, kLogicalAddress, kSecondEid,
+                kGid, 0, std::nullopt));
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        second_doip_udp_handler_.SendUdpMessage(
+            second_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kFirstVin, kLogicalAddress, kFirstEid, kGid,
+                0, std::nullopt));
+      }));
+
+  // Send Vehicle Identification request and expect response
+  diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{0u, ""};
+  auto const start{std::chrono::steady_clock::now()};
+  diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                       diag::client::DiagClient::VehicleInfoResponseError>
+      response{diag_client_->SendVehicleIdentificationRequest(std::move(vehicle_info_request))};
+  std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+  ASSERT_TRUE(response.HasValue());
+  // Both endpoints wait for DoIPCtrl at the same time
+  EXPECT_LT(elapsed.count(), 3.0);
+
+  // Expect both vehicles once, ordered by EID
+  diag::client::vehicle_info::VehicleInfoMessage::VehicleInfoListResponseType const
+      response_collection{response.Value()->GetVehicleList()};
+  ASSERT_EQ(response_collection.size(), 2U);
+  EXPECT_EQ(response_collection[0].eid, kFirstEid);
+  EXPECT_EQ(response_collection[0].ip_address, kDiagUdpUnicastIpAddress);
+  EXPECT_EQ(response_collection[0].interface_address, kDiagClientFirstInterfaceIpAddress);
+  EXPECT_EQ(response_collection[1].eid, kSecondEid);
+  EXPECT_EQ(response_collection[1].ip_address, kDiagUdpSecondInterfaceUnicastIpAddress);
+  EXPECT_EQ(response_collection[1].interface_address, kDiagClientSecondInterfaceIpAddress);
+}
+
+/**
+ * @brief  Verify that the collection completes early on all discovery endpoints, also on the ones not yet waiting for
+ *         responses once the expected response count is reached.
+ */
+TEST_F(MultipleInterfaceVehicleDiscoveryFixture, VerifyExpectedResponseCountCompletesEarlyOnAllInterfaces) {
+  constexpr std::string_view kGid{"0a:0b:0c:0d:0e:0f"};
+  constexpr std::string_view kVin{"IJKLMNOP123456789"};
+  constexpr std::string_view kEid{"00:02:36:32:00:1d"};
+  std::uint16_t const kLogicalAddress{0xFA25u};
+  constexpr std::uint8_t kNumberOfRequests{3u};
+
+  // Only the vehicle reachable through the second interface answers, as soon as the request is received
+  EXPECT_CALL(first_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                           testing::_, testing::_, testing::_, testing::_))
+      .Times(kNumberOfRequests);
+  EXPECT_CALL(second_doip_udp_handler_, ProcessVehicleIdentificationRequestMessage(
+                                            testing::_, testing::_, testing::_, testing::_))
+      .Times(kNumberOfRequests)
+      .WillRepeatedly(::testing::Invoke([this, kVin, kEid, kGid, kLogicalAddress](
+                                            std::string_view client_ip_address,
+                                            std::uint16_t client_port_number, std::string_view,
+                                            std::string_view) {
+        second_doip_udp_handler_.SendUdpMessage(
+            second_doip_udp_handler_.ComposeVehicleIdentificationResponse(
+                client_ip_address, client_port_number, kVin, kLogicalAddress, kEid, kGid, 0,
+                std::nullopt));
+      }));
+
+  // Every request expecting one DoIP entity returns before DoIPCtrl of 2 sec expired
+  for (std::uint8_t request_count{0u}; request_count < kNumberOfRequests; request_count++) {
+    diag::client::vehicle_info::VehicleInfoListRequestType vehicle_info_request{0u, "", 1u};
+    auto const start{std::chrono::steady_clock::now()};
+    diag::client::Result<diag::client::vehicle_info::VehicleInfoMessageResponseUniquePtr,
+                         diag::client::DiagClient::VehicleInfoResponseError>
+        response{diag_client_->SendVehicleIdentificationRequest(std::move(vehicle_info_request))};
+    std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - start};
+    ASSERT_TRUE(response.HasValue());
+    EXPECT_LT(elapsed.count(), 1.0);
+
+    diag::client::vehicle_info::VehicleInfoMessage::VehicleInfoListResponseType const
+        response_collection{response.Value()->GetVehicleList()};
+    ASSERT_EQ(response_collection.size(), 1U);
+    EXPECT_EQ(response_collection[0].eid, kEid);
+    EXPECT_EQ(response_collection[0].interface_address, kDiagClientSecondInterfaceIpAddress);
+  }
+}
+
 }  // namespace test_cases
 }  // namespace component
 }  // namespace test